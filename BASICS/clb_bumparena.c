@@ -0,0 +1,156 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_bumparena.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Bump (region) allocators.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sat Oct 17 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "clb_bumparena.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: BumpArenaAlloc()
+//
+//   Return an empty arena with one standard block.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+BumpArena_p BumpArenaAlloc(void)
+{
+   BumpArena_p handle = BumpArenaCellAlloc();
+
+   handle->block = NULL;
+   BumpArenaNewBlock(handle, BUMP_ARENA_BLOCK);
+   handle->used  = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: BumpArenaFree()
+//
+//   Free an arena and all memory handed out by it.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void BumpArenaFree(BumpArena_p junk)
+{
+   BumpArenaBlock_p block;
+
+   while(junk->block)
+   {
+      block       = junk->block;
+      junk->block = block->next;
+      FREE(block);
+   }
+   BumpArenaCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: BumpArenaNewBlock()
+//
+//   Add a new block with at least size usable bytes and make it the
+//   current block of the arena. The rest of the old block is wasted.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void BumpArenaNewBlock(BumpArena_p arena, size_t size)
+{
+   BumpArenaBlock_p block;
+
+   size = MAX(size, BUMP_ARENA_BLOCK);
+   block = SecureMalloc(BUMP_ARENA_HEADER+size);
+   block->next = arena->block;
+   block->size = size;
+
+   arena->block = block;
+   arena->pos   = BumpArenaBlockData(block);
+   arena->end   = arena->pos+size;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: BumpArenaReset()
+//
+//   Invalidate all memory handed out by the arena. The oldest block
+//   is kept for reuse, all others are returned.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void BumpArenaReset(BumpArena_p arena)
+{
+   BumpArenaBlock_p block;
+
+   while(arena->block->next)
+   {
+      block        = arena->block;
+      arena->block = block->next;
+      FREE(block);
+   }
+   arena->pos  = BumpArenaBlockData(arena->block);
+   arena->end  = arena->pos+arena->block->size;
+   arena->used = 0;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,118 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_bumparena.h
+
+Author: agent (agent@local)
+
+Contents
+
+  Bump (region) allocators: Memory is handed out sequentially from
+  large blocks and cannot be freed individually. Instead, all memory
+  of an arena is released at once with BumpArenaReset(), which is
+  O(1) apart from returning surplus blocks.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sat Oct 17 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CLB_BUMPARENA
+
+#define CLB_BUMPARENA
+
+#include <clb_memory.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define BUMP_ARENA_BLOCK 65536  /* Usable bytes per standard block */
+#define BUMP_ARENA_ALIGN 8
+#define BUMP_ARENA_ROUND(size) \
+   (((size)+BUMP_ARENA_ALIGN-1)&~((size_t)BUMP_ARENA_ALIGN-1))
+
+/* Blocks are chained from the most recent to the oldest one. The
+   usable memory follows the header. */
+
+typedef struct bumparenablock
+{
+   struct bumparenablock *next;
+   size_t                size;
+}BumpArenaBlock, *BumpArenaBlock_p;
+
+#define BUMP_ARENA_HEADER BUMP_ARENA_ROUND(sizeof(BumpArenaBlock))
+#define BumpArenaBlockData(block) ((char*)(block)+BUMP_ARENA_HEADER)
+
+typedef struct bumparenacell
+{
+   BumpArenaBlock_p block;  /* Current block */
+   char             *pos;   /* First free byte in it */
+   char             *end;   /* End of the current block */
+   long             used;   /* Bytes handed out since the last reset */
+}BumpArenaCell, *BumpArena_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define BumpArenaCellAlloc()    (BumpArenaCell*)SizeMalloc(sizeof(BumpArenaCell))
+#define BumpArenaCellFree(junk) SizeFree(junk, sizeof(BumpArenaCell))
+
+#define BumpArenaUsed(arena) ((arena)->used)
+
+BumpArena_p BumpArenaAlloc(void);
+void        BumpArenaFree(BumpArena_p junk);
+void        BumpArenaNewBlock(BumpArena_p arena, size_t size);
+void        BumpArenaReset(BumpArena_p arena);
+
+static inline void* BumpArenaMalloc(BumpArena_p arena, size_t size);
+
+
+/*---------------------------------------------------------------------*/
+/*                       Inline-Functions                              */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: BumpArenaMalloc()
+//
+//   Return a block of size bytes (aligned to BUMP_ARENA_ALIGN) from
+//   the arena. It stays valid until the next BumpArenaReset().
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static inline void* BumpArenaMalloc(BumpArena_p arena, size_t size)
+{
+   void* res;
+
+   size = BUMP_ARENA_ROUND(size);
+   if((size_t)(arena->end-arena->pos) < size)
+   {
+      BumpArenaNewBlock(arena, size);
+   }
+   res = arena->pos;
+   arena->pos  += size;
+   arena->used += size;
+
+   return res;
+}
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -186,15 +186,21 @@ char* DStrAppendChar(DStr_p strdes, char newch)
 
 char* DStrAppendBuffer(DStr_p strdes, char* buf, int len)
 {
-   int i;
+   long newmem;
 
    assert(strdes);
    assert(buf);
 
-   for(i=0; i<len; i++)
+   if(strdes->len+len >= strdes->mem)
    {
-      DStrAppendChar(strdes, buf[i]);
+      newmem = strdes->len+len+DSTRGROW;
+      strdes->string = SecureRealloc(strdes->string, newmem);
+      strdes->mem = newmem;
    }
+   memcpy(strdes->string+strdes->len, buf, len);
+   strdes->len += len;
+   strdes->string[strdes->len] = '\0';
+
    return strdes->string;
 }
 
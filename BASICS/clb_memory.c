@@ -16,6 +16,7 @@
   Changes
 
   Created: Thu Aug 14 10:00:35 MET DST 1997
+  Fri Oct 16 2026: Slab allocation (USE_SLAB_MEM).
 
   -----------------------------------------------------------------------*/
 
@@ -41,7 +42,14 @@
 
 bool MemIsLow = false;
 
-Mem_p free_mem_list[MEM_ARR_SIZE] = {NULL};
+MEM_TLS Mem_p free_mem_list[MEM_ARR_SIZE] = {NULL};
+
+#ifdef USE_SLAB_MEM
+/* All slabs allocated by this thread, and the number of slabs per
+   size class. */
+static MEM_TLS MemSlab_p mem_slabs = NULL;
+static MEM_TLS long      mem_slab_count[MEM_SLAB_MAX_BLOCK] = {0};
+#endif
 
 #ifdef CLB_MEMORY_DEBUG
 long size_malloc_mem = 0;
@@ -54,6 +62,7 @@ long secure_malloc_mem = 0;
 long secure_realloc_count = 0;
 long secure_realloc_m_count = 0;
 long secure_realloc_f_count = 0;
+MEM_TLS long size_class_malloc_count[MEM_ARR_SIZE] = {0};
 #endif
 
 
@@ -116,7 +125,13 @@ void MemFlushFreeList(void)
    void* handle;
 
    VERBOUT("MemFlushFreeList() called for cleanup or reorganization\n");
+#ifdef USE_SLAB_MEM
+   /* Blocks of the smaller classes live in slabs and can only be
+      released with MemArenaReset() */
+   for(f = MEM_SLAB_MAX_BLOCK;f<MEM_ARR_SIZE;f++)
+#else
    for(f = 0;f<MEM_ARR_SIZE;f++)
+#endif
    {
       while(free_mem_list[f])
       {
@@ -128,6 +143,85 @@ void MemFlushFreeList(void)
 }
 
 
+#ifdef USE_SLAB_MEM
+
+/*-----------------------------------------------------------------------
+//
+// Function: MemSlabRefill()
+//
+//   Allocate a new slab, cut it into blocks of the given size and
+//   put them onto the (empty) free list for that size.
+//
+// Global Variables: free_mem_list[], mem_slabs, mem_slab_count[]
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void MemSlabRefill(size_t size)
+{
+   MemSlab_p slab;
+   char      *block, *end;
+   size_t    stride = MEM_SLAB_STRIDE(size);
+
+   assert(size >= MEM_ARR_MIN_INDEX);
+   assert(size < MEM_SLAB_MAX_BLOCK);
+   assert(!free_mem_list[size]);
+
+   slab       = SecureMalloc(MEM_SLAB_SIZE);
+   slab->size = size;
+   slab->next = mem_slabs;
+   mem_slabs  = slab;
+   mem_slab_count[size]++;
+
+   block = (char*)slab+MEM_SLAB_STRIDE(sizeof(MemSlab));
+   end   = (char*)slab+MEM_SLAB_SIZE-stride;
+   for(; block <= end; block += stride)
+   {
+      ((Mem_p)block)->next = free_mem_list[size];
+      free_mem_list[size]  = (Mem_p)block;
+      assert((free_mem_list[size]->test = MEM_FREE_PATTERN));
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: MemArenaReset()
+//
+//   Release all memory managed by SizeMalloc()/SizeFree() in the
+//   calling thread in one go: All slabs are returned to the operating
+//   system, and all free lists are emptied. All blocks handed out by
+//   SizeMalloc() in this thread become invalid!
+//
+// Global Variables: free_mem_list[], mem_slabs, mem_slab_count[]
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void MemArenaReset(void)
+{
+   MemSlab_p handle;
+   int       f;
+
+   MemFlushFreeList();
+   for(f = 0;f<MEM_SLAB_MAX_BLOCK;f++)
+   {
+      free_mem_list[f]  = NULL;
+      mem_slab_count[f] = 0;
+   }
+   while(mem_slabs)
+   {
+      handle    = mem_slabs;
+      mem_slabs = mem_slabs->next;
+      FREE(handle);
+   }
+}
+
+#endif
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: SecureMalloc()
@@ -342,10 +436,13 @@ long* IntArrayAlloc(int size)
 //
 // Function: MemDebugPrintStats()
 //
-//   Print information about allocated and deallocated memory.
+//   Print information about allocated and deallocated memory,
+//   including per size class statistics.
 //
 // Global Variables: size_malloc_mem, size_malloc_count,
-//                   size_free_mem, size_free_count
+//                   size_free_mem, size_free_count,
+//                   size_class_malloc_count[], free_mem_list[],
+//                   (possibly) mem_slab_count[]
 //
 // Side Effects    : Output
 //
@@ -353,6 +450,8 @@ long* IntArrayAlloc(int size)
 
 void MemDebugPrintStats(FILE* out)
 {
+   long i;
+
    fprintf(out,
            "\n# -------------------------------------------------\n");
    fprintf(out,
@@ -376,6 +475,25 @@ void MemDebugPrintStats(FILE* out)
            secure_realloc_count, secure_realloc_m_count,
            secure_realloc_f_count,
            secure_realloc_count-(secure_realloc_m_count+secure_realloc_f_count));
+   fprintf(out,
+           "# Size class  SizeMalloc()s  Free blocks"
+#ifdef USE_SLAB_MEM
+           "  Slabs"
+#endif
+           "\n");
+   for(i=0; i<MEM_ARR_SIZE; i++)
+   {
+      if(size_class_malloc_count[i])
+      {
+         fprintf(out, "# %10ld  %13ld  %11ld",
+                 i, size_class_malloc_count[i],
+                 free_list_size(free_mem_list[i]));
+#ifdef USE_SLAB_MEM
+         fprintf(out, "  %5ld", (i<MEM_SLAB_MAX_BLOCK)?mem_slab_count[i]:0);
+#endif
+         fprintf(out, "\n");
+      }
+   }
    fprintf(out,
            "# -------------------------------------------------\n\n");
 }
@@ -19,6 +19,8 @@
   Changes
 
   Created: Wed Aug 13 21:56:20 MET DST 1997
+  Fri Oct 16 2026: Optional slab allocation with per-thread free
+  lists (USE_SLAB_MEM).
 
   -----------------------------------------------------------------------*/
 
@@ -47,6 +49,18 @@ typedef struct memcell
 #endif
 }MemCell, *Mem_p;
 
+
+/* With USE_SLAB_MEM, small blocks are not requested from malloc()
+   individually, but carved from page-sized slabs. Slabs are
+   remembered (per thread) so that all of them can be released in one
+   go. */
+
+typedef struct memslab
+{
+   struct memslab* next;
+   size_t          size;   /* Size class the slab has been cut for */
+}MemSlab, *MemSlab_p;
+
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
@@ -56,9 +70,20 @@ typedef struct memcell
 #define MEM_FREE_PATTERN 0xFAFBFAFA
 #define MEM_RSET_PATTERN 0x00000000
 
+#ifdef USE_SLAB_MEM
+#define MEM_SLAB_SIZE      4096  /* Including the MemSlab header */
+#define MEM_SLAB_MAX_BLOCK 1024  /* Larger blocks are malloc()ed */
+#define MEM_SLAB_ALIGN     8
+#define MEM_SLAB_STRIDE(size) \
+   (((size)+MEM_SLAB_ALIGN-1)&~((size_t)MEM_SLAB_ALIGN-1))
+#define MEM_TLS __thread
+#else
+#define MEM_TLS
+#endif
+
 extern bool MemIsLow;
-extern Mem_p free_mem_list[]; /* Exported for use by inline
-                               * functions/Macros */
+extern MEM_TLS Mem_p free_mem_list[]; /* Exported for use by inline
+                                       * functions/Macros */
 
 static inline void* SizeMallocReal(size_t size);
 static inline void  SizeFreeReal(void* junk, size_t size);
@@ -102,6 +127,10 @@ static inline void  SizeFreeReal(void* junk, size_t size);
 #endif
 
 void  MemFlushFreeList(void);
+#ifdef USE_SLAB_MEM
+void  MemSlabRefill(size_t size);
+void  MemArenaReset(void);
+#endif
 void* SecureMalloc(size_t size);
 void* SecureRealloc(void *ptr, size_t size);
 char* SecureStrdup(const char* source);
@@ -123,6 +152,7 @@ extern long secure_malloc_mem;
 extern long secure_realloc_count;
 extern long secure_realloc_m_count;
 extern long secure_realloc_f_count;
+extern MEM_TLS long size_class_malloc_count[];
 void MemFreeListPrint(FILE* out);
 #undef FREE
 #define FREE(junk) assert(junk); clb_free_count++; free(junk); junk=NULL
@@ -152,7 +182,9 @@ void MemFreeListPrint(FILE* out);
 //
 //   Returns a block of memory sized size using the internal
 //   free-list. This block is freeable with free(), and in all
-//   respects behaves like a normal malloc'ed block.
+//   respects behaves like a normal malloc'ed block - except with
+//   USE_SLAB_MEM, where small blocks come from a slab and must only
+//   be returned with SizeFree().
 //
 // Global Variables: free_mem_list[]
 //
@@ -164,6 +196,13 @@ static inline void* SizeMallocReal(size_t size)
 {
    Mem_p handle;
 
+#ifdef USE_SLAB_MEM
+   if(UNLIKELY(size>=MEM_ARR_MIN_INDEX && size<MEM_SLAB_MAX_BLOCK &&
+               !free_mem_list[size]))
+   {
+      MemSlabRefill(size);
+   }
+#endif
    if(size>=MEM_ARR_MIN_INDEX && size<MEM_ARR_SIZE && free_mem_list[size])
    {
       assert(free_mem_list[size]->test == MEM_FREE_PATTERN);
@@ -184,6 +223,10 @@ static inline void* SizeMallocReal(size_t size)
 #ifdef CLB_MEMORY_DEBUG
    size_malloc_mem+=size;
    size_malloc_count++;
+   if(size<MEM_ARR_SIZE)
+   {
+      size_class_malloc_count[size]++;
+   }
 #endif
 #ifdef CLB_MEMORY_DEBUG2
    printf("\nBlock %p A: size %zd\n", handle, size);
@@ -0,0 +1,347 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_strhash.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Hash tables with interned string keys.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sat Oct 17 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "clb_strhash.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: strhash_slot()
+//
+//   Return the slot for key (with hash value hash) in table - either
+//   the one holding key, or the empty one where it would be inserted.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static StrHashEntry_p strhash_slot(StrHash_p table, const char* key,
+                                   unsigned long hash)
+{
+   unsigned long  mask = table->size-1;
+   unsigned long  i    = hash&mask;
+   StrHashEntry_p slot;
+
+   while(true)
+   {
+      slot = &(table->table[i]);
+      if(!slot->key ||
+         (slot->hash == hash && strcmp(slot->key, key)==0))
+      {
+         return slot;
+      }
+      i = (i+1)&mask;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: strhash_grow()
+//
+//   Double the number of slots of the table and rehash all entries
+//   (using the stored hash values).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void strhash_grow(StrHash_p table)
+{
+   StrHashEntry_p old = table->table;
+   long           old_size = table->size, i;
+   unsigned long  mask, j;
+
+   table->size *= 2;
+   table->table = SecureMalloc(table->size*sizeof(StrHashEntryCell));
+   memset(table->table, 0, table->size*sizeof(StrHashEntryCell));
+   mask = table->size-1;
+
+   for(i=0; i<old_size; i++)
+   {
+      if(old[i].key)
+      {
+         for(j=old[i].hash&mask; table->table[j].key; j=(j+1)&mask)
+         {
+            /* Nothing */
+         }
+         table->table[j] = old[i];
+      }
+   }
+   FREE(old);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: strhash_arena_copy()
+//
+//   Copy key (with length len) into the arena of the table and return
+//   the copy.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static char* strhash_arena_copy(StrHash_p table, const char* key, long len)
+{
+   char *block, *res;
+   long size;
+
+   if(!table->arena || table->arena_pos+len+1 > table->arena_size)
+   {
+      size = MAX(STRHASH_ARENA_BLOCK, (long)sizeof(char*)+len+1);
+      block = SecureMalloc(size);
+      *(char**)block    = table->arena;
+      table->arena      = block;
+      table->arena_pos  = sizeof(char*);
+      table->arena_size = size;
+   }
+   res = table->arena+table->arena_pos;
+   memcpy(res, key, len+1);
+   table->arena_pos += len+1;
+
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashValue()
+//
+//   Return the (FNV-1a) hash value of key.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+unsigned long StrHashValue(const char* key)
+{
+   unsigned long res = 14695981039346656037UL;
+
+   for(; *key; key++)
+   {
+      res ^= (unsigned char)*key;
+      res *= 1099511628211UL;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashAlloc()
+//
+//   Return an empty hash table.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+StrHash_p StrHashAlloc(void)
+{
+   StrHash_p handle = StrHashCellAlloc();
+
+   handle->size       = STRHASH_INIT_SIZE;
+   handle->count      = 0;
+   handle->table      = SecureMalloc(STRHASH_INIT_SIZE*
+                                     sizeof(StrHashEntryCell));
+   memset(handle->table, 0, STRHASH_INIT_SIZE*sizeof(StrHashEntryCell));
+   handle->arena      = NULL;
+   handle->arena_pos  = 0;
+   handle->arena_size = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashFree()
+//
+//   Free a hash table including all keys. Objects pointed to by the
+//   values are not touched.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void StrHashFree(StrHash_p junk)
+{
+   char *block;
+
+   while(junk->arena)
+   {
+      block = junk->arena;
+      junk->arena = *(char**)block;
+      FREE(block);
+   }
+   FREE(junk->table);
+   StrHashCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashFind()
+//
+//   Return the entry for key, or NULL if key is not in the table.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+StrHashEntry_p StrHashFind(StrHash_p table, const char* key)
+{
+   StrHashEntry_p slot = strhash_slot(table, key, StrHashValue(key));
+
+   return slot->key?slot:NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashInsert()
+//
+//   Return the entry for key. If none exists yet, create one (with an
+//   interned copy of key and values 0) and set *is_new to true,
+//   otherwise set it to false. The entry pointer is only valid until
+//   the next insertion.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+StrHashEntry_p StrHashInsert(StrHash_p table, const char* key,
+                             bool *is_new)
+{
+   unsigned long  hash = StrHashValue(key);
+   StrHashEntry_p slot;
+
+   if(2*(table->count+1) > table->size)
+   {
+      strhash_grow(table);
+   }
+   slot = strhash_slot(table, key, hash);
+   *is_new = !slot->key;
+   if(*is_new)
+   {
+      slot->key        = strhash_arena_copy(table, key, strlen(key));
+      slot->hash       = hash;
+      slot->val1.i_val = 0;
+      slot->val2.i_val = 0;
+      table->count++;
+   }
+   return slot;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashStore()
+//
+//   Insert key with the given values into the table. Return the new
+//   entry, or NULL if key already was in the table (in which case
+//   the table is unchanged).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+StrHashEntry_p StrHashStore(StrHash_p table, const char* key,
+                            IntOrP val1, IntOrP val2)
+{
+   bool           is_new;
+   StrHashEntry_p entry = StrHashInsert(table, key, &is_new);
+
+   if(!is_new)
+   {
+      return NULL;
+   }
+   entry->val1 = val1;
+   entry->val2 = val2;
+
+   return entry;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StrHashIntern()
+//
+//   Return the interned copy of key, inserting it if necessary.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+char* StrHashIntern(StrHash_p table, const char* key)
+{
+   bool is_new;
+
+   return StrHashInsert(table, key, &is_new)->key;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,92 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_strhash.h
+
+Author: agent (agent@local)
+
+Contents
+
+  Hash tables with string keys and up to two int or pointer values.
+  Keys are interned: Each table stores a single copy of each key in
+  an arena of large blocks, so that keys returned by the table can be
+  compared by pointer and stay valid for the lifetime of the table.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sat Oct 17 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CLB_STRHASH
+
+#define CLB_STRHASH
+
+#include <clb_dstrings.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define STRHASH_INIT_SIZE   64     /* Slots, must be a power of 2 */
+#define STRHASH_ARENA_BLOCK 65536  /* Bytes per arena block */
+
+/* One slot of the table. A slot with key NULL is empty. */
+
+typedef struct strhashentrycell
+{
+   char           *key;
+   unsigned long  hash;
+   IntOrP         val1;
+   IntOrP         val2;
+}StrHashEntryCell, *StrHashEntry_p;
+
+
+/* Open addressing with linear probing. Entries are never deleted,
+   which keeps probing simple. Keys are stored in a linked list of
+   arena blocks (the first word of each block points to the previous
+   one), and are free()d only with the whole table. */
+
+typedef struct strhashcell
+{
+   long           size;      /* Number of slots */
+   long           count;     /* Number of used slots */
+   StrHashEntry_p table;
+   char           *arena;    /* Most recent arena block */
+   long           arena_pos; /* First free byte in it */
+   long           arena_size;
+}StrHashCell, *StrHash_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define StrHashCellAlloc()    (StrHashCell*)SizeMalloc(sizeof(StrHashCell))
+#define StrHashCellFree(junk) SizeFree(junk, sizeof(StrHashCell))
+
+#define StrHashCardinality(table) ((table)->count)
+
+unsigned long  StrHashValue(const char* key);
+
+StrHash_p      StrHashAlloc(void);
+void           StrHashFree(StrHash_p junk);
+StrHashEntry_p StrHashFind(StrHash_p table, const char* key);
+StrHashEntry_p StrHashInsert(StrHash_p table, const char* key,
+                             bool *is_new);
+StrHashEntry_p StrHashStore(StrHash_p table, const char* key,
+                            IntOrP val1, IntOrP val2);
+char*          StrHashIntern(StrHash_p table, const char* key);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,291 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_threadpool.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Fork/join pool of persistent worker threads.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Fri Oct 16 2026
+    New
+<2> Sat Oct 17 2026
+    ThreadPoolAddExitHook()
+
+-----------------------------------------------------------------------*/
+
+#include <signal.h>
+#include "clb_threadpool.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Run by each helper thread before it terminates */
+
+static ThreadPoolExitHook exit_hooks[THREAD_POOL_MAX_EXIT_HOOKS];
+static int                exit_hook_count = 0;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+typedef struct threadpoolarg
+{
+   ThreadPool_p pool;
+   int          worker;
+}ThreadPoolArg;
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: thread_pool_helper()
+//
+//   Main loop of a helper thread: Wait for a new job, run it, report
+//   completion, until the pool is shut down. Then run the exit hooks.
+//
+// Global Variables: exit_hooks, exit_hook_count
+//
+// Side Effects    : Runs jobs, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void* thread_pool_helper(void* arg)
+{
+   ThreadPoolArg *targ = arg;
+   ThreadPool_p  pool  = targ->pool;
+   int           worker = targ->worker;
+   long          seen   = 0;
+   int           i;
+
+   FREE(targ);
+   pthread_mutex_lock(&pool->lock);
+   while(true)
+   {
+      while(!pool->shutdown && pool->generation == seen)
+      {
+         pthread_cond_wait(&pool->start, &pool->lock);
+      }
+      if(pool->shutdown)
+      {
+         break;
+      }
+      seen = pool->generation;
+      pthread_mutex_unlock(&pool->lock);
+
+      pool->job(pool->data, worker);
+
+      pthread_mutex_lock(&pool->lock);
+      pool->running--;
+      if(!pool->running)
+      {
+         pthread_cond_signal(&pool->done);
+      }
+   }
+   pthread_mutex_unlock(&pool->lock);
+   for(i=0; i<exit_hook_count; i++)
+   {
+      exit_hooks[i]();
+   }
+#ifdef USE_SLAB_MEM
+   MemArenaReset();
+#endif
+   return NULL;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: ThreadPoolAlloc()
+//
+//   Create a pool that runs jobs with the given number of workers
+//   (the calling thread and workers-1 helper threads). Helper threads
+//   block all signals, so that signals (in particular resource limit
+//   signals) are always handled by the main thread.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, creates threads
+//
+/----------------------------------------------------------------------*/
+
+ThreadPool_p ThreadPoolAlloc(int workers)
+{
+   ThreadPool_p  handle = ThreadPoolCellAlloc();
+   ThreadPoolArg *arg;
+   sigset_t      all, old;
+   int           i;
+
+   assert(workers > 0);
+
+   handle->workers    = workers;
+   handle->threads    = NULL;
+   handle->generation = 0;
+   handle->running    = 0;
+   handle->shutdown   = false;
+   handle->job        = NULL;
+   handle->data       = NULL;
+   pthread_mutex_init(&handle->lock, NULL);
+   pthread_cond_init(&handle->start, NULL);
+   pthread_cond_init(&handle->done, NULL);
+
+   if(workers > 1)
+   {
+      handle->threads = SecureMalloc((workers-1)*sizeof(pthread_t));
+      sigfillset(&all);
+      pthread_sigmask(SIG_SETMASK, &all, &old);
+      for(i=1; i<workers; i++)
+      {
+         arg = SecureMalloc(sizeof(ThreadPoolArg));
+         arg->pool   = handle;
+         arg->worker = i;
+         if(pthread_create(&handle->threads[i-1], NULL,
+                           thread_pool_helper, arg))
+         {
+            SysError("Cannot create worker thread", SYS_ERROR);
+         }
+      }
+      pthread_sigmask(SIG_SETMASK, &old, NULL);
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ThreadPoolFree()
+//
+//   Stop all helper threads and free the pool.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, joins threads
+//
+/----------------------------------------------------------------------*/
+
+void ThreadPoolFree(ThreadPool_p junk)
+{
+   int i;
+
+   assert(junk);
+   assert(!junk->running);
+
+   if(junk->threads)
+   {
+      pthread_mutex_lock(&junk->lock);
+      junk->shutdown = true;
+      pthread_cond_broadcast(&junk->start);
+      pthread_mutex_unlock(&junk->lock);
+      for(i=1; i<junk->workers; i++)
+      {
+         pthread_join(junk->threads[i-1], NULL);
+      }
+      FREE(junk->threads);
+   }
+   pthread_cond_destroy(&junk->done);
+   pthread_cond_destroy(&junk->start);
+   pthread_mutex_destroy(&junk->lock);
+   ThreadPoolCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ThreadPoolRun()
+//
+//   Run job(data, i) for all workers i and return when all of them
+//   are done. Instance 0 runs in the calling thread. Writes of the
+//   job instances are visible to the caller on return.
+//
+// Global Variables: -
+//
+// Side Effects    : Whatever job does
+//
+/----------------------------------------------------------------------*/
+
+void ThreadPoolRun(ThreadPool_p pool, ThreadPoolJobFun job, void* data)
+{
+   assert(pool);
+   assert(job);
+
+   if(!pool->threads)
+   {
+      job(data, 0);
+      return;
+   }
+   pthread_mutex_lock(&pool->lock);
+   assert(!pool->running);
+   pool->job     = job;
+   pool->data    = data;
+   pool->running = pool->workers-1;
+   pool->generation++;
+   pthread_cond_broadcast(&pool->start);
+   pthread_mutex_unlock(&pool->lock);
+
+   job(data, 0);
+
+   pthread_mutex_lock(&pool->lock);
+   while(pool->running)
+   {
+      pthread_cond_wait(&pool->done, &pool->lock);
+   }
+   pthread_mutex_unlock(&pool->lock);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ThreadPoolAddExitHook()
+//
+//   Register a function that every helper thread (of all pools) runs
+//   when it terminates. Registering the same hook again has no
+//   effect. Must not be called while helper threads exist.
+//
+// Global Variables: exit_hooks, exit_hook_count
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void ThreadPoolAddExitHook(ThreadPoolExitHook hook)
+{
+   int i;
+
+   for(i=0; i<exit_hook_count; i++)
+   {
+      if(exit_hooks[i] == hook)
+      {
+         return;
+      }
+   }
+   if(exit_hook_count == THREAD_POOL_MAX_EXIT_HOOKS)
+   {
+      Error("Too many thread exit hooks", OTHER_ERROR);
+   }
+   exit_hooks[exit_hook_count++] = hook;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
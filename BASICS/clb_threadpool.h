@@ -0,0 +1,102 @@
+/*-----------------------------------------------------------------------
+
+File  : clb_threadpool.h
+
+Author: agent (agent@local)
+
+Contents
+
+  A minimal pool of persistent worker threads that run the same job
+  function on a shared data block, one instance per worker, and
+  return once all instances are done (fork/join).
+
+  Note that the built-in memory management is only safe to use from
+  several threads if it is compiled with USE_SLAB_MEM (per-thread
+  free lists) or USE_SYSTEM_MEM (plain malloc()). The pool can be
+  created in any case, but callers should only distribute work that
+  touches SizeMalloc() if ThreadPoolMemIsSafe is true.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Fri Oct 16 2026
+    New
+<2> Sat Oct 17 2026
+    Exit hooks for helper threads
+
+-----------------------------------------------------------------------*/
+
+#ifndef CLB_THREADPOOL
+
+#define CLB_THREADPOOL
+
+#include <pthread.h>
+#include <clb_memory.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* A job is called as job(data, worker) with 0 <= worker <
+   pool->workers. Instance 0 always runs in the calling thread. */
+
+typedef void (*ThreadPoolJobFun)(void* data, int worker);
+
+/* Called by every helper thread when it terminates, e.g. to free
+   thread local data of higher layers */
+
+typedef void (*ThreadPoolExitHook)(void);
+
+#define THREAD_POOL_MAX_EXIT_HOOKS 8
+
+typedef struct threadpoolcell
+{
+   int              workers;    /* Including the calling thread */
+   pthread_t        *threads;   /* workers-1 helper threads */
+   pthread_mutex_t  lock;
+   pthread_cond_t   start;      /* Signalled for each new job */
+   pthread_cond_t   done;       /* Signalled by the last helper */
+   long             generation; /* Counts jobs */
+   int              running;    /* Helpers still busy with the job */
+   bool             shutdown;
+   ThreadPoolJobFun job;
+   void             *data;
+}ThreadPoolCell, *ThreadPool_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+/* Thread local storage for statistics counters that are updated from
+   inside pool jobs. */
+#define THREAD_LOCAL __thread
+
+#if defined(USE_SLAB_MEM) || defined(USE_SYSTEM_MEM)
+#define ThreadPoolMemIsSafe true
+#else
+#define ThreadPoolMemIsSafe false
+#endif
+
+#define ThreadPoolCellAlloc()    (ThreadPoolCell*)SizeMalloc(sizeof(ThreadPoolCell))
+#define ThreadPoolCellFree(junk) SizeFree(junk, sizeof(ThreadPoolCell))
+
+ThreadPool_p ThreadPoolAlloc(int workers);
+void         ThreadPoolFree(ThreadPool_p junk);
+void         ThreadPoolRun(ThreadPool_p pool, ThreadPoolJobFun job,
+                           void* data);
+void         ThreadPoolAddExitHook(ThreadPoolExitHook hook);
+
+#define ThreadPoolWorkers(pool) ((pool)->workers)
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -273,6 +273,44 @@ Clause_p EmptyClauseAlloc(void)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseGetAllocCount()
+//
+//   Return the current value of the counter used for the internal
+//   identifiers of clauses created by ClauseAlloc().
+//
+// Global Variables: global_clause_counter
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long ClauseGetAllocCount(void)
+{
+   return global_clause_counter;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetAllocCount()
+//
+//   Set the counter for internal clause identifiers, e.g. to account
+//   for clauses created in a different process.
+//
+// Global Variables: global_clause_counter
+//
+// Side Effects    : The next clauses get different identifiers
+//
+/----------------------------------------------------------------------*/
+
+void ClauseSetAllocCount(long value)
+{
+   global_clause_counter = value;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseAlloc()
@@ -1305,9 +1343,11 @@ void ClausePCLPrint(FILE* out, Clause_p clause, bool fullterms)
               ClauseQueryProp(clause, CPLimitedRW),
               clause->date,
               clause->literals->lterm->entry_no,
-              clause->literals->lterm->rw_data.nf_date[RewriteAdr(FullRewrite)],
+              TermNFDateField(clause->literals->lterm,
+                              RewriteAdr(FullRewrite)),
               clause->literals->rterm->entry_no,
-              clause->literals->rterm->rw_data.nf_date[RewriteAdr(FullRewrite)]
+              TermNFDateField(clause->literals->rterm,
+                              RewriteAdr(FullRewrite))
          );
    }
 #endif
@@ -1857,10 +1897,12 @@ double ClauseWeight(Clause_p clause, double max_term_multiplier,
 //
 //   Compute the weight of a clause by summing weights for individual
 //   function symbols and variables and applying various modifiers.
+//   If cache_id is non-zero, term weights are memoized in the term
+//   bank (see EqnFunWeight()).
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations (for the memo table)
 //
 /----------------------------------------------------------------------*/
 
@@ -1868,7 +1910,7 @@ double ClauseFunWeight(Clause_p clause, double max_term_multiplier,
                        double max_literal_multiplier, double
                        pos_multiplier, long vweight, long flimit,
                        long *fweights, long default_fweight, double app_var_mult,
-                       long *typefreqs)
+                       long *typefreqs, long cache_id)
 {
    Eqn_p  handle;
    double res = 0;
@@ -1879,7 +1921,7 @@ double ClauseFunWeight(Clause_p clause, double max_term_multiplier,
                               max_literal_multiplier, pos_multiplier,
                               vweight, flimit, fweights,
                               default_fweight, app_var_mult,
-                              typefreqs);
+                              typefreqs, cache_id);
    }
    return res;
 }
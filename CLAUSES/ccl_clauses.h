@@ -213,6 +213,8 @@ void ClauseSetTPTPType(Clause_p clause, FormulaProperties type);
 Clause_p ClauseCellAlloc(void);
 Clause_p EmptyClauseAlloc(void);
 Clause_p ClauseAlloc(Eqn_p literals);
+long     ClauseGetAllocCount(void);
+void     ClauseSetAllocCount(long value);
 void     ClauseFree(Clause_p junk);
 void     ClauseRecomputeLitCounts(Clause_p clause);
 
@@ -345,7 +347,8 @@ double ClauseFunWeight(Clause_p clause, double max_term_multiplier,
                        double max_literal_multiplier, double
                        pos_multiplier, long vweight, long flimit,
                        long *fweights, long default_fweight,
-                       double app_var_mult, long* typefreqs);
+                       double app_var_mult, long* typefreqs,
+                       long cache_id);
 
 double ClauseTermExtWeight(Clause_p clause, TermWeightExtension_p twe);
 
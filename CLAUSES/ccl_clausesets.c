@@ -16,6 +16,7 @@
   Run "eprover -h" for contact information.
 
   Created: Sun May 10 03:03:20 MET DST 1998
+  Sat Oct 17 2026: ClauseSetFilterGroundEntailed()
 
   -----------------------------------------------------------------------*/
 
@@ -253,6 +254,36 @@ static void tptp_eq_pred_axiom_print(FILE* out, char* symbol, int arity,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: free_eval_indices()
+//
+//   Free the evaluation heaps of a clause set (but not the
+//   evaluations in them).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void free_eval_indices(PDArray_p indices)
+{
+   long     i;
+   PStack_p heap;
+
+   for(i=0; i<indices->size; i++)
+   {
+      heap = PDArrayElementP(indices, i);
+      if(heap)
+      {
+         PStackFree(heap);
+      }
+   }
+   PDArrayFree(indices);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: clause_set_extract_entry()
@@ -268,7 +299,6 @@ static void tptp_eq_pred_axiom_print(FILE* out, char* symbol, int arity,
 static void clause_set_extract_entry(Clause_p clause)
 {
    int     i;
-   Eval_p *root;
 
    assert(clause);
    assert(clause->set);
@@ -278,10 +308,9 @@ static void clause_set_extract_entry(Clause_p clause)
    {
       for(i=0; i<clause->evaluations->eval_no; i++)
       {
-         root = (void*)&PDArrayElementP(clause->set->eval_indices, i);
          // This may fail (silently) if the clause evaluation was
          // added to a clause already in a set!
-         EvalTreeExtractEntry(root,
+         EvalHeapExtractEntry(PDArrayElementP(clause->set->eval_indices, i),
                               clause->evaluations,
                               i);
       }
@@ -390,7 +419,7 @@ void ClauseSetFree(ClauseSet_p junk)
    {
       FVIAnchorFree(junk->fvindex);
    }
-   PDArrayFree(junk->eval_indices);
+   free_eval_indices(junk->eval_indices);
    ClauseCellFree(junk->anchor);
    DStrFree(junk->identifier);
    ClauseSetCellFree(junk);
@@ -464,11 +493,8 @@ void ClauseSetGCMarkTerms(ClauseSet_p set)
 
 void ClauseSetInsert(ClauseSet_p set, Clause_p newclause)
 {
-   int    i;
-#ifndef NDEBUG
-   Eval_p test;
-#endif
-   Eval_p *root;
+   int      i;
+   PStack_p heap;
 
    assert(!newclause->set);
 
@@ -483,12 +509,13 @@ void ClauseSetInsert(ClauseSet_p set, Clause_p newclause)
    {
       for(i=0; i<newclause->evaluations->eval_no; i++)
       {
-         root = (void*)&(PDArrayElementP(newclause->set->eval_indices,i));
-#ifndef NDEBUG
-         test =
-#endif
-            EvalTreeInsert(root, newclause->evaluations, i);
-         assert(!test);
+         heap = PDArrayElementP(set->eval_indices, i);
+         if(!heap)
+         {
+            heap = PStackAlloc();
+            PDArrayAssignP(set->eval_indices, i, heap);
+         }
+         EvalHeapInsert(heap, newclause->evaluations, i);
       }
       set->eval_no = MAX(newclause->evaluations->eval_no, set->eval_no);
    }
@@ -621,9 +648,10 @@ void ClauseSetIndexedInsertClause(ClauseSet_p set, Clause_p newclause)
 // Function: ClauseSetIndexedInsertClauseSet()
 //
 //   Update the standard weight of all clauses in source and insert
-//   them into set (and the indices of set).
+//   them into set (and the indices of set). The demodulation index
+//   is frozen once at the end if frozen PDTs are enabled.
 //
-// Global Variables:
+// Global Variables: PDTreeUseFrozen
 //
 // Side Effects    :
 //
@@ -639,6 +667,10 @@ void ClauseSetIndexedInsertClauseSet(ClauseSet_p set, ClauseSet_p source)
       handle->weight = ClauseStandardWeight(handle);
       ClauseSetIndexedInsertClause(set, handle);
    }
+   if(set->demod_index && PDTreeUseFrozen)
+   {
+      PDTreeFreeze(set->demod_index);
+   }
 }
 
 
@@ -745,7 +777,7 @@ void ClauseSetDeleteEntry(Clause_p clause)
 //
 // Global Variables: -
 //
-// Side Effects    : Changes clause set
+// Side Effects    : -
 //
 /----------------------------------------------------------------------*/
 
@@ -756,7 +788,7 @@ Clause_p ClauseSetFindBest(ClauseSet_p set, int idx)
 
    /* printf("I: %d", idx); */
    evaluation =
-      EvalTreeFindSmallest(PDArrayElementP(set->eval_indices, idx), idx);
+      EvalHeapFindSmallest(PDArrayElementP(set->eval_indices, idx));
 
    if(!evaluation)
    {
@@ -1435,12 +1467,10 @@ Clause_p ClauseSetFindById(ClauseSet_p set, long ident)
 
 void ClauseSetRemoveEvaluations(ClauseSet_p set)
 {
-   int i;
    Clause_p handle;
-   for(i=0; i<set->eval_indices->size; i++)
-   {
-      PDArrayAssignP(set->eval_indices, i, NULL);
-   }
+
+   free_eval_indices(set->eval_indices);
+   set->eval_indices = PDArrayAlloc(4,4);
    for(handle = set->anchor->succ; handle!=set->anchor;
        handle=handle->succ)
    {
@@ -1527,6 +1557,70 @@ long ClauseSetFilterTautologies(ClauseSet_p set, TB_p work_bank)
    return count;
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetFilterGroundEntailed()
+//
+//   Remove all non-unit clauses with a literal that is entailed by
+//   the ground unit clauses of the set (under congruence closure).
+//   Since the units are ground, this is also sound for literals with
+//   variables (which are just uninterpreted constants for the units).
+//   The resulting set is equivalent to the original one. Return
+//   number of clauses removed.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes set.
+//
+/----------------------------------------------------------------------*/
+
+long ClauseSetFilterGroundEntailed(ClauseSet_p set)
+{
+   Clause_p   handle, next;
+   Eqn_p      lit;
+   GroundCC_p cc;
+   long       units = 0, count = 0;
+
+   assert(set);
+   assert(!set->demod_index);
+
+   cc = GroundCCAlloc();
+   for(handle = set->anchor->succ; handle != set->anchor;
+       handle = handle->succ)
+   {
+      if(ClauseIsUnit(handle) && ClauseIsGround(handle))
+      {
+         GroundCCAssertEqn(cc, handle->literals);
+         units++;
+      }
+   }
+   if(units && !GroundCCInconsistent(cc))
+   {
+      handle = set->anchor->succ;
+      while(handle != set->anchor)
+      {
+         next = handle->succ;
+
+         if(!ClauseIsUnit(handle))
+         {
+            for(lit = handle->literals; lit; lit = lit->next)
+            {
+               if(GroundCCEvalEqn(cc, lit) == GCCTrue)
+               {
+                  ClauseSetDeleteEntry(handle);
+                  count++;
+                  break;
+               }
+            }
+         }
+         handle = next;
+      }
+   }
+   GroundCCFree(cc);
+
+   return count;
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseSetFindMaxStandardWeight()
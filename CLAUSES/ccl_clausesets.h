@@ -123,6 +123,7 @@ Clause_p    ClauseSetFindById(ClauseSet_p set, long ident);
 void        ClauseSetRemoveEvaluations(ClauseSet_p set);
 long        ClauseSetFilterTrivial(ClauseSet_p set);
 long        ClauseSetFilterTautologies(ClauseSet_p set, TB_p work_bank);
+long        ClauseSetFilterGroundEntailed(ClauseSet_p set);
 
 Clause_p    ClauseSetFindMaxStandardWeight(ClauseSet_p set);
 
@@ -18,6 +18,11 @@ Changes
 
 <1> Mon Jul 14 23:20:54 CEST 2003
     New
+<2> Sat Oct 17 2026
+    One index query for all literals in
+    ClauseContextualSimplifyReflect()
+<3> Sat Oct 17 2026
+    Keep the literal order of the per-literal version
 
 -----------------------------------------------------------------------*/
 
@@ -38,6 +43,80 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: context_sr_remove_literal()
+//
+//   Remove handle from clause (which has been simplify-reflected
+//   with subsumer) and document the step.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes clause
+//
+/----------------------------------------------------------------------*/
+
+static void context_sr_remove_literal(Clause_p clause, Eqn_p handle,
+                                      Clause_p subsumer)
+{
+   if(ClauseQueryProp(subsumer, CPIsSOS))
+   {
+      ClauseSetProp(clause, CPIsSOS);
+   }
+   ClauseDelProp(clause, CPInitial|CPLimitedRW);
+   ClauseRemoveLiteral(clause, handle);
+   assert(clause->weight == ClauseStandardWeight(clause));
+   DocClauseModificationDefault(clause,
+                                inf_context_simplify_reflect,
+                                subsumer);
+   ClausePushDerivation(clause, DCContextSR, subsumer, NULL);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_context_sr_single()
+//
+//   Perform contextual simplify-reflect with one subsumption query
+//   per literal. Return number of literals deleted.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes clause
+//
+/----------------------------------------------------------------------*/
+
+static int clause_context_sr_single(ClauseSet_p set, Clause_p clause)
+{
+   Eqn_p handle;
+   int res = 0;
+   Clause_p subsumer;
+   PStack_p lit_stack = ClauseToStack(clause);
+
+   while(!PStackEmpty(lit_stack))
+   {
+      handle = PStackPopP(lit_stack);
+
+      ClauseFlipLiteralSign(clause, handle);
+      ClauseSubsumeOrderSortLits(clause);
+
+      subsumer = ClauseSetSubsumesClause(set, clause);
+
+      if(subsumer)
+      {
+         context_sr_remove_literal(clause, handle, subsumer);
+         res++;
+      }
+      else
+      {
+         ClauseFlipLiteralSign(clause, handle);
+      }
+   }
+   PStackFree(lit_stack);
+   return res;
+}
+
+
 
 
 /*---------------------------------------------------------------------*/
@@ -52,6 +131,15 @@ Changes
 //   Perform contextial-simplify-reflect with all clauses in set on
 //   clause. Return number of literals deleted.
 //
+//   The candidates for all literals are found with a single query
+//   to the feature vector index. This stays sound when literals are
+//   removed on the way, since removing a literal can only decrease
+//   the features of the remaining variants. Only variants with
+//   candidates are tested, but all are sorted as in
+//   clause_context_sr_single(). The sort order is only a
+//   quasi-ordering, so the literal order left in clause depends on
+//   the whole sequence of sorts, and later inferences depend on it.
+//
 // Global Variables: -
 //
 // Side Effects    : Changes clause
@@ -60,42 +148,80 @@ Changes
 
 int ClauseContextualSimplifyReflect(ClauseSet_p set, Clause_p clause)
 {
-   Eqn_p handle;
-   int res = 0;
-   Clause_p subsumer;
-   PStack_p lit_stack = ClauseToStack(clause);
+   Eqn_p        handle;
+   int          res = 0;
+   long         i, j;
+   uint64_t     live = 0, bit;
+   Clause_p     subsumer;
+   FreqVector_p vec;
+   PStack_p     lit_stack, vecs, cands;
 
    clause->weight = ClauseStandardWeight(clause);
 
-   while(!PStackEmpty(lit_stack))
+   if(!set->fvindex || ClauseLiteralNumber(clause) > MULTI_SUBSUMER_MAX)
    {
-      handle = PStackPopP(lit_stack);
+      return clause_context_sr_single(set, clause);
+   }
+   lit_stack = ClauseToStack(clause);
+   vecs      = PStackAlloc();
+   cands     = PStackAlloc();
 
+   for(j=0; j<PStackGetSP(lit_stack); j++)
+   {
+      handle = PStackElementP(lit_stack, j);
       ClauseFlipLiteralSign(clause, handle);
-      ClauseSubsumeOrderSortLits(clause);
+      PStackPushP(vecs,
+                  OptimizedVarFreqVectorCompute(clause,
+                                                set->fvindex->perm_vector,
+                                                set->fvindex->cspec));
+      ClauseFlipLiteralSign(clause, handle);
+   }
+   ClauseSetFindMultiSubsumerCandidates(set, vecs, cands);
+   for(i=1; i<PStackGetSP(cands); i+=2)
+   {
+      live |= (uint64_t)PStackElementInt(cands, i);
+   }
 
-      subsumer = ClauseSetSubsumesClause(set, clause);
+   /* Same order as clause_context_sr_single() */
+   for(j=PStackGetSP(lit_stack)-1; j>=0; j--)
+   {
+      bit = UINT64_C(1)<<j;
+      handle = PStackElementP(lit_stack, j);
+      ClauseFlipLiteralSign(clause, handle);
+      ClauseSubsumeOrderSortLits(clause);
+      if(!(live & bit))
+      {
+         ClauseFlipLiteralSign(clause, handle);
+         continue;
+      }
 
-      if(subsumer)
+      subsumer = NULL;
+      for(i=0; i<PStackGetSP(cands); i+=2)
       {
-         if(ClauseQueryProp(subsumer, CPIsSOS))
+         if(((uint64_t)PStackElementInt(cands, i+1) & bit) &&
+            ClauseSubsumesClause(PStackElementP(cands, i), clause))
          {
-            ClauseSetProp(clause, CPIsSOS);
+            subsumer = PStackElementP(cands, i);
+            break;
          }
-         ClauseDelProp(clause, CPInitial|CPLimitedRW);
-         ClauseRemoveLiteral(clause, handle);
-         assert(clause->weight == ClauseStandardWeight(clause));
-         DocClauseModificationDefault(clause,
-                                      inf_context_simplify_reflect,
-                                      subsumer);
+      }
+      if(subsumer)
+      {
+         context_sr_remove_literal(clause, handle, subsumer);
          res++;
-         ClausePushDerivation(clause, DCContextSR, subsumer, NULL);
       }
       else
       {
          ClauseFlipLiteralSign(clause, handle);
       }
    }
+   while(!PStackEmpty(vecs))
+   {
+      vec = PStackPopP(vecs);
+      FreqVectorFree(vec);
+   }
+   PStackFree(cands);
+   PStackFree(vecs);
    PStackFree(lit_stack);
    return res;
 }
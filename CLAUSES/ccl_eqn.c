@@ -2480,21 +2480,40 @@ double EqnWeight(Eqn_p eq, double max_multiplier, long vweight, long
 //   As EqnWeight(), but use weighted FSum instead of plain term
 //   weight.
 //   Weight of applied variables is multiplied with app_var_mult.
+//   If cache_id is non-zero, the term weights are memoized in
+//   eq->bank under this id (see TBTermFsumWeight()), so the
+//   parameters must be the same for every call with this id.
 //
 // Global Variables:
 //
-// Side Effects    :
+// Side Effects    : Memory operations (for the memo table)
 //
 /----------------------------------------------------------------------*/
 
 double EqnFunWeight(Eqn_p eq, double max_multiplier, long vweight,
                     long flimit, long *fweights, long default_fweight,
-                    double app_var_mult, long* typefreqs)
+                    double app_var_mult, long* typefreqs, long cache_id)
 {
    double res;
+   long   lweight, rweight;
 
-   res = (double)TermFsumWeight(eq->rterm, vweight, flimit, fweights, default_fweight,
-                                typefreqs);
+   if(cache_id)
+   {
+      lweight = TBTermFsumWeight(eq->bank, cache_id, eq->lterm, vweight,
+                                 flimit, fweights, default_fweight,
+                                 typefreqs);
+      rweight = TBTermFsumWeight(eq->bank, cache_id, eq->rterm, vweight,
+                                 flimit, fweights, default_fweight,
+                                 typefreqs);
+   }
+   else
+   {
+      lweight = TermFsumWeight(eq->lterm, vweight, flimit, fweights,
+                               default_fweight, typefreqs);
+      rweight = TermFsumWeight(eq->rterm, vweight, flimit, fweights,
+                               default_fweight, typefreqs);
+   }
+   res = (double)rweight;
    res = TERM_APPLY_APP_VAR_MULT(res, eq->rterm, app_var_mult);
 
    if(!EqnIsOriented(eq))
@@ -2502,8 +2521,7 @@ double EqnFunWeight(Eqn_p eq, double max_multiplier, long vweight,
       res *= max_multiplier;
    }
 
-   res += TERM_APPLY_APP_VAR_MULT((double)TermFsumWeight(eq->lterm, vweight, flimit, fweights,
-                                                            default_fweight, typefreqs) * max_multiplier,
+   res += TERM_APPLY_APP_VAR_MULT((double)lweight * max_multiplier,
                                      eq->lterm, app_var_mult);
 
    return res;
@@ -2848,13 +2866,14 @@ double  LiteralFunWeight(Eqn_p eq,
                          long *fweights,
                          long default_fweight,
                          double app_var_mult,
-                         long* typefreqs)
+                         long* typefreqs,
+                         long cache_id)
 {
    double res;
 
    res = EqnFunWeight(eq, max_term_multiplier, vweight, flimit,
                       fweights, default_fweight, app_var_mult,
-                      typefreqs);
+                      typefreqs, cache_id);
 
    if(EqnIsMaximal(eq))
    {
@@ -307,7 +307,8 @@ double  EqnWeight(Eqn_p eq, double max_multiplier, long vweight, long
 
 double EqnFunWeight(Eqn_p eq, double max_multiplier, long vweight,
                     long flimit, long *fweights, long default_fweight,
-                    double app_var_mult, long* typefreqs);
+                    double app_var_mult, long* typefreqs,
+                    long cache_id);
 
 double  EqnNonLinearWeight(Eqn_p eq, double max_multiplier, long
                            vlweight, long vweight, long fweight,
@@ -343,7 +344,8 @@ double  LiteralFunWeight(Eqn_p eq,
                          long *fweights,
                          long default_fweight,
                          double app_var_mult,
-                         long* typefreqs);
+                         long* typefreqs,
+                         long cache_id);
 
 double  LiteralTermExtWeight(Eqn_p eq, TermWeightExtension_p twe);
 
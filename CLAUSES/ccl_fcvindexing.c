@@ -18,10 +18,17 @@ Changes
 
 <1> Tue Jul  1 13:09:10 CEST 2003
     New
+<2> Fri Oct 16 2026
+    Added column store mode with SIMD candidate filtering
 
 -----------------------------------------------------------------------*/
 
 #include "ccl_fcvindexing.h"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 
 
@@ -57,6 +64,7 @@ FVIndexParmsCell FVIDefaultParameters =
    false,  /* eliminate_uninformative */
    FVINDEX_MAX_FEATURES_DEFAULT,
    FVINDEX_SYMBOL_SLACK_DEFAULT,
+   false,  /* use_columns */
 };
 
 /*---------------------------------------------------------------------*/
@@ -191,6 +199,240 @@ static FVIndex_p insert_empty_node(FVIndex_p node, FVIAnchor_p anchor, long key)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: fvi_saturate()
+//
+//   Return value saturated to 32 bits.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline int32_t fvi_saturate(long value)
+{
+   if(value > INT32_MAX)
+   {
+      return INT32_MAX;
+   }
+   if(value < INT32_MIN)
+   {
+      return INT32_MIN;
+   }
+   return value;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fvi_columns_block_mask()
+//
+//   Return a bit mask of the lanes of block in cols whose feature
+//   vectors are compatible with query (as given by type). Free slots
+//   may be included.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline unsigned fvi_columns_block_mask(FVIColumns_p cols, long block,
+                                              int32_t *query,
+                                              FVICandType type)
+{
+   int32_t  *col = &(cols->values[block*cols->features*FVI_COLUMN_BLOCK]);
+   unsigned mask = (1u<<FVI_COLUMN_BLOCK)-1;
+   long     f;
+
+   for(f=0; mask && (f<cols->features); f++, col+=FVI_COLUMN_BLOCK)
+   {
+#if defined(__AVX2__)
+      __m256i c = _mm256_loadu_si256((__m256i*)col);
+      __m256i q = _mm256_set1_epi32(query[f]);
+      __m256i ok;
+
+      switch(type)
+      {
+      case FVICandSubsumes:
+            ok = _mm256_xor_si256(_mm256_cmpgt_epi32(c, q),
+                                  _mm256_set1_epi32(-1));
+            break;
+      case FVICandSubsumed:
+            ok = _mm256_xor_si256(_mm256_cmpgt_epi32(q, c),
+                                  _mm256_set1_epi32(-1));
+            break;
+      default:
+            ok = _mm256_cmpeq_epi32(c, q);
+            break;
+      }
+      mask &= _mm256_movemask_ps(_mm256_castsi256_ps(ok));
+#elif defined(__SSE2__)
+      __m128i c0 = _mm_loadu_si128((__m128i*)col);
+      __m128i c1 = _mm_loadu_si128((__m128i*)(col+4));
+      __m128i q  = _mm_set1_epi32(query[f]);
+      __m128i bad0, bad1;
+
+      switch(type)
+      {
+      case FVICandSubsumes:
+            bad0 = _mm_cmpgt_epi32(c0, q);
+            bad1 = _mm_cmpgt_epi32(c1, q);
+            break;
+      case FVICandSubsumed:
+            bad0 = _mm_cmpgt_epi32(q, c0);
+            bad1 = _mm_cmpgt_epi32(q, c1);
+            break;
+      default:
+            bad0 = _mm_or_si128(_mm_cmpgt_epi32(c0, q),
+                                _mm_cmpgt_epi32(q, c0));
+            bad1 = _mm_or_si128(_mm_cmpgt_epi32(c1, q),
+                                _mm_cmpgt_epi32(q, c1));
+            break;
+      }
+      mask &= ~(_mm_movemask_ps(_mm_castsi128_ps(bad0))
+                |(_mm_movemask_ps(_mm_castsi128_ps(bad1))<<4));
+#else
+      int i;
+
+      for(i=0; i<FVI_COLUMN_BLOCK; i++)
+      {
+         switch(type)
+         {
+         case FVICandSubsumes:
+               if(col[i] > query[f])
+               {
+                  mask &= ~(1u<<i);
+               }
+               break;
+         case FVICandSubsumed:
+               if(col[i] < query[f])
+               {
+                  mask &= ~(1u<<i);
+               }
+               break;
+         default:
+               if(col[i] != query[f])
+               {
+                  mask &= ~(1u<<i);
+               }
+               break;
+         }
+      }
+#endif
+   }
+   return mask;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fvi_columns_insert()
+//
+//   Insert a FreqVector (with associated clause) into the column
+//   store of anchor.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the index, memory operations.
+//
+/----------------------------------------------------------------------*/
+
+static void fvi_columns_insert(FVIAnchor_p anchor, FreqVector_p vec_clause)
+{
+   FVIColumns_p cols = anchor->columns;
+   long         slot, block, f;
+   int32_t      *col;
+   IntOrP       slot_val, dummy;
+
+   if(cols->features == -1)
+   {
+      cols->features = vec_clause->size;
+   }
+   assert(cols->features == vec_clause->size);
+
+   if(!PStackEmpty(cols->free_slots))
+   {
+      slot = PStackPopInt(cols->free_slots);
+   }
+   else
+   {
+      if(cols->slots == cols->blocks*FVI_COLUMN_BLOCK)
+      {
+         long new_blocks = cols->blocks?2*cols->blocks:1;
+
+         anchor->storage -= cols->blocks*FVI_COLUMN_BLOCK*
+            (cols->features*sizeof(int32_t)+sizeof(Clause_p));
+         cols->values  = SecureRealloc(cols->values,
+                                       new_blocks*FVI_COLUMN_BLOCK*
+                                       (MAX(cols->features,1)*sizeof(int32_t)));
+         cols->clauses = SecureRealloc(cols->clauses,
+                                       new_blocks*FVI_COLUMN_BLOCK*
+                                       sizeof(Clause_p));
+         for(slot=cols->slots; slot<new_blocks*FVI_COLUMN_BLOCK; slot++)
+         {
+            cols->clauses[slot] = NULL;
+         }
+         cols->blocks = new_blocks;
+         anchor->storage += cols->blocks*FVI_COLUMN_BLOCK*
+            (cols->features*sizeof(int32_t)+sizeof(Clause_p));
+      }
+      slot = cols->slots++;
+   }
+   block = slot/FVI_COLUMN_BLOCK;
+   col   = &(cols->values[block*cols->features*FVI_COLUMN_BLOCK
+                          +slot%FVI_COLUMN_BLOCK]);
+   for(f=0; f<cols->features; f++, col+=FVI_COLUMN_BLOCK)
+   {
+      *col = fvi_saturate(vec_clause->array[f]);
+   }
+   cols->clauses[slot] = vec_clause->clause;
+   slot_val.i_val = slot;
+   dummy.i_val    = 0;
+   NumTreeStore(&(cols->slot_map), (long)vec_clause->clause,
+                slot_val, dummy);
+   anchor->storage += NUMTREECELL_MEM;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fvi_columns_delete()
+//
+//   Delete a clause from the column store of anchor. Return true if
+//   the clause was in the index, false otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the index.
+//
+/----------------------------------------------------------------------*/
+
+static bool fvi_columns_delete(FVIAnchor_p anchor, Clause_p clause)
+{
+   FVIColumns_p cols = anchor->columns;
+   NumTree_p    cell;
+   long         slot;
+
+   cell = NumTreeExtractEntry(&(cols->slot_map), (long)clause);
+   if(!cell)
+   {
+      return false;
+   }
+   slot = cell->val1.i_val;
+   NumTreeCellFree(cell);
+   anchor->storage -= NUMTREECELL_MEM;
+
+   assert(cols->clauses[slot] == clause);
+   cols->clauses[slot] = NULL;
+   PStackPushInt(cols->free_slots, slot);
+
+   return true;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -319,12 +561,36 @@ FVIAnchor_p FVIAnchorAlloc(FVCollect_p cspec, PermVector_p perm)
    handle->perm_vector  = perm;
    handle->cspec        = cspec;
    handle->index        = FVIndexAlloc();
+   handle->columns      = NULL;
    handle->storage      = 0;
 
    return handle;
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: FVIAnchorAllocColumns()
+//
+//   Allocate an (empty) FV index that stores the feature vectors in a
+//   column store instead of a trie.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+FVIAnchor_p FVIAnchorAllocColumns(FVCollect_p cspec, PermVector_p perm)
+{
+   FVIAnchor_p handle = FVIAnchorAlloc(cspec, perm);
+
+   handle->columns = FVIColumnsAlloc();
+
+   return handle;
+}
+
+
 
 /*-----------------------------------------------------------------------
 //
@@ -350,6 +616,10 @@ void FVIAnchorFree(FVIAnchor_p junk)
       FVIndexStorage(junk));*/
 
    FVIndexFree(junk->index);
+   if(junk->columns)
+   {
+      FVIColumnsFree(junk->columns);
+   }
    if(junk->perm_vector)
    {
       PermVectorFree(junk->perm_vector);
@@ -410,6 +680,12 @@ void FVIndexInsert(FVIAnchor_p index, FreqVector_p vec_clause)
 
    ClauseSubsumeOrderSortLits(vec_clause->clause);
 
+   if(index->columns)
+   {
+      fvi_columns_insert(index, vec_clause);
+      PERF_CTR_EXIT(FVIndexTimer);
+      return;
+   }
    handle = index->index;
    handle->clause_count++;
 
@@ -456,6 +732,13 @@ bool FVIndexDelete(FVIAnchor_p index, Clause_p clause)
    long i;
    bool res;
 
+   if(index->columns)
+   {
+      PERF_CTR_ENTRY(FVIndexTimer);
+      res = fvi_columns_delete(index, clause);
+      PERF_CTR_EXIT(FVIndexTimer);
+      return res;
+   }
    vec = OptimizedVarFreqVectorCompute(clause, index->perm_vector,
                    index->cspec);
    /* FreqVector-Computation is measured independently */
@@ -554,6 +837,169 @@ FVPackedClause_p FVIndexPackClause(Clause_p clause, FVIAnchor_p anchor)
              anchor->cspec);
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: FVIColumnsAlloc()
+//
+//   Allocate an empty column store.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+FVIColumns_p FVIColumnsAlloc(void)
+{
+   FVIColumns_p handle = FVIColumnsCellAlloc();
+
+   handle->features   = -1;
+   handle->slots      = 0;
+   handle->blocks     = 0;
+   handle->values     = NULL;
+   handle->clauses    = NULL;
+   handle->free_slots = PStackAlloc();
+   handle->slot_map   = NULL;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: FVIColumnsFree()
+//
+//   Free a column store (but not the clauses).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void FVIColumnsFree(FVIColumns_p junk)
+{
+   assert(junk);
+
+   if(junk->values)
+   {
+      FREE(junk->values);
+   }
+   if(junk->clauses)
+   {
+      FREE(junk->clauses);
+   }
+   PStackFree(junk->free_slots);
+   NumTreeFree(junk->slot_map);
+   FVIColumnsCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: FVIColumnsIterAlloc()
+//
+//   Return an iterator over all clauses in cols whose feature vectors
+//   are compatible with query (as described by type).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+FVIColumnsIter_p FVIColumnsIterAlloc(FVIColumns_p cols, FreqVector_p query,
+                                     FVICandType type)
+{
+   FVIColumnsIter_p handle = FVIColumnsIterCellAlloc();
+   long i;
+
+   handle->cols  = cols;
+   handle->type  = type;
+   handle->block = -1;
+   handle->lane  = 0;
+   handle->mask  = 0;
+   handle->query = NULL;
+   if(cols->features == -1)
+   {
+      /* Empty store */
+      handle->block = cols->blocks;
+   }
+   else
+   {
+      assert(query->size == cols->features);
+      handle->query = SizeMalloc(MAX(query->size,1)*sizeof(int32_t));
+      for(i=0; i<query->size; i++)
+      {
+         handle->query[i] = fvi_saturate(query->array[i]);
+      }
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: FVIColumnsIterNext()
+//
+//   Return the next candidate clause, or NULL if there is none.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes iter
+//
+/----------------------------------------------------------------------*/
+
+Clause_p FVIColumnsIterNext(FVIColumnsIter_p iter)
+{
+   FVIColumns_p cols = iter->cols;
+   Clause_p     res;
+
+   while(true)
+   {
+      while(!iter->mask)
+      {
+         iter->block++;
+         if(iter->block*FVI_COLUMN_BLOCK >= cols->slots)
+         {
+            return NULL;
+         }
+         iter->mask = fvi_columns_block_mask(cols, iter->block,
+                                             iter->query, iter->type);
+      }
+      iter->lane = __builtin_ctz(iter->mask);
+      iter->mask &= iter->mask-1;
+      res = cols->clauses[iter->block*FVI_COLUMN_BLOCK+iter->lane];
+      if(res)
+      {
+         return res;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: FVIColumnsIterFree()
+//
+//   Free an iterator.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void FVIColumnsIterFree(FVIColumnsIter_p junk)
+{
+   if(junk->query)
+   {
+      SizeFree(junk->query, MAX(junk->cols->features,1)*sizeof(int32_t));
+   }
+   FVIColumnsIterCellFree(junk);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: FVIndexPrint()
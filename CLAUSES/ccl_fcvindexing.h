@@ -21,6 +21,10 @@ Changes
     New
 <2> Sun Feb  6 02:16:41 CET 2005 (actually 2 weeks or so earlier)
     Switched to IntMap
+<3> Fri Oct 16 2026
+    Added column store mode
+<4> Sat Oct 17 2026
+    FVIColumnsIterValue()
 
 -----------------------------------------------------------------------*/
 
@@ -46,6 +50,7 @@ typedef struct fvindex_parms_cell
    bool eliminate_uninformative;
    long max_symbols;
    long symbol_slack;
+   bool use_columns;
 }FVIndexParmsCell, *FVIndexParms_p;
 
 
@@ -61,11 +66,50 @@ typedef struct fv_index_cell
    }u1;
 }FVIndexCell, *FVIndex_p;
 
+/* Alternative to the trie: The feature vectors of FVI_COLUMN_BLOCK
+   clauses are stored in a block, within which the values for each
+   feature are contiguous (column-major), so that one feature of all
+   clauses of a block can be compared with a single (SIMD)
+   instruction. Values are saturated to 32 bits, which keeps the
+   filter sound (saturation is monotonic). Slots of deleted clauses
+   have a NULL clause and are reused. */
+
+#define FVI_COLUMN_BLOCK 8
+
+typedef enum
+{
+   FVICandSubsumes,  /* Stored vector <= query (forward subsumption) */
+   FVICandSubsumed,  /* Stored vector >= query (backward subsumption) */
+   FVICandVariant    /* Stored vector == query */
+}FVICandType;
+
+typedef struct fvi_columns_cell
+{
+   long      features;   /* Length of vectors, -1 if not yet known */
+   long      slots;      /* Used slots (including free ones) */
+   long      blocks;     /* Allocated blocks */
+   int32_t   *values;    /* blocks*features*FVI_COLUMN_BLOCK */
+   Clause_p  *clauses;   /* blocks*FVI_COLUMN_BLOCK, NULL if free */
+   PStack_p  free_slots;
+   NumTree_p slot_map;   /* Clause address -> slot */
+}FVIColumnsCell, *FVIColumns_p;
+
+typedef struct fvi_columns_iter_cell
+{
+   FVIColumns_p cols;
+   FVICandType  type;
+   long         block;   /* Current block */
+   int          lane;    /* Lane of the last candidate returned */
+   unsigned     mask;    /* Candidate lanes left in block */
+   int32_t      *query;  /* Saturated query vector */
+}FVIColumnsIterCell, *FVIColumnsIter_p;
+
 typedef struct fvi_anchor_cell
 {
    FVCollect_p  cspec;
    PermVector_p perm_vector;
    FVIndex_p    index;
+   FVIColumns_p columns; /* If not NULL, used instead of index */
    long         storage;
 }FVIAnchorCell, *FVIAnchor_p;
 
@@ -93,8 +137,25 @@ void      FVIndexFree(FVIndex_p junk);
 #define FVIAnchorCellFree(junk) SizeFree(junk, sizeof(FVIAnchorCell))
 
 FVIAnchor_p FVIAnchorAlloc(FVCollect_p cspec, PermVector_p perm);
+FVIAnchor_p FVIAnchorAllocColumns(FVCollect_p cspec, PermVector_p perm);
 void        FVIAnchorFree(FVIAnchor_p junk);
 
+#define FVIColumnsCellAlloc()    (FVIColumnsCell*)SizeMalloc(sizeof(FVIColumnsCell))
+#define FVIColumnsCellFree(junk) SizeFree(junk, sizeof(FVIColumnsCell))
+#define FVIColumnsIterCellAlloc()    (FVIColumnsIterCell*)SizeMalloc(sizeof(FVIColumnsIterCell))
+#define FVIColumnsIterCellFree(junk) SizeFree(junk, sizeof(FVIColumnsIterCell))
+
+FVIColumns_p     FVIColumnsAlloc(void);
+void             FVIColumnsFree(FVIColumns_p junk);
+FVIColumnsIter_p FVIColumnsIterAlloc(FVIColumns_p cols, FreqVector_p query,
+                                     FVICandType type);
+Clause_p         FVIColumnsIterNext(FVIColumnsIter_p iter);
+/* Stored (saturated) value of feature f of the last candidate */
+#define FVIColumnsIterValue(iter, f)                                    \
+   ((iter)->cols->values[((iter)->block*(iter)->cols->features+(f))*    \
+                         FVI_COLUMN_BLOCK+(iter)->lane])
+void             FVIColumnsIterFree(FVIColumnsIter_p junk);
+
 #ifdef CONSTANT_MEM_ESTIMATE
 #define FVINDEX_MEM 16
 #else
@@ -18,6 +18,8 @@ Changes
 
 <1> Sat Mar 20 09:55:09 CET 2010
     New
+<2> Sat Oct 17 2026
+    Support stacks of terms as roots
 
 -----------------------------------------------------------------------*/
 
@@ -66,6 +68,7 @@ GCAdmin_p GCAdminAlloc(TB_p bank)
    handle->bank         = bank;
    handle->clause_sets  = NULL;
    handle->formula_sets = NULL;
+   handle->term_stacks  = NULL;
    bank->gc             = handle;
 
    return handle;
@@ -90,6 +93,7 @@ void GCAdminFree(GCAdmin_p junk)
 
    PTreeFree(junk->clause_sets);
    PTreeFree(junk->formula_sets);
+   PTreeFree(junk->term_stacks);
 
    GCAdminCellFree(junk);
 }
@@ -173,6 +177,46 @@ void GCDeregisterClauseSet(GCAdmin_p gc, ClauseSet_p set)
    PTreeDeleteEntry(&(gc->clause_sets), set);
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: GCRegisterTermStack()
+//
+//   Register a stack of terms (from gc->bank) as relevant terms.
+//
+// Global Variables: -
+//
+// Side Effects    : Via PTReeStore()
+//
+/----------------------------------------------------------------------*/
+
+void GCRegisterTermStack(GCAdmin_p gc, PStack_p stack)
+{
+   assert(gc);
+   assert(stack);
+   PTreeStore(&(gc->term_stacks), stack);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GCDeregisterTermStack()
+//
+//   Unregister a stack of terms.
+//
+// Global Variables: -
+//
+// Side Effects    : Via PTreeDeleteEntry()
+//
+/----------------------------------------------------------------------*/
+
+void GCDeregisterTermStack(GCAdmin_p gc, PStack_p stack)
+{
+   assert(gc);
+   assert(stack);
+   PTreeDeleteEntry(&(gc->term_stacks), stack);
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: GCCollect()
@@ -188,7 +232,8 @@ void GCDeregisterClauseSet(GCAdmin_p gc, ClauseSet_p set)
 long GCCollect(GCAdmin_p gc)
 {
    PTree_p entry;
-   PStack_p trav;
+   PStack_p trav, stack;
+   PStackPointer i;
 
    assert(gc);
    assert(gc->bank);
@@ -207,6 +252,17 @@ long GCCollect(GCAdmin_p gc)
    }
    PTreeTraverseExit(trav);
 
+   trav = PTreeTraverseInit(gc->term_stacks);
+   while((entry = PTreeTraverseNext(trav)))
+   {
+      stack = entry->key;
+      for(i=0; i<PStackGetSP(stack); i++)
+      {
+         TBGCMarkTerm(gc->bank, PStackElementP(stack, i));
+      }
+   }
+   PTreeTraverseExit(trav);
+
    return TBGCSweep(gc->bank);
 }
 
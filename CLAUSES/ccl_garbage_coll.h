@@ -42,6 +42,7 @@ typedef struct gc_admin_cell
    TB_p    bank;
    PTree_p clause_sets;
    PTree_p formula_sets;
+   PTree_p term_stacks;
 }GCAdminCell, *GCAdmin_p;
 
 
@@ -58,6 +59,8 @@ void      GCRegisterFormulaSet(GCAdmin_p gc, FormulaSet_p set);
 void      GCRegisterClauseSet(GCAdmin_p gc, ClauseSet_p set);
 void      GCDeregisterFormulaSet(GCAdmin_p gc, FormulaSet_p set);
 void      GCDeregisterClauseSet(GCAdmin_p gc, ClauseSet_p set);
+void      GCRegisterTermStack(GCAdmin_p gc, PStack_p stack);
+void      GCDeregisterTermStack(GCAdmin_p gc, PStack_p stack);
 
 long      GCCollect(GCAdmin_p gc);
 
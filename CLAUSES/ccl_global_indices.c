@@ -18,6 +18,8 @@ Changes
 
 <1> Fri May  7 21:19:48 CEST 2010
     New
+<2> Sat Oct 17 2026
+    Maintain clause_count, call change_hook.
 
 -----------------------------------------------------------------------*/
 
@@ -66,6 +68,8 @@ void GlobalIndicesNull(GlobalIndices_p indices)
    indices->pm_into_index = NULL;
    indices->pm_negp_index = NULL;
    indices->pm_from_index = NULL;
+   indices->clause_count  = 0;
+   indices->change_hook   = NULL;
 }
 
 
@@ -92,6 +96,7 @@ void GlobalIndicesInit(GlobalIndices_p indices,
    // fprintf(GlobalOut, "# GlobalIndicesInit(%p, <>, %s, %s, %s)\n", indices, rw_bw_index_type, pm_from_index_type, pm_into_index_type);
 
    indices->sig = sig;
+   indices->clause_count = 0;
    indexfun = GetFPIndexFunction(rw_bw_index_type);
    strcpy(indices->rw_bw_index_type, rw_bw_index_type);
    if(indexfun)
@@ -123,16 +128,22 @@ void GlobalIndicesInit(GlobalIndices_p indices,
 //
 // Function: GlobalIndicesFreeIndices()
 //
-//   Free the existing indices.
+//   Free the existing indices. An installed change hook is notified
+//   and removed.
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations
+// Side Effects    : Memory operations, calls the change hook
 //
 /----------------------------------------------------------------------*/
 
 void GlobalIndicesFreeIndices(GlobalIndices_p indices)
 {
+   if(indices->change_hook)
+   {
+      indices->change_hook(NULL, false);
+      indices->change_hook = NULL;
+   }
    if(indices->bw_rw_index)
    {
       FPIndexFree(indices->bw_rw_index);
@@ -188,7 +199,7 @@ void GlobalIndicesReset(GlobalIndices_p indices)
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations
+// Side Effects    : Memory operations, calls the change hook
 //
 /----------------------------------------------------------------------*/
 
@@ -222,6 +233,11 @@ void GlobalIndicesInsertClause(GlobalIndices_p indices, Clause_p clause)
       OverlapIndexInsertFromClause(indices->pm_from_index, clause);
       PERF_CTR_EXIT(PMIndexTimer);
    }
+   indices->clause_count++;
+   if(indices->change_hook)
+   {
+      indices->change_hook(clause, true);
+   }
 }
 
 
@@ -234,7 +250,7 @@ void GlobalIndicesInsertClause(GlobalIndices_p indices, Clause_p clause)
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations
+// Side Effects    : Memory operations, calls the change hook
 //
 /----------------------------------------------------------------------*/
 
@@ -268,6 +284,11 @@ void GlobalIndicesDeleteClause(GlobalIndices_p indices, Clause_p clause)
       OverlapIndexDeleteFromClause(indices->pm_from_index, clause);
       PERF_CTR_EXIT(PMIndexTimer);
    }
+   indices->clause_count--;
+   if(indices->change_hook)
+   {
+      indices->change_hook(clause, false);
+   }
    // printf("# ...GlobalIndicesDeleteClause()\n");
 }
 
@@ -18,6 +18,8 @@ Changes
 
 <1> Fri May  7 21:13:39 CEST 2010
     New
+<2> Sat Oct 17 2026
+    Clause count and change hook.
 
 -----------------------------------------------------------------------*/
 
@@ -34,6 +36,11 @@ Changes
 /*                    Data type declarations                           */
 /*---------------------------------------------------------------------*/
 
+/* Called after a clause has been inserted into (insert is true) or
+   deleted from the indices, and with clause NULL before the indices
+   are freed. */
+
+typedef void (*GlobalIndicesHook)(Clause_p clause, bool insert);
 
 typedef struct global_indices_cell
 {
@@ -46,6 +53,8 @@ typedef struct global_indices_cell
    OverlapIndex_p    pm_from_index;
    OverlapIndex_p    pm_into_index;
    OverlapIndex_p    pm_negp_index;
+   long              clause_count; /* Clauses in the indices */
+   GlobalIndicesHook change_hook;  /* Optional, see above */
 }GlobalIndices, *GlobalIndices_p;
 
 
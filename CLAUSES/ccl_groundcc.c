@@ -0,0 +1,728 @@
+/*-----------------------------------------------------------------------
+
+  File  : ccl_groundcc.c
+
+  Author: agent (agent@local)
+
+  Contents
+
+  Congruence closure over shared terms.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Changes
+
+  <1> Sat Oct 17 2026
+      New
+
+  -----------------------------------------------------------------------*/
+
+#include "ccl_groundcc.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+#define GCC_HASH_MULT 0x9e3779b97f4a7c15UL
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_find()
+//
+//   Return the representative of the class of node (with path
+//   halving).
+//
+// Global Variables: -
+//
+// Side Effects    : Shortens paths
+//
+/----------------------------------------------------------------------*/
+
+static inline GCCNode_p gcc_find(GCCNode_p node)
+{
+   while(node->find != node)
+   {
+      node->find = node->find->find;
+      node = node->find;
+   }
+   return node;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_table_alloc()
+//
+//   Return an empty hash table with size entries.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static GCCNode_p* gcc_table_alloc(long size)
+{
+   GCCNode_p *res = SecureMalloc(size*sizeof(GCCNode_p));
+
+   memset(res, 0, size*sizeof(GCCNode_p));
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_term_slot()
+//
+//   Return the slot of term in the term table (which is empty if the
+//   term has no node yet).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static GCCNode_p* gcc_term_slot(GroundCC_p cc, Term_p term)
+{
+   unsigned long i, mask = cc->term_size-1;
+
+   i = ((unsigned long)term*GCC_HASH_MULT);
+   i = (i^(i>>32))&mask;
+   while(cc->term_table[i] && cc->term_table[i]->term != term)
+   {
+      i = (i+1)&mask;
+   }
+   return &(cc->term_table[i]);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_term_table_grow()
+//
+//   Double the size of the term table.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_term_table_grow(GroundCC_p cc)
+{
+   PStackPointer i;
+   GCCNode_p     node;
+
+   FREE(cc->term_table);
+   cc->term_size *= 2;
+   cc->term_table = gcc_table_alloc(cc->term_size);
+   for(i=0; i<PStackGetSP(cc->nodes); i++)
+   {
+      node = PStackElementP(cc->nodes, i);
+      *gcc_term_slot(cc, node->term) = node;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_sig_equal()
+//
+//   Return true if the two nodes have the same signature, i.e. the
+//   same top symbol and congruent arguments.
+//
+// Global Variables: -
+//
+// Side Effects    : Shortens paths
+//
+/----------------------------------------------------------------------*/
+
+static bool gcc_sig_equal(GCCNode_p n1, GCCNode_p n2)
+{
+   int i;
+
+   if(n1->term->f_code != n2->term->f_code ||
+      n1->term->arity != n2->term->arity)
+   {
+      return false;
+   }
+   for(i=0; i<n1->term->arity; i++)
+   {
+      if(gcc_find(n1->args[i]) != gcc_find(n2->args[i]))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_sig_slot()
+//
+//   Return the slot of a node with the same signature as node, but
+//   different from it, in the signature table. If there is none,
+//   return the empty slot where node belongs. Entries for node itself
+//   are skipped, since they may be stale.
+//
+// Global Variables: -
+//
+// Side Effects    : Shortens paths
+//
+/----------------------------------------------------------------------*/
+
+static GCCNode_p* gcc_sig_slot(GroundCC_p cc, GCCNode_p node)
+{
+   unsigned long i, mask = cc->sig_size-1;
+   GCCNode_p     entry;
+   int           j;
+
+   i = (unsigned long)node->term->f_code*GCC_HASH_MULT;
+   for(j=0; j<node->term->arity; j++)
+   {
+      i = (i^gcc_find(node->args[j])->ident)*GCC_HASH_MULT;
+   }
+   i = (i^(i>>32))&mask;
+   while((entry = cc->sig_table[i]))
+   {
+      if(entry != node && gcc_sig_equal(entry, node))
+      {
+         break;
+      }
+      i = (i+1)&mask;
+   }
+   return &(cc->sig_table[i]);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_sig_insert()
+//
+//   Enter node into the signature table under its current
+//   signature. If a node with the same signature is already there,
+//   schedule the two for merging instead.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the table, may push to cc->pending
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_sig_insert(GroundCC_p cc, GCCNode_p node)
+{
+   GCCNode_p *slot = gcc_sig_slot(cc, node);
+
+   if(*slot)
+   {
+      if(gcc_find(*slot) != gcc_find(node))
+      {
+         PStackPushP(cc->pending, node);
+         PStackPushP(cc->pending, *slot);
+      }
+   }
+   else
+   {
+      *slot = node;
+      cc->sig_no++;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_sig_table_rebuild()
+//
+//   Rebuild the signature table with size entries from the current
+//   signatures of all nodes (dropping stale entries).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, may push to cc->pending
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_sig_table_rebuild(GroundCC_p cc, long size)
+{
+   PStackPointer i;
+   GCCNode_p     node;
+
+   FREE(cc->sig_table);
+   cc->sig_size  = size;
+   cc->sig_no    = 0;
+   cc->sig_table = gcc_table_alloc(size);
+   for(i=0; i<PStackGetSP(cc->nodes); i++)
+   {
+      node = PStackElementP(cc->nodes, i);
+      if(node->term->arity)
+      {
+         gcc_sig_insert(cc, node);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_add_use()
+//
+//   Note that node has an argument in the class of rep.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_add_use(GCCNode_p rep, GCCNode_p node)
+{
+   if(!rep->uses)
+   {
+      rep->uses = PStackAlloc();
+   }
+   PStackPushP(rep->uses, node);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_move_stack()
+//
+//   Move the elements of *from to *to, free *from and set it to NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_move_stack(PStack_p *to, PStack_p *from)
+{
+   if(!*from)
+   {
+      return;
+   }
+   if(!*to)
+   {
+      *to = *from;
+   }
+   else
+   {
+      PStackPushStack(*to, *from);
+      PStackFree(*from);
+   }
+   *from = NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gcc_propagate()
+//
+//   Perform all pending merges and the merges of congruent terms they
+//   imply. The smaller class is always merged into the larger one,
+//   and only the superterms of the smaller class need to be checked
+//   for new congruences.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the partition
+//
+/----------------------------------------------------------------------*/
+
+static void gcc_propagate(GroundCC_p cc)
+{
+   GCCNode_p     a, b;
+   PStackPointer i;
+   long          size;
+
+   while(!PStackEmpty(cc->pending))
+   {
+      b = gcc_find(PStackPopP(cc->pending));
+      a = gcc_find(PStackPopP(cc->pending));
+      if(a == b)
+      {
+         continue;
+      }
+      if(a->size > b->size)
+      {
+         SWAP(a, b);
+      }
+      if(a->diseqs)
+      {
+         for(i=0; i<PStackGetSP(a->diseqs); i++)
+         {
+            if(gcc_find(PStackElementP(a->diseqs, i)) == b)
+            {
+               cc->inconsistent = true;
+            }
+         }
+      }
+      a->find  = b;
+      b->size += a->size;
+      gcc_move_stack(&(b->diseqs), &(a->diseqs));
+      if(a->uses)
+      {
+         size = cc->sig_size;
+         while((cc->sig_no+PStackGetSP(a->uses))*2 > size)
+         {
+            size *= 2;
+         }
+         if(size > cc->sig_size)
+         {
+            gcc_sig_table_rebuild(cc, size);
+         }
+         for(i=0; i<PStackGetSP(a->uses); i++)
+         {
+            gcc_sig_insert(cc, PStackElementP(a->uses, i));
+         }
+         gcc_move_stack(&(b->uses), &(a->uses));
+      }
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCAlloc()
+//
+//   Return an empty congruence closure.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+GroundCC_p GroundCCAlloc(void)
+{
+   GroundCC_p handle = GroundCCCellAlloc();
+
+   handle->nodes        = PStackAlloc();
+   handle->term_size    = GCC_INIT_TABLE_SIZE;
+   handle->term_no      = 0;
+   handle->term_table   = gcc_table_alloc(GCC_INIT_TABLE_SIZE);
+   handle->sig_size     = GCC_INIT_TABLE_SIZE;
+   handle->sig_no       = 0;
+   handle->sig_table    = gcc_table_alloc(GCC_INIT_TABLE_SIZE);
+   handle->pending      = PStackAlloc();
+   handle->inconsistent = false;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCFree()
+//
+//   Free a congruence closure (but not the terms).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void GroundCCFree(GroundCC_p junk)
+{
+   GCCNode_p node;
+
+   while(!PStackEmpty(junk->nodes))
+   {
+      node = PStackPopP(junk->nodes);
+      if(node->args)
+      {
+         SizeFree(node->args, node->term->arity*sizeof(GCCNode_p));
+      }
+      if(node->uses)
+      {
+         PStackFree(node->uses);
+      }
+      if(node->diseqs)
+      {
+         PStackFree(node->diseqs);
+      }
+      GCCNodeCellFree(node);
+   }
+   PStackFree(junk->nodes);
+   FREE(junk->term_table);
+   FREE(junk->sig_table);
+   PStackFree(junk->pending);
+   GroundCCCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCTermNode()
+//
+//   Return the node of term, adding it (and its subterms) if
+//   necessary. A new term may be congruent to an existing one, in
+//   which case the classes are merged.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, may change the partition
+//
+/----------------------------------------------------------------------*/
+
+GCCNode_p GroundCCTermNode(GroundCC_p cc, Term_p term)
+{
+   GCCNode_p node, *slot;
+   int       i;
+
+   slot = gcc_term_slot(cc, term);
+   if(*slot)
+   {
+      return *slot;
+   }
+   node = GCCNodeCellAlloc();
+   node->term   = term;
+   node->find   = node;
+   node->args   = NULL;
+   node->size   = 1;
+   node->uses   = NULL;
+   node->diseqs = NULL;
+   if(term->arity)
+   {
+      node->args = SizeMalloc(term->arity*sizeof(GCCNode_p));
+      for(i=0; i<term->arity; i++)
+      {
+         node->args[i] = GroundCCTermNode(cc, term->args[i]);
+      }
+   }
+   node->ident = PStackGetSP(cc->nodes);
+   PStackPushP(cc->nodes, node);
+
+   /* Subterms may have grown the table */
+   if((cc->term_no+1)*2 > cc->term_size)
+   {
+      gcc_term_table_grow(cc);
+   }
+   else
+   {
+      *gcc_term_slot(cc, term) = node;
+   }
+   cc->term_no++;
+
+   if(term->arity)
+   {
+      for(i=0; i<term->arity; i++)
+      {
+         gcc_add_use(gcc_find(node->args[i]), node);
+      }
+      if((cc->sig_no+1)*2 > cc->sig_size)
+      {
+         gcc_sig_table_rebuild(cc, 2*cc->sig_size);
+      }
+      gcc_sig_insert(cc, node);
+      gcc_propagate(cc);
+   }
+   return node;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCAssertEqual()
+//
+//   Add the equation s=t. Return false if this makes the state
+//   inconsistent.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the partition
+//
+/----------------------------------------------------------------------*/
+
+bool GroundCCAssertEqual(GroundCC_p cc, Term_p s, Term_p t)
+{
+   GCCNode_p ns = GroundCCTermNode(cc, s),
+      nt = GroundCCTermNode(cc, t);
+
+   PStackPushP(cc->pending, ns);
+   PStackPushP(cc->pending, nt);
+   gcc_propagate(cc);
+
+   return !cc->inconsistent;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCAssertDisequal()
+//
+//   Add the disequation s!=t. Return false if this makes the state
+//   inconsistent.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+bool GroundCCAssertDisequal(GroundCC_p cc, Term_p s, Term_p t)
+{
+   GCCNode_p ns = GroundCCTermNode(cc, s),
+      nt = GroundCCTermNode(cc, t),
+      rs = gcc_find(ns),
+      rt = gcc_find(nt);
+
+   if(rs == rt)
+   {
+      cc->inconsistent = true;
+   }
+   else
+   {
+      if(!rs->diseqs)
+      {
+         rs->diseqs = PStackAlloc();
+      }
+      if(!rt->diseqs)
+      {
+         rt->diseqs = PStackAlloc();
+      }
+      PStackPushP(rs->diseqs, nt);
+      PStackPushP(rt->diseqs, ns);
+   }
+   return !cc->inconsistent;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCEqual()
+//
+//   Return true if s=t follows from the asserted equations.
+//
+// Global Variables: -
+//
+// Side Effects    : May add nodes for s and t
+//
+/----------------------------------------------------------------------*/
+
+bool GroundCCEqual(GroundCC_p cc, Term_p s, Term_p t)
+{
+   GCCNode_p ns = GroundCCTermNode(cc, s),
+      nt = GroundCCTermNode(cc, t);
+
+   return gcc_find(ns) == gcc_find(nt);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCDisequal()
+//
+//   Return true if s!=t follows from the asserted (dis-)equations
+//   because an asserted disequation holds between the classes of s
+//   and t.
+//
+// Global Variables: -
+//
+// Side Effects    : May add nodes for s and t
+//
+/----------------------------------------------------------------------*/
+
+bool GroundCCDisequal(GroundCC_p cc, Term_p s, Term_p t)
+{
+   GCCNode_p     rs = gcc_find(GroundCCTermNode(cc, s)),
+      rt = gcc_find(GroundCCTermNode(cc, t));
+   PStackPointer i;
+
+   if(rs == rt || !rs->diseqs || !rt->diseqs)
+   {
+      return false;
+   }
+   if(PStackGetSP(rs->diseqs) > PStackGetSP(rt->diseqs))
+   {
+      SWAP(rs, rt);
+   }
+   for(i=0; i<PStackGetSP(rs->diseqs); i++)
+   {
+      if(gcc_find(PStackElementP(rs->diseqs, i)) == rt)
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCAssertEqn()
+//
+//   Add the equation or disequation represented by the literal
+//   eqn. Return false if this makes the state inconsistent.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the partition
+//
+/----------------------------------------------------------------------*/
+
+bool GroundCCAssertEqn(GroundCC_p cc, Eqn_p eqn)
+{
+   if(EqnIsPositive(eqn))
+   {
+      return GroundCCAssertEqual(cc, eqn->lterm, eqn->rterm);
+   }
+   return GroundCCAssertDisequal(cc, eqn->lterm, eqn->rterm);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GroundCCEvalEqn()
+//
+//   Return GCCTrue if the literal is entailed by the asserted
+//   (dis-)equations, GCCFalse if its negation is, GCCUnknown
+//   otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : May add nodes for the terms of eqn
+//
+/----------------------------------------------------------------------*/
+
+GCCValue GroundCCEvalEqn(GroundCC_p cc, Eqn_p eqn)
+{
+   if(GroundCCEqual(cc, eqn->lterm, eqn->rterm))
+   {
+      return EqnIsPositive(eqn)?GCCTrue:GCCFalse;
+   }
+   if(GroundCCDisequal(cc, eqn->lterm, eqn->rterm))
+   {
+      return EqnIsPositive(eqn)?GCCFalse:GCCTrue;
+   }
+   return GCCUnknown;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
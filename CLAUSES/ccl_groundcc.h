@@ -0,0 +1,116 @@
+/*-----------------------------------------------------------------------
+
+  File  : ccl_groundcc.h
+
+  Author: agent (agent@local)
+
+  Contents
+
+  Congruence closure over shared terms. Terms are treated as ground
+  (variables are just constants), nodes are identified by the shared
+  term cells, so hash-consing comes for free from the term bank. The
+  structure maintains a union-find partition of all terms seen so far
+  that is closed under congruence, plus a set of disequations between
+  classes. It can answer whether an equation or disequation is
+  entailed by the asserted (dis-)equations in (amortized) almost
+  constant time.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Changes
+
+  <1> Sat Oct 17 2026
+      New
+
+  -----------------------------------------------------------------------*/
+
+#ifndef CCL_GROUNDCC
+
+#define CCL_GROUNDCC
+
+#include <ccl_clauses.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define GCC_INIT_TABLE_SIZE 64 /* Must be a power of 2 */
+
+/* Nodes represent (shared) terms. Only representatives (find ==
+   self) carry valid size, uses and diseqs. */
+
+typedef struct gcc_node_cell
+{
+   Term_p               term;
+   long                 ident;  /* Running number, for hashing */
+   struct gcc_node_cell *find;  /* Union-find parent */
+   struct gcc_node_cell **args; /* Nodes of the argument terms */
+   long                 size;   /* Number of nodes in the class */
+   PStack_p             uses;   /* Nodes with an argument in the class */
+   PStack_p             diseqs; /* Nodes known to be different from
+                                   the class */
+}GCCNodeCell, *GCCNode_p;
+
+/* Both tables use open addressing with linear probing. The signature
+   table may contain stale entries for nodes whose signature has
+   changed since they have been inserted. They are harmless (lookups
+   compare current signatures), and are dropped when the table is
+   rebuilt. */
+
+typedef struct ground_cc_cell
+{
+   PStack_p  nodes;        /* All nodes, in order of creation */
+   long      term_size;
+   long      term_no;
+   GCCNode_p *term_table;  /* Term -> node */
+   long      sig_size;
+   long      sig_no;
+   GCCNode_p *sig_table;   /* Signature -> node */
+   PStack_p  pending;      /* Pairs of nodes to be merged */
+   bool      inconsistent; /* Some disequation has been violated */
+}GroundCCCell, *GroundCC_p;
+
+typedef enum
+{
+   GCCUnknown,
+   GCCTrue,
+   GCCFalse
+}GCCValue;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define GCCNodeCellAlloc()    (GCCNodeCell*)SizeMalloc(sizeof(GCCNodeCell))
+#define GCCNodeCellFree(junk) SizeFree(junk, sizeof(GCCNodeCell))
+
+#define GroundCCCellAlloc()    (GroundCCCell*)SizeMalloc(sizeof(GroundCCCell))
+#define GroundCCCellFree(junk) SizeFree(junk, sizeof(GroundCCCell))
+
+#define GroundCCInconsistent(cc) ((cc)->inconsistent)
+#define GroundCCNodeNumber(cc)   PStackGetSP((cc)->nodes)
+
+GroundCC_p GroundCCAlloc(void);
+void       GroundCCFree(GroundCC_p junk);
+
+GCCNode_p  GroundCCTermNode(GroundCC_p cc, Term_p term);
+
+bool       GroundCCAssertEqual(GroundCC_p cc, Term_p s, Term_p t);
+bool       GroundCCAssertDisequal(GroundCC_p cc, Term_p s, Term_p t);
+bool       GroundCCEqual(GroundCC_p cc, Term_p s, Term_p t);
+bool       GroundCCDisequal(GroundCC_p cc, Term_p s, Term_p t);
+
+bool       GroundCCAssertEqn(GroundCC_p cc, Eqn_p eqn);
+GCCValue   GroundCCEvalEqn(GroundCC_p cc, Eqn_p eqn);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -18,6 +18,8 @@ Changes
 
 <1> Tue May 16 23:08:03 CEST 2006
     New (adapted ccl_evaluations.c)
+<2> Sat Oct 17 2026
+    Replaced splay trees with indexed binary heaps
 
 -----------------------------------------------------------------------*/
 
@@ -54,9 +56,14 @@ long EvaluationCounter = 0;
 static Eval_p evals_alloc_raw(int eval_no)
 {
    Eval_p eval = EvalCellAlloc(eval_no);
+   int    i;
 
    eval->eval_no    = eval_no;
    eval->eval_count = 0;
+   for(i=0; i<eval_no; i++)
+   {
+      eval->evals[i].heap_pos = -1;
+   }
 
    return eval;
 }
@@ -64,93 +71,102 @@ static Eval_p evals_alloc_raw(int eval_no)
 
 /*-----------------------------------------------------------------------
 //
-// Function: splay_tree()
+// Function: heap_set()
+//
+//   Store eval at index i of the heap array and record the position
+//   in eval.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes heap
+//
+/----------------------------------------------------------------------*/
+
+static inline void heap_set(IntOrP *heap, long i, Eval_p eval, int pos)
+{
+   heap[i].p_val = eval;
+   eval->evals[pos].heap_pos = i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: heap_sift_up()
 //
-//   Perform the splay operation on tree at node with key.
+//   Move eval (which is to be stored at index i) up towards the root
+//   of the heap until the heap property holds.
 //
 // Global Variables: -
 //
-// Side Effects    : Changes tree
+// Side Effects    : Changes heap
 //
 /----------------------------------------------------------------------*/
 
-static Eval_p splay_tree(Eval_p tree, Eval_p splay, int pos)
+static void heap_sift_up(IntOrP *heap, long i, Eval_p eval, int pos)
 {
-   Eval_p left, right, tmp, newnode;
-   long   cmpres;
+   long parent;
 
-   if (!tree)
+   while(i)
    {
-      return tree;
+      parent = (i-1)/2;
+      if(EvalCompare(eval, heap[parent].p_val, pos) >= 0)
+      {
+         break;
+      }
+      heap_set(heap, i, heap[parent].p_val, pos);
+      i = parent;
    }
+   heap_set(heap, i, eval, pos);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: heap_sift_down()
+//
+//   Move eval (which is to be stored at index i) down towards the
+//   leaves of the heap with size elements until the heap property
+//   holds. If update is false, the heap positions stored in the
+//   evaluations are not changed (this is used for sorting copies of
+//   the heap).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes heap
+//
+/----------------------------------------------------------------------*/
 
-   newnode = evals_alloc_raw(splay->eval_no);
-   newnode->evals[pos].lson = NULL;
-   newnode->evals[pos].rson = NULL;
-   left = newnode;
-   right = newnode;
+static void heap_sift_down(IntOrP *heap, long size, long i, Eval_p eval,
+                           int pos, bool update)
+{
+   long child;
 
-   for (;;)
+   while((child = 2*i+1) < size)
    {
-      cmpres = EvalCompare(splay, tree, pos);
-      if (cmpres < 0)
+      if(child+1 < size &&
+         EvalCompare(heap[child+1].p_val, heap[child].p_val, pos) < 0)
       {
-         if(!tree->evals[pos].lson)
-         {
-            break;
-         }
-         if(EvalCompare(splay, tree->evals[pos].lson, pos) < 0)
-         {
-            tmp = tree->evals[pos].lson;
-            tree->evals[pos].lson = tmp->evals[pos].rson;
-            tmp->evals[pos].rson = tree;
-            tree = tmp;
-            if (!tree->evals[pos].lson)
-            {
-               break;
-            }
-         }
-         right->evals[pos].lson = tree;
-         right = tree;
-         tree = tree->evals[pos].lson;
+         child++;
       }
-      else if(cmpres > 0)
+      if(EvalCompare(eval, heap[child].p_val, pos) <= 0)
       {
-         if (!tree->evals[pos].rson)
-         {
-            break;
-         }
-         if(EvalCompare(splay, tree->evals[pos].rson, pos) > 0)
-         {
-            tmp = tree->evals[pos].rson;
-            tree->evals[pos].rson = tmp->evals[pos].lson;
-            tmp->evals[pos].lson = tree;
-            tree = tmp;
-            if (!tree->evals[pos].rson)
-            {
-               break;
-            }
-         }
-         left->evals[pos].rson = tree;
-         left = tree;
-         tree = tree->evals[pos].rson;
+         break;
       }
-      else
+      heap[i] = heap[child];
+      if(update)
       {
-         break;
+         ((Eval_p)heap[i].p_val)->evals[pos].heap_pos = i;
       }
+      i = child;
+   }
+   heap[i].p_val = eval;
+   if(update)
+   {
+      eval->evals[pos].heap_pos = i;
    }
-   left->evals[pos].rson = tree->evals[pos].lson;
-   right->evals[pos].lson = tree->evals[pos].rson;
-   tree->evals[pos].lson = newnode->evals[pos].rson;
-   tree->evals[pos].rson = newnode->evals[pos].lson;
-
-   EvalsFree(newnode);
-   return tree;
 }
 
 
-
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -183,7 +199,7 @@ Eval_p EvalsAlloc(int eval_no)
 //
 // Function: EvalsFree()
 //
-//   Free a list of evaluations. Does _not_ check for tree
+//   Free a list of evaluations. Does _not_ check for heap
 //   dependencies.
 //
 // Global Variables: -
@@ -415,236 +431,159 @@ long EvalCompare(Eval_p ev1, Eval_p ev2, int pos)
 
 /*-----------------------------------------------------------------------
 //
-// Function: EvalTreeInsert()
+// Function: EvalHeapInsert()
 //
-//   If an entry with newnode exists in the tree return a
-//   pointer to it. Otherwise insert newnode in the tree and return
-//   NULL.
+//   Insert eval into the heap ordered by the evaluation at position
+//   pos.
 //
 // Global Variables: -
 //
-// Side Effects    : Changes the tree
+// Side Effects    : Changes the heap, memory operations
 //
 /----------------------------------------------------------------------*/
 
-Eval_p EvalTreeInsert(Eval_p *root, Eval_p newnode, int pos)
+void EvalHeapInsert(PStack_p heap, Eval_p eval, int pos)
 {
-   long cmpres;
-   if (!*root)
-   {
-      newnode->evals[pos].lson = newnode->evals[pos].rson = NULL;
-      *root = newnode;
-      return NULL;
-   }
-   *root = splay_tree(*root, newnode, pos);
-
-   cmpres = EvalCompare(newnode, *root, pos);
+   assert(eval->evals[pos].heap_pos == -1);
 
-   if (cmpres < 0)
-   {
-      newnode->evals[pos].lson = (*root)->evals[pos].lson;
-      newnode->evals[pos].rson = *root;
-      (*root)->evals[pos].lson = NULL;
-      *root = newnode;
-      return NULL;
-   }
-   else if(cmpres > 0)
-   {
-      newnode->evals[pos].rson = (*root)->evals[pos].rson;
-      newnode->evals[pos].lson = *root;
-      (*root)->evals[pos].rson = NULL;
-      *root = newnode;
-      return NULL;
-   }
-   return *root;
+   PStackPushP(heap, eval);
+   heap_sift_up(PStackBaseAddress(heap), PStackGetTopSP(heap), eval, pos);
 }
 
 
 /*-----------------------------------------------------------------------
 //
-// Function: EvalTreeFind()
+// Function: EvalHeapExtractEntry()
 //
-//   Find the entry with key key in the tree and return it. Return
-//   NULL if no such key exists.
+//   Remove eval from the heap. Return false if it is not in the heap
+//   (e.g. because it was added to a clause that already was in a
+//   set).
 //
 // Global Variables: -
 //
-// Side Effects    : Splays the tree
+// Side Effects    : Changes the heap
 //
 /----------------------------------------------------------------------*/
 
-Eval_p EvalTreeFind(Eval_p *root, Eval_p key, int pos)
+bool EvalHeapExtractEntry(PStack_p heap, Eval_p eval, int pos)
 {
-   if(*root)
-   {
-      *root = splay_tree(*root, key, pos);
-      if(EvalCompare(*root, key, pos)==0)
-      {
-         return *root;
-      }
-   }
-   return NULL;
-}
-
-
-/*-----------------------------------------------------------------------
-//
-// Function: EvalTreeExtractEntry()
-//
-//   Find the entry with key key and remove it from the tree. Return
-//   NULL if no matching element exists.
-//
-// Global Variables: -
-//
-// Side Effects    : Changes the tree
-//
-/----------------------------------------------------------------------*/
-
+   long   i = eval->evals[pos].heap_pos;
+   IntOrP *base;
+   Eval_p last;
 
-Eval_p EvalTreeExtractEntry(Eval_p *root, Eval_p key, int pos)
-{
-   Eval_p x, cell;
-
-   if (!(*root))
+   if(!heap || i < 0 || i >= PStackGetSP(heap) ||
+      PStackElementP(heap, i) != eval)
    {
-      return NULL;
+      return false;
    }
-   *root = splay_tree(*root, key, pos);
-   if(EvalCompare(key, (*root), pos)==0)
+   eval->evals[pos].heap_pos = -1;
+   last = PStackPopP(heap);
+   if(last != eval)
    {
-      if (!(*root)->evals[pos].lson)
+      base = PStackBaseAddress(heap);
+      if(i && EvalCompare(last, base[(i-1)/2].p_val, pos) < 0)
       {
-         x = (*root)->evals[pos].rson;
+         heap_sift_up(base, i, last, pos);
       }
       else
       {
-         x = splay_tree((*root)->evals[pos].lson, key, pos);
-         x->evals[pos].rson = (*root)->evals[pos].rson;
+         heap_sift_down(base, PStackGetSP(heap), i, last, pos, true);
       }
-      cell = *root;
-      cell->evals[pos].lson = cell->evals[pos].rson = NULL;
-      *root = x;
-      return cell;
    }
-   return NULL;
+   return true;
 }
 
 
 /*-----------------------------------------------------------------------
 //
-// Function: EvalTreeDeleteEntry()
+// Function: EvalHeapFindSmallest()
 //
-//   Delete the entry with key key from the tree.
+//   Return the smallest evaluation in the heap (or NULL if the heap
+//   is empty or does not exist).
 //
 // Global Variables: -
 //
-// Side Effects    : By EvalExtract(), memory operations
+// Side Effects    : -
 //
 /----------------------------------------------------------------------*/
 
-bool EvalTreeDeleteEntry(Eval_p *root, Eval_p key, int pos)
+Eval_p EvalHeapFindSmallest(PStack_p heap)
 {
-   Eval_p cell;
-
-   cell = EvalTreeExtractEntry(root, key, pos);
-   if(cell)
+   if(!heap || PStackEmpty(heap))
    {
-      EvalsFree(cell);
-      return true;
+      return NULL;
    }
-   return false;
+   return PStackElementP(heap, 0);
 }
 
 
 /*-----------------------------------------------------------------------
 //
-// Function: EvalTreeFindSmallest()
+// Function: EvalHeapTraverseInit()
 //
-//   Find the smallest evaluation.
+//   Return a traversal state for visiting the elements of the heap
+//   (which may be NULL) in ascending order. The state is a sorted
+//   copy, so the heap may change during the traversal.
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations
 //
 /----------------------------------------------------------------------*/
 
-Eval_p EvalTreeFindSmallest(Eval_p root, int pos)
+PStack_p EvalHeapTraverseInit(PStack_p heap, int pos)
 {
-   if(!root)
-   {
-      return NULL;
-   }
-   while(root->evals[pos].lson)
+   PStack_p state;
+   IntOrP   *base;
+   Eval_p   tmp;
+   long     i;
+
+   if(!heap)
    {
-      root = root->evals[pos].lson;
+      return PStackAlloc();
    }
+   state = PStackCopy(heap);
+   base  = PStackBaseAddress(state);
 
-   return root;
-}
-
-/*-----------------------------------------------------------------------
-//
-// Function: EvalTreeTraverseInit()
-//
-//   Return a stack containing the path to the smallest element in the
-//   tree.
-//
-// Global Variables: -
-//
-// Side Effects    : Memory operations
-//
-//---------------------------------------------------------------------*/
-
-PStack_p EvalTreeTraverseInit(Eval_p root, int pos)
-{
-   PStack_p stack = PStackAlloc();
-
-   while(root)
+   /* Heapsort - the smallest element ends up on top of the stack */
+   for(i=PStackGetTopSP(state); i>0; i--)
    {
-      PStackPushP(stack, root);
-      root = root->evals[pos].lson;
+      tmp = base[i].p_val;
+      base[i] = base[0];
+      heap_sift_down(base, i, 0, tmp, pos, false);
    }
-   return stack;
+   return state;
 }
 
 
 /*---------------------------------------------------------------------
 //
-// Function: EvalTreeTraverseNext()
+// Function: EvalHeapTraverseNext()
 //
-//   Given a stack describing a traversal state, return the next node
-//   and update the stack.
+//   Given a traversal state, return the next evaluation (or NULL if
+//   the traversal is complete).
 //
 // Global Variables: -
 //
-// Side Effects    : Updates stack
+// Side Effects    : Updates state
 //
 /----------------------------------------------------------------------*/
 
-Eval_p EvalTreeTraverseNext(PStack_p state, int pos)
+Eval_p EvalHeapTraverseNext(PStack_p state)
 {
-   Eval_p handle, res;
-
    if(PStackEmpty(state))
    {
       return NULL;
    }
-   res = PStackPopP(state);
-   handle = res->evals[pos].rson;
-   while(handle)
-   {
-      PStackPushP(state, handle);
-      handle = handle->evals[pos].lson;
-   }
-   return res;
+   return PStackPopP(state);
 }
 
 
 /*-----------------------------------------------------------------------
 //
-// Function: EvalTreePrintInOrder()
+// Function: EvalHeapPrintInOrder()
 //
-//   Print an evaluation tree in ascending order to stdout (mainly for
+//   Print the evaluations in a heap in ascending order (mainly for
 //   debugging and to test the traversal functions ;-)
 //
 // Global Variables: -
@@ -653,19 +592,19 @@ Eval_p EvalTreeTraverseNext(PStack_p state, int pos)
 //
 /----------------------------------------------------------------------*/
 
-void EvalTreePrintInOrder(FILE* out, Eval_p tree, int pos)
+void EvalHeapPrintInOrder(FILE* out, PStack_p heap, int pos)
 {
    PStack_p state;
    Eval_p   handle;
 
-   state = EvalTreeTraverseInit(tree, pos);
+   state = EvalHeapTraverseInit(heap, pos);
 
-   while((handle = EvalTreeTraverseNext(state, pos)))
+   while((handle = EvalHeapTraverseNext(state)))
    {
       EvalListPrintComment(out, handle);
       fputc('\n', out);
    }
-   EvalTreeTraverseExit(state);
+   EvalHeapTraverseExit(state);
 }
 
 
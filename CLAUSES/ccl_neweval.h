@@ -23,6 +23,8 @@ Changes
 <3> Thu Apr 20 00:32:11 CEST 2006
     Imported code and history for new, more efficient evaluations for
     ccl_evaluations.h
+<4> Sat Oct 17 2026
+    Replaced splay trees with indexed binary heaps
 
 -----------------------------------------------------------------------*/
 
@@ -51,8 +53,8 @@ typedef struct simple_eval_cell
 {
    EvalPriority      priority;   /* Technical considerations */
    float             heuristic;  /* Heuristical evaluation   */
-   struct eval_cell* lson;       /* Successors in ordered tree */
-   struct eval_cell* rson;
+   int               heap_pos;   /* Index in the heap for this
+                                    evaluation, -1 if none */
 }SimpleEvalCell, *SimpleEval_p;
 
 typedef struct eval_cell
@@ -103,20 +105,21 @@ void     EvalListChangePriority(Eval_p list, EvalPriority diff);
 bool     EvalGreater(Eval_p ev1, Eval_p ev2, int pos);
 long     EvalCompare(Eval_p ev1, Eval_p ev2, int pos);
 
-Eval_p   EvalTreeInsert(Eval_p *root, Eval_p newnode, int pos);
-Eval_p   EvalTreeFind(Eval_p *root, Eval_p key, int pos);
-Eval_p   EvalTreeExtractEntry(Eval_p *root, Eval_p key, int pos);
-bool     EvalTreeDeleteEntry(Eval_p *root, Eval_p key, int pos);
-Eval_p   EvalTreeFindSmallest(Eval_p root, int pos);
+/* Evaluations are organized in binary min-heaps (one per evaluation
+   position, stored in a PStack), ordered by EvalCompare(). Each
+   evaluation records its index in the heap, so that it can be
+   removed without searching. */
 
-/* AVL_TRAVERSE_DECLARATION(EvalTree,Eval_p) */
+void     EvalHeapInsert(PStack_p heap, Eval_p eval, int pos);
+bool     EvalHeapExtractEntry(PStack_p heap, Eval_p eval, int pos);
+Eval_p   EvalHeapFindSmallest(PStack_p heap);
 
-#define EvalTreeTraverseExit(stack) PStackFree(stack)
+#define EvalHeapTraverseExit(stack) PStackFree(stack)
 
-PStack_p EvalTreeTraverseInit(Eval_p root, int pos);
-Eval_p   EvalTreeTraverseNext(PStack_p state, int pos);
+PStack_p EvalHeapTraverseInit(PStack_p heap, int pos);
+Eval_p   EvalHeapTraverseNext(PStack_p state);
 
-void EvalTreePrintInOrder(FILE* out, Eval_p tree, int pos);
+void EvalHeapPrintInOrder(FILE* out, PStack_p heap, int pos);
 
 #endif
 
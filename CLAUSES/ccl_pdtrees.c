@@ -17,6 +17,9 @@
   Changes
 
   Created: Jun 24 00:55:29 MET DST 1998
+  Fri Oct 16 2026: Frozen (compiled) copies of PDTs.
+  Sat Oct 17 2026: Search results and leaf traversal without
+  allocation.
 
   -----------------------------------------------------------------------*/
 
@@ -29,6 +32,7 @@
 
 bool PDTreeUseAgeConstraints  = true;
 bool PDTreeUseSizeConstraints = true;
+bool PDTreeUseFrozen          = false;
 
 #ifdef PDT_COUNT_NODES
 unsigned long PDTNodeCounter = 0;
@@ -681,6 +685,456 @@ static void pdtree_backtrack(PDTree_p tree, Subst_p subst)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: pdt_frozen_count()
+//
+//   Count nodes, alternatives and entries of the subtree at node and
+//   add them to the counters in frozen.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes counters in frozen
+//
+/----------------------------------------------------------------------*/
+
+static void pdt_frozen_count(PDTFrozen_p frozen, PDTNode_p node)
+{
+   PStack_p  succ_stack = pdt_node_succ_stack_create(node);
+   PStackPointer i;
+   PDTNode_p next;
+
+   frozen->node_count++;
+   frozen->e_count += PTreeNodes(node->entries);
+   for(i = 0; i< PStackGetSP(succ_stack); i++)
+   {
+      next = PStackElementP(succ_stack, i);
+      if(next->variable)
+      {
+         frozen->v_count++;
+      }
+      else
+      {
+         frozen->f_count++;
+      }
+      pdt_frozen_count(frozen, next);
+   }
+   PStackFree(succ_stack);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pdt_frozen_fill()
+//
+//   Copy the subtree at node into frozen (whose arrays must be big
+//   enough, the counters are used as fill pointers). Return the index
+//   of the new node.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes frozen, may compute invalid constraints
+//                   in the tree.
+//
+/----------------------------------------------------------------------*/
+
+static int pdt_frozen_fill(PDTFrozen_p frozen, PDTNode_p node, int parent)
+{
+   int             self = frozen->node_count++, i;
+   PDTFrozenNode_p handle = &(frozen->nodes[self]);
+   FunCode         f = 0;
+   IntMapIter_p    iter;
+   PDTNode_p       next;
+   PStack_p        trav_stack;
+   PTree_p         trav;
+
+   handle->size_constr = PDTNodeGetSizeConstraint(node);
+   handle->age_constr  = PDTNodeGetAgeConstraint(node);
+   handle->variable    = node->variable;
+   handle->parent      = parent;
+   handle->trav_count  = 0;
+   handle->bound       = false;
+
+   handle->e_first = frozen->e_count;
+   trav_stack = PTreeTraverseInit(node->entries);
+   while((trav = PTreeTraverseNext(trav_stack)))
+   {
+      frozen->entries[frozen->e_count++] = trav->key;
+   }
+   PTreeTraverseExit(trav_stack);
+   handle->e_count = frozen->e_count-handle->e_first;
+
+   /* Reserve the ranges for the alternatives first, so that the
+      children of a node are contiguous. IntMap iterators return
+      keys in ascending order. */
+   handle->f_first = frozen->f_count;
+   iter = IntMapIterAlloc(node->f_alternatives, 0, LONG_MAX);
+   while((next = IntMapIterNext(iter, &f)))
+   {
+      assert((frozen->f_count == handle->f_first)||
+             (frozen->f_codes[frozen->f_count-1] < f));
+      frozen->f_codes[frozen->f_count++] = f;
+   }
+   IntMapIterFree(iter);
+   handle->f_count = frozen->f_count-handle->f_first;
+
+   handle->v_first = frozen->v_count;
+   for(f=1; f<=node->max_var; f++)
+   {
+      if(PDArrayElementP(node->v_alternatives, f))
+      {
+         frozen->v_count++;
+      }
+   }
+   handle->v_count = frozen->v_count-handle->v_first;
+
+   for(i=0; i<handle->f_count; i++)
+   {
+      next = IntMapGetVal(node->f_alternatives,
+                          frozen->f_codes[handle->f_first+i]);
+      frozen->f_succs[handle->f_first+i] =
+         pdt_frozen_fill(frozen, next, self);
+   }
+   i = 0;
+   for(f=1; f<=node->max_var; f++)
+   {
+      next = PDArrayElementP(node->v_alternatives, f);
+      if(next)
+      {
+         frozen->v_succs[handle->v_first+i] =
+            pdt_frozen_fill(frozen, next, self);
+         i++;
+      }
+   }
+   return self;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pdt_frozen_free()
+//
+//   Free a frozen PDT.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void pdt_frozen_free(PDTFrozen_p junk)
+{
+   FREE(junk->nodes);
+   FREE(junk->f_codes);
+   FREE(junk->f_succs);
+   FREE(junk->v_succs);
+   FREE(junk->entries);
+   PDTFrozenCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pdt_frozen_find_fun()
+//
+//   Return the index of the successor of node for function symbol f,
+//   or -1 if there is none.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ int pdt_frozen_find_fun(PDTFrozen_p frozen,
+                                          PDTFrozenNode_p node,
+                                          FunCode f)
+{
+   int lo = node->f_first, hi = node->f_first+node->f_count, mid;
+
+   while(lo < hi)
+   {
+      mid = lo+(hi-lo)/2;
+      if(frozen->f_codes[mid] < f)
+      {
+         lo = mid+1;
+      }
+      else
+      {
+         hi = mid;
+      }
+   }
+   if((lo < node->f_first+node->f_count) && (frozen->f_codes[lo] == f))
+   {
+      return frozen->f_succs[lo];
+   }
+   return -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pdt_frozen_verify_node_constr()
+//
+//   Frozen version of pdtree_verify_node_constr().
+//
+// Global Variables: PDTreeUseSizeConstraints, PDTreeUseAgeConstraints
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ bool pdt_frozen_verify_node_constr(PDTree_p tree,
+                                                     PDTFrozenNode_p node)
+{
+   PDT_COUNT_INC(PDTNodeCounter);
+
+   if(PDTreeUseSizeConstraints &&
+      (tree->term_weight < node->size_constr))
+   {
+      return false;
+   }
+   if(PDTreeUseAgeConstraints &&
+      !SysDateIsEarlier(tree->term_date, node->age_constr))
+   {
+      return false;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pdt_frozen_forward()
+//
+//   Frozen (and first-order only) version of pdtree_forward(). The
+//   alternatives are tried in the same order: trav_count i is the
+//   function symbol alternative if it is equal to fun_alt, otherwise
+//   it selects a variable alternative.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree state!
+//
+/----------------------------------------------------------------------*/
+
+static void pdt_frozen_forward(PDTree_p tree, Subst_p subst)
+{
+   PDTFrozen_p     frozen = tree->frozen;
+   PDTFrozenNode_p handle = &(frozen->nodes[tree->frozen_pos]), next;
+   int             i = handle->trav_count, limit = handle->v_count+1;
+   int             fun_alt = tree->prefer_general?handle->v_count:0;
+   int             succ;
+   Term_p          var;
+   Term_p          term = PStackGetSP(tree->term_stack) ? PStackTopP(tree->term_stack) : NULL;
+
+   if(!term)
+   {
+      i = limit;
+   }
+   while(i<limit)
+   {
+      if(i==fun_alt)
+      {
+         i++;
+         if(!TermIsVar(term) &&
+            ((succ = pdt_frozen_find_fun(frozen, handle, term->f_code))!=-1))
+         {
+            next = &(frozen->nodes[succ]);
+            PStackPushP(tree->term_proc, term);
+            TermLRTraverseNext(tree->term_stack);
+            next->trav_count = 0;
+            next->bound      = false;
+            tree->frozen_pos = succ;
+#ifdef MEASURE_EXPENSIVE
+            tree->visited_count++;
+#endif
+            break;
+         }
+      }
+      else
+      {
+         succ = frozen->v_succs[handle->v_first+(i>fun_alt?i-1:i)];
+         i++;
+         next = &(frozen->nodes[succ]);
+         var  = next->variable;
+         assert(var);
+         if((!var->binding)&&
+            (TermIsVar(term) ||
+             SigSymbolUnifiesWithVar(tree->bank->sig, term->f_code)) &&
+            (var->type == term->type))
+         {
+            PStackDiscardTop(tree->term_stack);
+            SubstAddBinding(subst, var, term);
+            next->bound = true;
+         }
+         else if(var->binding == term)
+         {
+            PStackDiscardTop(tree->term_stack);
+            next->bound = false;
+         }
+         else
+         {
+            continue;
+         }
+         next->trav_count  = 0;
+         tree->frozen_pos  = succ;
+         tree->term_weight -= (TermStandardWeight(var->binding) -
+                               TermStandardWeight(var));
+#ifdef MEASURE_EXPENSIVE
+         tree->visited_count++;
+#endif
+         break;
+      }
+   }
+   handle->trav_count = i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pdt_frozen_backtrack()
+//
+//   Frozen version of pdtree_backtrack().
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree state
+//
+/----------------------------------------------------------------------*/
+
+static void pdt_frozen_backtrack(PDTree_p tree, Subst_p subst)
+{
+   PDTFrozenNode_p handle = &(tree->frozen->nodes[tree->frozen_pos]);
+   bool            succ;
+
+   if(handle->variable)
+   {
+      tree->term_weight  += (TermStandardWeight(handle->variable->binding) -
+                             TermStandardWeight(handle->variable));
+      PStackPushP(tree->term_stack, handle->variable->binding);
+      if(handle->bound)
+      {
+         succ = SubstBacktrackSingle(subst);
+         UNUSED(succ); assert(succ);
+      }
+   }
+   else if(handle->parent != -1)
+   {
+      Term_p t = PStackPopP(tree->term_proc);
+
+      UNUSED(t); assert(t);
+      TermLRTraversePrev(tree->term_stack,t);
+   }
+   tree->frozen_pos = handle->parent;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pdt_frozen_find_next_leaf()
+//
+//   Frozen version of PDTreeFindNextIndexedLeaf(). Return the index
+//   of the next leaf with matching terms, or -1.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree state
+//
+/----------------------------------------------------------------------*/
+
+static int pdt_frozen_find_next_leaf(PDTree_p tree, Subst_p subst)
+{
+   PDTFrozenNode_p handle;
+
+   while(tree->frozen_pos != -1)
+   {
+      handle = &(tree->frozen->nodes[tree->frozen_pos]);
+      if((handle->trav_count == handle->v_count+1)||
+         !pdt_frozen_verify_node_constr(tree, handle))
+      {
+         pdt_frozen_backtrack(tree, subst);
+      }
+      else if(handle->e_count)
+      {
+         assert(!handle->f_count && !handle->v_count);
+         handle->trav_count = handle->v_count+1;
+         break;
+      }
+      else
+      {
+         pdt_frozen_forward(tree, subst);
+      }
+   }
+   return tree->frozen_pos;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pdt_frozen_find_next_demodulator()
+//
+//   Frozen version of PDTreeFindNextDemodulator().
+//
+// Global Variables: -
+//
+// Side Effects    : Changes tree state
+//
+/----------------------------------------------------------------------*/
+
+static MatchRes_p pdt_frozen_find_next_demodulator(PDTree_p tree,
+                                                   Subst_p subst)
+{
+   PDTFrozenNode_p leaf;
+   MatchRes_p      mi = &(tree->match_res);
+
+   while(tree->frozen_pos != -1)
+   {
+      if(tree->frozen_entry != -1)
+      {
+         leaf = &(tree->frozen->nodes[tree->frozen_pos]);
+         if(tree->frozen_entry < leaf->e_first+leaf->e_count)
+         {
+            mi->remaining_args = PStackGetSP(tree->term_stack);
+            mi->pos = tree->frozen->entries[tree->frozen_entry++];
+            return mi;
+         }
+         tree->frozen_entry = -1;
+      }
+      if(pdt_frozen_find_next_leaf(tree, subst) != -1)
+      {
+         tree->frozen_entry = tree->frozen->nodes[tree->frozen_pos].e_first;
+      }
+   }
+   return NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pdt_leaf_traverse_init()
+//
+//   As PTreeTraverseInit(), but reuse stack (which is reset) instead
+//   of allocating a new one. Return stack.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes stack
+//
+/----------------------------------------------------------------------*/
+
+static PStack_p pdt_leaf_traverse_init(PStack_p stack, PTree_p root)
+{
+   PStackReset(stack);
+   while(root)
+   {
+      PStackPushP(stack, root);
+      root = root->lson;
+   }
+   return stack;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: pdt_node_print()
@@ -774,6 +1228,7 @@ PDTree_p PDTreeAlloc(TB_p bank)
    handle->term_proc       = PStackAlloc();
    handle->tree_pos        = NULL;
    handle->store_stack     = NULL;
+   handle->leaf_stack      = PStackAlloc();
    handle->term            = NULL;
    handle->term_date       = SysDateCreationTime();
    handle->term_weight     = LONG_MAX;
@@ -786,6 +1241,12 @@ PDTree_p PDTreeAlloc(TB_p bank)
    handle->match_count     = 0;
    handle->visited_count   = 0;
    handle->bank            = bank;
+   handle->frozen          = NULL;
+   handle->frozen_valid    = false;
+   handle->use_frozen      = false;
+   handle->frozen_pos      = -1;
+   handle->frozen_entry    = -1;
+   handle->searches_since_change = 0;
 
    return handle;
 }
@@ -810,6 +1271,11 @@ void PDTreeFree(PDTree_p tree)
    PStackFree(tree->term_stack);
    PStackFree(tree->term_proc);
    assert(!tree->store_stack);
+   PStackFree(tree->leaf_stack);
+   if(tree->frozen)
+   {
+      pdt_frozen_free(tree->frozen);
+   }
    PDTreeCellFree(tree);
 }
 
@@ -1060,6 +1526,8 @@ void PDTreeInsertTerm(PDTree_p tree, Term_p term, ClausePos_p demod_side,
    assert(tree);
    assert(tree->tree);
 
+   tree->frozen_valid = false;
+   tree->searches_since_change = 0;
    TermLRTraverseInit(tree->term_stack, term);
    node              = tree->tree;
    tmp = TermStandardWeight(term);
@@ -1202,6 +1670,8 @@ long PDTreeDelete(PDTree_p tree, Term_p term, Clause_p clause)
    assert(term);
    assert(clause);
 
+   tree->frozen_valid = false;
+   tree->searches_since_change = 0;
    TermLRTraverseInit(tree->term_stack, term);
    node = tree->tree;
    curr = TermLRTraverseNext(tree->term_stack);
@@ -1273,6 +1743,62 @@ long PDTreeDelete(PDTree_p tree, Term_p term, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: PDTreeFreeze()
+//
+//   (Re-)build the frozen copy of tree. Searches use the frozen copy
+//   until the tree is changed again. This is only supported for
+//   first-order problems (otherwise the call is ignored).
+//
+// Global Variables: problemType
+//
+// Side Effects    : Memory operations, may compute invalid
+//                   constraints in the tree.
+//
+/----------------------------------------------------------------------*/
+
+void PDTreeFreeze(PDTree_p tree)
+{
+   PDTFrozen_p frozen;
+   int         root;
+
+   assert(tree);
+   if(problemType != PROBLEM_FO)
+   {
+      return;
+   }
+   if(tree->frozen)
+   {
+      pdt_frozen_free(tree->frozen);
+   }
+   frozen = PDTFrozenCellAlloc();
+   frozen->node_count = 0;
+   frozen->f_count    = 0;
+   frozen->v_count    = 0;
+   frozen->e_count    = 0;
+   pdt_frozen_count(frozen, tree->tree);
+
+   /* +1 - the alternative arrays may well be empty */
+   frozen->nodes   = SecureMalloc(frozen->node_count*sizeof(PDTFrozenNodeCell));
+   frozen->f_codes = SecureMalloc((frozen->f_count+1)*sizeof(FunCode));
+   frozen->f_succs = SecureMalloc((frozen->f_count+1)*sizeof(int));
+   frozen->v_succs = SecureMalloc((frozen->v_count+1)*sizeof(int));
+   frozen->entries = SecureMalloc((frozen->e_count+1)*sizeof(ClausePos_p));
+
+   frozen->node_count = 0;
+   frozen->f_count    = 0;
+   frozen->v_count    = 0;
+   frozen->e_count    = 0;
+   root = pdt_frozen_fill(frozen, tree->tree, -1);
+   UNUSED(root); assert(root == 0);
+
+   tree->frozen                = frozen;
+   tree->frozen_valid          = true;
+   tree->searches_since_change = 0;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: PDTreeSearchInit()
@@ -1300,6 +1826,27 @@ void PDTreeSearchInit(PDTree_p tree, Term_p term, SysDate age_constr,
    assert(TermStandardWeight(term) == TermWeight(term,DEFAULT_VWEIGHT,DEFAULT_FWEIGHT));
    tree->term_weight      = TermStandardWeight(term);
    tree->match_count++;
+
+   tree->use_frozen = false;
+   if(problemType == PROBLEM_FO)
+   {
+      if(!tree->frozen_valid && PDTreeUseFrozen)
+      {
+         tree->searches_since_change++;
+         if(tree->searches_since_change*PDT_FROZEN_REBUILD_RATIO >=
+            tree->node_count)
+         {
+            PDTreeFreeze(tree);
+         }
+      }
+      if(tree->frozen_valid)
+      {
+         tree->use_frozen   = true;
+         tree->frozen_pos   = 0;
+         tree->frozen_entry = -1;
+         tree->frozen->nodes[0].trav_count = 0;
+      }
+   }
 }
 
 /*-----------------------------------------------------------------------
@@ -1318,11 +1865,7 @@ void PDTreeSearchExit(PDTree_p tree)
 {
    assert(tree->term);
 
-   if(tree->store_stack)
-   {
-      PTreeTraverseExit(tree->store_stack);
-      tree->store_stack = NULL;
-   }
+   tree->store_stack = NULL;
    tree->term = NULL;
 }
 
@@ -1387,8 +1930,12 @@ PDTNode_p PDTreeFindNextIndexedLeaf(PDTree_p tree, Subst_p subst)
 MatchRes_p PDTreeFindNextDemodulator(PDTree_p tree, Subst_p subst)
 {
    PTree_p res_cell = NULL;
-   MatchRes_p mi = MatchResAlloc();
+   MatchRes_p mi = &(tree->match_res);
 
+   if(tree->use_frozen)
+   {
+      return pdt_frozen_find_next_demodulator(tree, subst);
+   }
    assert(tree->tree_pos);
    while(tree->tree_pos)
    {
@@ -1403,7 +1950,6 @@ MatchRes_p PDTreeFindNextDemodulator(PDTree_p tree, Subst_p subst)
          }
          else
          {
-            PTreeTraverseExit(tree->store_stack);
             tree->store_stack = NULL;
          }
       }
@@ -1411,11 +1957,10 @@ MatchRes_p PDTreeFindNextDemodulator(PDTree_p tree, Subst_p subst)
       if(tree->tree_pos)
       {
          tree->store_stack =
-            PTreeTraverseInit(tree->tree_pos->entries);
+            pdt_leaf_traverse_init(tree->leaf_stack,
+                                   tree->tree_pos->entries);
       }
    }
-
-   MatchResFree(mi);
    return NULL;
 }
 
@@ -20,6 +20,9 @@
   Changes
 
   Created: Mon Jun 22 17:04:32 MET DST 1998
+  Fri Oct 16 2026: Frozen (compiled) copies of PDTs.
+  Sat Oct 17 2026: Search results and leaf traversal without
+  allocation.
 
   -----------------------------------------------------------------------*/
 
@@ -78,6 +81,43 @@ typedef struct pdt_node_cell
                                   so we mark leaves explicitly -- an optimization */
 }PDTNodeCell, *PDTNode_p;
 
+/* A frozen PDT is a read-only copy of a (first-order) PDT, with all
+   nodes stored in one array (in depth-first order) and the children
+   of each node in contiguous ranges of the alternative arrays.
+   Function symbol alternatives are sorted by f_code (and searched
+   with binary search), variable alternatives by variable number. All
+   references are indices into these arrays. The search state
+   (trav_count, bound) is kept in the nodes, as for PDTNodeCell. */
+
+typedef struct pdt_frozen_node_cell
+{
+   long    size_constr;   /* As for PDTNodeCell, but always valid */
+   SysDate age_constr;    /* Ditto */
+   Term_p  variable;      /* Ditto */
+   int     parent;        /* -1 for the root */
+   int     f_first;       /* Function symbol alternatives */
+   int     f_count;
+   int     v_first;       /* Variable alternatives */
+   int     v_count;
+   int     e_first;       /* Indexed clause positions */
+   int     e_count;
+   int     trav_count;    /* 0..v_count, v_count+1 is closed */
+   bool    bound;
+}PDTFrozenNodeCell, *PDTFrozenNode_p;
+
+typedef struct pdt_frozen_cell
+{
+   int               node_count;
+   int               f_count;
+   int               v_count;
+   int               e_count;
+   PDTFrozenNodeCell *nodes;    /* nodes[0] is the root */
+   FunCode           *f_codes;  /* Sorted within each node's range */
+   int               *f_succs;  /* Node reached via f_codes[i] */
+   int               *v_succs;  /* Node reached via variable i */
+   ClausePos_p       *entries;
+}PDTFrozenCell, *PDTFrozen_p;
+
 /* A PDTreeCell is an object encapsulating a PDTree and the necessary
    data structures to efficiently seach it */
 
@@ -87,7 +127,11 @@ typedef struct pd_tree_cell
    PStack_p  term_stack;     /* For flattening the term */
    PStack_p  term_proc;      /* Store traversed terms for backtracking */
    PDTNode_p tree_pos;       /* For traversing the tree */
-   PStack_p  store_stack;    /* For traversing entries in leaves */
+   PStack_p  store_stack;    /* For traversing entries in leaves,
+                                either NULL or leaf_stack */
+   PStack_p  leaf_stack;     /* Reused for all leaf traversals */
+   MatchResCell match_res;   /* Result returned by
+                                PDTreeFindNextDemodulator() */
    Term_p    term;           /* ...used as a key during search */
    SysDate   term_date;      /* Temporarily bound during matching */
    long      term_weight;    /* Ditto */
@@ -101,6 +145,12 @@ typedef struct pd_tree_cell
                                     been visited? */
    TB_p      bank;            /* When we make a prefix term, we want to
                                  make it shared */
+   PDTFrozen_p frozen;        /* Frozen copy of the tree or NULL */
+   bool      frozen_valid;    /* Is frozen up to date with tree? */
+   bool      use_frozen;      /* Does the current search use it? */
+   int       frozen_pos;      /* Current node in frozen, -1 if done */
+   int       frozen_entry;    /* Next entry in the current leaf */
+   long      searches_since_change; /* For the rebuild heuristic */
 }PDTreeCell, *PDTree_p;
 
 
@@ -127,6 +177,25 @@ extern unsigned long PDTNodeCounter;
 #define  PDT_NODE_CLOSED(tree,node) ((tree)->prefer_general?            \
                                      (((node)->max_var)+2):(((node)->max_var)+1))
 
+/* A stale frozen copy is rebuilt automatically once there have been
+   at least node_count/PDT_FROZEN_REBUILD_RATIO searches since the last
+   change of the tree, so that the rebuild cost is amortized over the
+   searches. */
+#define PDT_FROZEN_REBUILD_RATIO 4
+
+#define   PDTFrozenCellAlloc()    (PDTFrozenCell*)SizeMalloc(sizeof(PDTFrozenCell))
+#define   PDTFrozenCellFree(junk) SizeFree(junk, sizeof(PDTFrozenCell))
+
+#define   PDTFrozenStorage(frozen)                                      \
+   ((frozen)                                                            \
+    ?                                                                   \
+    ((frozen)->node_count*sizeof(PDTFrozenNodeCell)                     \
+     +(frozen)->f_count*(sizeof(FunCode)+sizeof(int))                   \
+     +(frozen)->v_count*sizeof(int)                                     \
+     +(frozen)->e_count*sizeof(ClausePos_p))                            \
+    :                                                                   \
+    0)
+
 #define   PDTreeCellAlloc()    (PDTreeCell*)SizeMalloc(sizeof(PDTreeCell))
 #define   PDTreeCellFree(junk) SizeFree(junk, sizeof(PDTreeCell))
 
@@ -151,12 +220,14 @@ void      PDTreeFree(PDTree_p tree);
     ?                                           \
     ((tree)->node_count*PDTNODE_MEM             \
      +(tree)->arr_storage_est                                           \
-     +(tree)->clause_count*(PDTREE_CELL_MEM+CLAUSEPOSCELL_MEM))         \
+     +(tree)->clause_count*(PDTREE_CELL_MEM+CLAUSEPOSCELL_MEM)          \
+     +PDTFrozenStorage((tree)->frozen))                                 \
     :                                                                   \
     0)
 
 extern bool PDTreeUseAgeConstraints;
 extern bool PDTreeUseSizeConstraints;
+extern bool PDTreeUseFrozen;
 
 #define PDTNodeGetSizeConstraint(node) ((node)->size_constr != -1 ? (node)->size_constr : pdt_compute_size_constraint((node)))
 #define PDTNodeGetAgeConstraint(node) (!SysDateIsInvalid((node)->age_constr))? (node)->age_constr: pdt_compute_age_constraint((node))
@@ -175,6 +246,7 @@ void      PDTreeInsert(PDTree_p tree, ClausePos_p demod_side);
 void      PDTreeInsertTerm(PDTree_p tree, Term_p term, 
                            ClausePos_p demod_side, bool store_data);
 long      PDTreeDelete(PDTree_p tree, Term_p term, Clause_p clause);
+void      PDTreeFreeze(PDTree_p tree);
 PDTNode_p PDTreeMatchPrefix(PDTree_p tree, Term_p term,  
                             long* matched, long* remains);
 
@@ -185,6 +257,8 @@ void      PDTreeSearchExit(PDTree_p tree);
 PDTNode_p PDTreeFindNextIndexedLeaf(PDTree_p tree, Subst_p subst);
 
 
+/* The result belongs to the tree and is only valid until the next
+   search is started. */
 MatchRes_p PDTreeFindNextDemodulator(PDTree_p tree, Subst_p subst);
 
 void PDTreePrint(FILE* out, PDTree_p tree);
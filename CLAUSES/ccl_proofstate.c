@@ -15,6 +15,7 @@
   Run "eprover -h" for contact information.
 
   Created: Wed Oct 14 22:46:13 MET DST 1998
+  Sat Oct 17 2026: Temporary terms live in an arena-backed bank
 
 -----------------------------------------------------------------------*/
 
@@ -141,15 +142,42 @@ static void clause_set_pick_training_examples(ClauseSet_p set,
 /----------------------------------------------------------------------*/
 
 ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop)
+{
+   TypeBank_p type_bank = TypeBankAlloc();
+   Sig_p      sig       = SigAlloc(type_bank);
+
+   SigInsertInternalCodes(sig);
+
+   return ProofStateAllocFromTerms(TBAlloc(sig), free_symb_prop);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProofStateAllocFromTerms()
+//
+//   Return an empty, initialized proof state built around an
+//   existing term bank (e.g. one that already holds parsed
+//   axioms). The proof state takes over responsibility for the term
+//   bank, its signature, and its type bank. free_symb_prop is as for
+//   ProofStateAlloc().
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+ProofState_p ProofStateAllocFromTerms(TB_p terms,
+                                      FunctionProperties free_symb_prop)
 {
    ProofState_p handle = ProofStateCellAlloc();
 
-   handle->type_bank            = TypeBankAlloc();
-   handle->signature            = SigAlloc(handle->type_bank);
-   SigInsertInternalCodes(handle->signature);
+   handle->type_bank            = terms->sig->type_bank;
+   handle->signature            = terms->sig;
    handle->original_symbols     = 0;
-   handle->terms                = TBAlloc(handle->signature);
-   handle->tmp_terms            = TBAlloc(handle->signature);
+   handle->terms                = terms;
+   handle->tmp_terms            = TBArenaAlloc(handle->signature);
    handle->freshvars            = VarBankAlloc(handle->type_bank);
    VarBankPairShadow(handle->terms->vars, handle->freshvars);
    handle->f_axioms             = FormulaSetAlloc();
@@ -225,6 +253,16 @@ ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop)
    handle->satcheck_full_size   = 0;
    handle->satcheck_actual_size = 0;
    handle->satcheck_core_size   = 0;
+   handle->given_batch_count    = 0;
+   handle->given_batch_clauses  = 0;
+   handle->given_batch_discarded = 0;
+   handle->given_batch_recheck_discarded = 0;
+   handle->given_batch_max_size = 0;
+   handle->given_batch_integrated = 0;
+   handle->given_batch_new_clauses = 0;
+   handle->given_batch_contract_time  = 0.0;
+   handle->given_batch_integrate_time = 0.0;
+   handle->given_batch_insert_time    = 0.0;
    handle->satcheck_preproc_time  = 0.0;
    handle->satcheck_encoding_time = 0.0;
    handle->satcheck_solver_time   = 0.0;
@@ -652,6 +690,29 @@ void ProofStateStatisticsPrint(FILE* out, ProofState_p state)
            state->satcheck_encoding_stime);
    fprintf(out, "#    Success case prop solver time     : %.3f\n",
            state->satcheck_solver_stime);
+   if(state->given_batch_count)
+   {
+      fprintf(out, "# Given clause batches                 : %ld\n",
+              state->given_batch_count);
+      fprintf(out, "#    Clauses selected in batches       : %ld\n",
+              state->given_batch_clauses);
+      fprintf(out, "#    Discarded by forward contraction  : %ld\n",
+              state->given_batch_discarded);
+      fprintf(out, "#    ...only by earlier batch members  : %ld\n",
+              state->given_batch_recheck_discarded);
+      fprintf(out, "#    Largest batch                     : %ld\n",
+              state->given_batch_max_size);
+      fprintf(out, "#    Integrated into processed set     : %ld\n",
+              state->given_batch_integrated);
+      fprintf(out, "#    New clauses after batches         : %ld\n",
+              state->given_batch_new_clauses);
+      fprintf(out, "#    Forward contraction time          : %.3f\n",
+              state->given_batch_contract_time);
+      fprintf(out, "#    Integration and generation time   : %.3f\n",
+              state->given_batch_integrate_time);
+      fprintf(out, "#    Evaluation and insertion time     : %.3f\n",
+              state->given_batch_insert_time);
+   }
 
    fprintf(out,
            "# Current number of processed clauses  : %ld\n"
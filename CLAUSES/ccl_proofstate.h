@@ -43,7 +43,8 @@ typedef struct proofstatecell
    Sig_p         signature;
    long          original_symbols;
    TB_p          terms;
-   TB_p          tmp_terms;
+   TB_p          tmp_terms;    /* Arena-backed, reset after each
+                                  given clause */
    VarBank_p     freshvars;
    GCAdmin_p     gc_terms;
    FormulaSet_p  f_ax_archive;
@@ -100,9 +101,23 @@ typedef struct proofstatecell
    unsigned long satcheck_full_size; // Number of prop. clauses
    unsigned long satcheck_actual_size; // ...after purity reduction
    unsigned long satcheck_core_size; // ...in unsat core (if any)
+   unsigned long given_batch_count;     /* Multi-given batches */
+   unsigned long given_batch_clauses;   /* ...and their members */
+   unsigned long given_batch_discarded; /* Members contracted away
+                                           before integration */
+   unsigned long given_batch_recheck_discarded; /* ...only by
+                                                   earlier members */
+   unsigned long given_batch_max_size;  /* Largest batch */
+   unsigned long given_batch_integrated; /* Members that entered the
+                                            processed set */
+   unsigned long given_batch_new_clauses; /* Clauses inserted into
+                                             unprocessed after batches */
    double        satcheck_preproc_time;
    double        satcheck_encoding_time;
    double        satcheck_solver_time;
+   double        given_batch_contract_time; /* Per-step times */
+   double        given_batch_integrate_time;
+   double        given_batch_insert_time;
    /* Times for the final successful run (if any) */
    double        satcheck_preproc_stime;
    double        satcheck_encoding_stime;
@@ -139,6 +154,8 @@ typedef enum
    SizeFree(junk, sizeof(ProofStateCell))
 
 ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop);
+ProofState_p ProofStateAllocFromTerms(TB_p terms,
+                                      FunctionProperties free_symb_prop);
 void         ProofStateLoadWatchlist(ProofState_p state,
                                      char* watchlist_filename,
                                      IOFormat parse_format);
@@ -170,7 +170,7 @@ static RWResultType term_is_top_rewritable(TB_p bank, OCB_p ocb,
                                            Term_p term, Clause_p
                                            new_demod, bool restricted_rw)
 {
-   Subst_p      subst = SubstAlloc();
+   Subst_p      subst = SubstBorrow();
    Eqn_p        eqn;
    RWResultType res   = RWNotRewritable;
    Term_p       rterm;
@@ -252,7 +252,7 @@ static RWResultType term_is_top_rewritable(TB_p bank, OCB_p ocb,
          }
       }
    }
-   SubstDelete(subst);
+   SubstReturn(subst);
    return res;
 }
 
@@ -306,7 +306,7 @@ static bool term_is_rewritable(TB_p bank, OCB_p ocb, Term_p term, Clause_p
 
    /* assert(!TermIsRewritten(term));*/
 
-   if(SysDateEqual(term->rw_data.nf_date[RewriteAdr(FullRewrite)], nf_date))
+   if(SysDateEqual(TermNFDateField(term, RewriteAdr(FullRewrite)), nf_date))
    {
       return false;
    }
@@ -340,8 +340,8 @@ static bool term_is_rewritable(TB_p bank, OCB_p ocb, Term_p term, Clause_p
                             TPIsRewritten|TPIsRRewritten)
       &&!restricted_rw)
    {
-      term->rw_data.nf_date[RewriteAdr(RuleRewrite)] =
-         term->rw_data.nf_date[RewriteAdr(FullRewrite)] = nf_date;
+      TermSetNFDate(term, RewriteAdr(RuleRewrite), nf_date);
+      TermSetNFDate(term, RewriteAdr(FullRewrite), nf_date);
    }
    /* printf("...term_is_rewritable() = false (no match)\n");*/
    return false;
@@ -463,7 +463,8 @@ static bool find_rewritable_clauses(OCB_p ocb, ClauseSet_p set,
 //
 // Function: indexed_find_demodulator()
 //
-//   Find a demodulator via demodulators->demod_index.
+//   Find a demodulator via demodulators->demod_index. The result
+//   belongs to the index and is valid until its next search.
 //
 // Global Variables: -
 //
@@ -506,7 +507,6 @@ MatchRes_p indexed_find_demodulator(OCB_p ocb, Term_p term,
           !SysDateIsEarlier(TermNFDate(term,RewriteAdr(FullRewrite)),
                             pos->clause->date)))
       {
-         MatchResFree(match_info); // avoid memory leak -- it was alloc'd in PDTreeFindNextDemodulator
          continue;
       }
       switch(pos->side)
@@ -542,7 +542,6 @@ MatchRes_p indexed_find_demodulator(OCB_p ocb, Term_p term,
       {
          break;
       }
-      MatchResFree(match_info);
    }
    PDTreeSearchExit(demodulators->demod_index);
 
@@ -586,7 +585,7 @@ static Term_p rewrite_with_clause_set(OCB_p ocb, TB_p bank, Term_p term,
                                       demodulators, bool prefer_general,
                                       bool restricted_rw)
 {
-   Subst_p     subst = SubstAlloc();
+   Subst_p     subst = SubstBorrow();
    MatchRes_p mi;
    Term_p      repl;
 
@@ -619,9 +618,8 @@ static Term_p rewrite_with_clause_set(OCB_p ocb, TB_p bank, Term_p term,
       assert(TOGreater(ocb, term, repl, DEREF_NEVER, DEREF_NEVER));
 
       term = repl;
-      MatchResFree(mi);
    }
-   SubstDelete(subst);
+   SubstReturn(subst);
 
    return term;
 }
@@ -744,7 +742,8 @@ static Term_p term_li_normalform(RWDesc_p desc, Term_p term,
    assert(!TermIsTopRewritten(term)||restricted_rw);
 
    if(!TermIsRewritten(term)&&
-      !SysDateIsEarlier(term->rw_data.nf_date[desc->level-1],desc->demod_date))
+      !SysDateIsEarlier(TermNFDateField(term, desc->level-1),
+                        desc->demod_date))
    {
       return term;
    }
@@ -788,10 +787,10 @@ static Term_p term_li_normalform(RWDesc_p desc, Term_p term,
       be due to the extra constraint and does not carry over. */
    if(!TermIsRewritten(term)&&!restricted_rw)
    {
-      term->rw_data.nf_date[RewriteAdr(RuleRewrite)] = desc->demod_date;
+      TermSetNFDate(term, RewriteAdr(RuleRewrite), desc->demod_date);
       if(desc->level == FullRewrite)
       {
-         term->rw_data.nf_date[RewriteAdr(FullRewrite)] = desc->demod_date;
+         TermSetNFDate(term, RewriteAdr(FullRewrite), desc->demod_date);
       }
    }
    return term;
@@ -958,7 +957,7 @@ static long term_find_rw_clauses(Clause_p demod,
    Eqn_p eqn = demod->literals;
    RWResultType rwres = RWNotRewritable;
    long    res = 0;
-   Subst_p subst = SubstAlloc();
+   Subst_p subst = SubstBorrow();
    Term_p  term = termocc->term;
 
    assert(!TermIsVar(term));
@@ -1001,7 +1000,7 @@ static long term_find_rw_clauses(Clause_p demod,
       /* We cannot set the NF date here, since we have no indication
          of the state of the subterms. */
    }
-   SubstDelete(subst);
+   SubstReturn(subst);
    return res;
 }
 
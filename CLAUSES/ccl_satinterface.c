@@ -16,6 +16,7 @@
   Run "eprover -h" for contact information.
 
   Created: Sat Sep 16 16:52:43 CEST 2017
+  Sat Oct 17 2026: Incremental checking with a persistent solver.
 
   -----------------------------------------------------------------------*/
 
@@ -30,6 +31,9 @@
 
 #define PICOSAT_BUFSIZE 200
 
+#define SAT_REFS_INIT_SIZE 1024
+#define SAT_REFS_HASH_MULT 0x9E3779B97F4A7C15ULL
+
 
 char* GroundingStratNames[] =
 {
@@ -106,6 +110,10 @@ int sat_translate_literal(Eqn_p eqn, SatClauseSet_p set)
    {
       atom = ++set->max_lit;
       PDRangeArrAssignInt(set->renumber_index, lit_code, atom);
+      if(set->atoms)
+      {
+         PStackPushP(set->atoms, lit_term);
+      }
    }
    if(EqnIsPositive(eqn))
    {
@@ -386,6 +394,441 @@ void export_to_solver(SatSolver_p solver, SatClauseSet_p set, SatClauseFilter fi
    }
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: sat_grounding_subst()
+//
+//   Return the (pseudo-)grounding substitution for all variables of
+//   state->terms described by strat.
+//
+// Global Variables: -
+//
+// Side Effects    : Binds variables, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static Subst_p sat_grounding_subst(ProofState_p state, GroundingStrategy strat,
+                                   bool norm_const)
+{
+   Subst_p subst = NULL;
+
+   switch(strat)
+   {
+   case GMPseudoVar:
+         subst = SubstPseudoGroundVarBank(state->terms->vars);
+         break;
+   case GMFirstConst:
+         subst = SubstGroundVarBankFirstConst(state->terms,
+                                              norm_const);
+         break;
+   case GMConjMinMinFreq:
+         subst = SubstGroundFreqBased(state->terms,
+                                      state->axioms,
+                                      prefer_conj_min_min_freq,
+                                      norm_const);
+         break;
+   case GMConjMaxMinFreq:
+         subst = SubstGroundFreqBased(state->terms,
+                                      state->axioms,
+                                      prefer_conj_max_min_freq,
+                                      norm_const);
+         break;
+   case GMConjMinMaxFreq:
+         subst = SubstGroundFreqBased(state->terms,
+                                      state->axioms,
+                                      prefer_conj_min_max_freq,
+                                      norm_const);
+         break;
+   case GMConjMaxMaxFreq:
+         subst = SubstGroundFreqBased(state->terms,
+                                      state->axioms,
+                                      prefer_conj_max_max_freq,
+                                      norm_const);
+         break;
+   case GMGlobalMax:
+         subst = SubstGroundFreqBased(state->terms,
+                                      state->axioms,
+                                      prefer_global_max_freq,
+                                      norm_const);
+         break;
+   case GMGlobalMin:
+         subst = SubstGroundFreqBased(state->terms,
+                                      state->axioms,
+                                      prefer_global_min_freq,
+                                      norm_const);
+         break;
+   default:
+         assert(false && "Unimplemented grounding strategy");
+         break;
+   }
+   return subst;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_term_id()
+//
+//   Return an identifier for a shared term that is never reused for
+//   a different term (variables are not in the term bank and have no
+//   entry number).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long sat_term_id(Term_p term)
+{
+   return TermIsVar(term)?term->f_code:term->entry_no;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_lit_id()
+//
+//   Return an identifier for the left hand side and sign of a
+//   literal.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long sat_lit_id(Eqn_p lit)
+{
+   return 2*sat_term_id(lit->lterm)+(EqnIsPositive(lit)?1:0);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_ref_matches()
+//
+//   Return true if the clause still has the literals recorded in
+//   ref.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool sat_ref_matches(SatClauseRef_p ref, Clause_p clause)
+{
+   Eqn_p lit;
+   long  *ids = ref->lit_ids;
+
+   if(ref->lit_no != ClauseLiteralNumber(clause))
+   {
+      return false;
+   }
+   for(lit = clause->literals; lit; lit = lit->next)
+   {
+      if(ids[0] != sat_lit_id(lit) || ids[1] != sat_term_id(lit->rterm))
+      {
+         return false;
+      }
+      ids += 2;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_inc_add_ref()
+//
+//   Add the encoding of ref with its selector to the solver.
+//
+// Global Variables: -
+//
+// Side Effects    : Via PicoSAT interface
+//
+/----------------------------------------------------------------------*/
+
+static void sat_inc_add_ref(SatIncState_p state, SatClauseRef_p ref)
+{
+   int i;
+
+   for(i=0; i<ref->encoding->lit_no; i++)
+   {
+      picosat_add(state->solver, ref->encoding->literals[i]);
+   }
+   picosat_add(state->solver, -ref->selector);
+   picosat_add(state->solver, 0);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_inc_ref_alloc()
+//
+//   Encode the (grounded) clause, add it to the solver with a fresh
+//   selector and return the new reference.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, via PicoSAT interface
+//
+/----------------------------------------------------------------------*/
+
+static SatClauseRef_p sat_inc_ref_alloc(SatIncState_p state, Clause_p clause)
+{
+   SatClauseRef_p ref = SatClauseRefCellAlloc();
+   Eqn_p          lit;
+   long           *ids;
+
+   ref->source   = clause;
+   ref->encoding = SatClauseCreate(clause, state->satset);
+   ref->selector = ++state->satset->max_lit;
+   ref->lit_no   = ClauseLiteralNumber(clause);
+   ref->lit_ids  = SizeMalloc(2*MAX(ref->lit_no,1)*sizeof(long));
+   ref->check    = state->check;
+   ids = ref->lit_ids;
+   for(lit = clause->literals; lit; lit = lit->next)
+   {
+      *ids++ = sat_lit_id(lit);
+      *ids++ = sat_term_id(lit->rterm);
+   }
+   sat_inc_add_ref(state, ref);
+   state->live++;
+
+   return ref;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_inc_ref_free()
+//
+//   Free a reference and its encoding.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void sat_inc_ref_free(SatClauseRef_p junk)
+{
+   SatClauseFree(junk->encoding);
+   SizeFree(junk->lit_ids, 2*MAX(junk->lit_no,1)*sizeof(long));
+   SatClauseRefCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_inc_retire()
+//
+//   Permanently disable the clause of ref in the solver and free
+//   ref.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, via PicoSAT interface
+//
+/----------------------------------------------------------------------*/
+
+static void sat_inc_retire(SatIncState_p state, SatClauseRef_p ref)
+{
+   picosat_add(state->solver, -ref->selector);
+   picosat_add(state->solver, 0);
+   sat_inc_ref_free(ref);
+   state->live--;
+   state->retired++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_inc_targets_changed()
+//
+//   Record the terms the variables of each sort are grounded to by
+//   subst. Return true if this changes the target for any sort that
+//   had one before (so that old encodings are no longer instances
+//   under the current grounding).
+//
+// Global Variables: -
+//
+// Side Effects    : Updates state->targets
+//
+/----------------------------------------------------------------------*/
+
+static bool sat_inc_targets_changed(SatIncState_p state, Subst_p subst)
+{
+   PStackPointer i;
+   Term_p        var, target;
+   long          id, old;
+   bool          res = false;
+
+   for(i=0; i<PStackGetSP(subst); i++)
+   {
+      var    = PStackElementP(subst, i);
+      target = var->binding;
+      id     = sat_term_id(target);
+      old    = PDArrayElementInt(state->targets, var->type->type_uid);
+      if(old != id)
+      {
+         res = res || old;
+         PDArrayAssignInt(state->targets, var->type->type_uid, id);
+      }
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_refs_slot()
+//
+//   Return the slot of the reference for clause in state->refs, or
+//   the empty slot where it would go.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long sat_refs_slot(SatClauseRef_p *refs, long size, Clause_p clause)
+{
+   long i = (long)(((uint64_t)(uintptr_t)clause*SAT_REFS_HASH_MULT)>>20)
+      &(size-1);
+
+   while(refs[i] && refs[i]->source != clause)
+   {
+      i = (i+1)&(size-1);
+   }
+   return i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_refs_rehash()
+//
+//   Move the references into a fresh table of the given size. If
+//   retire is true, retire all references not seen in the current
+//   check instead of moving them.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, via PicoSAT interface
+//
+/----------------------------------------------------------------------*/
+
+static void sat_refs_rehash(SatIncState_p state, long size, bool retire)
+{
+   SatClauseRef_p *refs = SecureMalloc(size*sizeof(SatClauseRef_p));
+   SatClauseRef_p ref;
+   long           i;
+
+   memset(refs, 0, size*sizeof(SatClauseRef_p));
+   for(i=0; i<state->refs_size; i++)
+   {
+      ref = state->refs[i];
+      if(!ref)
+      {
+         continue;
+      }
+      if(retire && ref->check != state->check)
+      {
+         sat_inc_retire(state, ref);
+      }
+      else
+      {
+         refs[sat_refs_slot(refs, size, ref->source)] = ref;
+      }
+   }
+   FREE(state->refs);
+   state->refs      = refs;
+   state->refs_size = size;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_inc_import_set()
+//
+//   Make sure all clauses of set are encoded in the solver and mark
+//   them as seen in the current check. Return number of newly
+//   encoded clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, via PicoSAT interface
+//
+/----------------------------------------------------------------------*/
+
+static long sat_inc_import_set(SatIncState_p state, ClauseSet_p set)
+{
+   Clause_p       handle;
+   SatClauseRef_p ref;
+   long           i, res = 0;
+
+   for(handle = set->anchor->succ;
+       handle != set->anchor;
+       handle = handle->succ)
+   {
+      i   = sat_refs_slot(state->refs, state->refs_size, handle);
+      ref = state->refs[i];
+      if(ref)
+      {
+         if(sat_ref_matches(ref, handle))
+         {
+            ref->check = state->check;
+            continue;
+         }
+         sat_inc_retire(state, ref);
+      }
+      state->refs[i] = sat_inc_ref_alloc(state, handle);
+      res++;
+      if(2*state->live > state->refs_size)
+      {
+         sat_refs_rehash(state, 2*state->refs_size, false);
+      }
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sat_inc_new_solver()
+//
+//   Replace the solver by a fresh one containing only the live
+//   clauses. This drops retired clauses (and everything learned).
+//
+// Global Variables: -
+//
+// Side Effects    : Via PicoSAT interface
+//
+/----------------------------------------------------------------------*/
+
+static void sat_inc_new_solver(SatIncState_p state)
+{
+   long i;
+
+   if(state->solver)
+   {
+      picosat_reset(state->solver);
+   }
+   state->solver = picosat_init();
+   for(i=0; i<state->refs_size; i++)
+   {
+      if(state->refs[i])
+      {
+         sat_inc_add_ref(state, state->refs[i]);
+      }
+   }
+   state->retired = 0;
+}
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -463,6 +906,7 @@ SatClauseSet_p SatClauseSetAlloc(void)
                                // the first index!
    set->set      = PStackAlloc();
    set->exported = PStackAlloc();
+   set->atoms    = NULL;
    set->core_size = 0;
    set->set_size_limit = -1;
    return set;
@@ -496,23 +940,29 @@ void SatClauseSetFree(SatClauseSet_p junk)
    }
    PStackFree(junk->set);
    PStackFree(junk->exported);
+   if(junk->atoms)
+   {
+      PStackFree(junk->atoms);
+   }
    SatClauseSetCellFree(junk);
 }
 
 
 /*-----------------------------------------------------------------------
 //
-// Function: SatClauseCreateAndStore()
+// Function: SatClauseCreate()
 //
-//    Encode the instantiated clause as a SatClause, store it in set,
-//    and return it. 
-// Global Variables:
+//    Encode the instantiated clause as a SatClause (with the atom
+//    numbering of set) and return it. The clause is not stored in
+//    set.
 //
-// Side Effects    :
+// Global Variables: -
+//
+// Side Effects    : Memory operations, see sat_translate_literal()
 //
 /----------------------------------------------------------------------*/
 
-SatClause_p SatClauseCreateAndStore(Clause_p clause, SatClauseSet_p set)
+SatClause_p SatClauseCreate(Clause_p clause, SatClauseSet_p set)
 {
    int i;
    Eqn_p lit;
@@ -521,13 +971,6 @@ SatClause_p SatClauseCreateAndStore(Clause_p clause, SatClauseSet_p set)
    assert(clause);
    assert(set);
 
-   if(set->set_size_limit != -1 && 
-         PStackGetSP(set->set) >= set->set_size_limit)
-   {
-      return NULL;
-   }
-
-
    handle = SatClauseAlloc(ClauseLiteralNumber(clause));
    handle->source = clause;
    for(i=0, lit=clause->literals;
@@ -537,7 +980,36 @@ SatClause_p SatClauseCreateAndStore(Clause_p clause, SatClauseSet_p set)
       assert(i<handle->lit_no);
       handle->literals[i] = sat_translate_literal(lit, set);
    }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatClauseCreateAndStore()
+//
+//    Encode the instantiated clause as a SatClause, store it in set,
+//    and return it. 
+// Global Variables:
+//
+// Side Effects    :
+//
+/----------------------------------------------------------------------*/
+
+SatClause_p SatClauseCreateAndStore(Clause_p clause, SatClauseSet_p set)
+{
+   SatClause_p handle;
+
+   assert(clause);
+   assert(set);
+
+   if(set->set_size_limit != -1 && 
+         PStackGetSP(set->set) >= set->set_size_limit)
+   {
+      return NULL;
+   }
 
+   handle = SatClauseCreate(clause, set);
    PStackPushP(set->set, handle);
    return handle;
 }
@@ -881,55 +1353,7 @@ long SatClauseSetImportProofState(SatClauseSet_p satset, ProofState_p state,
 
    //printf("# SatClauseSetImportProofState()\n");
 
-   switch(strat)
-   {
-   case GMPseudoVar:
-         pseudogroundsubst = SubstPseudoGroundVarBank(state->terms->vars);
-         break;
-   case GMFirstConst:
-         pseudogroundsubst = SubstGroundVarBankFirstConst(state->terms,
-                                                          norm_const);
-         break;
-   case GMConjMinMinFreq:
-         pseudogroundsubst = SubstGroundFreqBased(state->terms,
-                                                  state->axioms,
-                                                  prefer_conj_min_min_freq,
-                                                  norm_const);
-         break;
-   case GMConjMaxMinFreq:
-         pseudogroundsubst = SubstGroundFreqBased(state->terms,
-                                                  state->axioms,
-                                                  prefer_conj_max_min_freq,
-                                                  norm_const);
-         break;
-   case GMConjMinMaxFreq:
-         pseudogroundsubst = SubstGroundFreqBased(state->terms,
-                                                  state->axioms,
-                                                  prefer_conj_min_max_freq,
-                                                  norm_const);
-         break;
-   case GMConjMaxMaxFreq:
-         pseudogroundsubst = SubstGroundFreqBased(state->terms,
-                                                  state->axioms,
-                                                  prefer_conj_max_max_freq,
-                                                  norm_const);
-         break;
-   case GMGlobalMax:
-         pseudogroundsubst = SubstGroundFreqBased(state->terms,
-                                                  state->axioms,
-                                                  prefer_global_max_freq,
-                                                  norm_const);
-         break;
-   case GMGlobalMin:
-         pseudogroundsubst = SubstGroundFreqBased(state->terms,
-                                                  state->axioms,
-                                                  prefer_global_min_freq,
-                                                  norm_const);
-         break;
-   default:
-         assert(false && "Unimplemented grounding strategy");
-         break;
-   }
+   pseudogroundsubst = sat_grounding_subst(state, strat, norm_const);
    // printf("# Pseudogrounded()\n");
 
    res += SatClauseSetImportClauseSet(satset, state->processed_pos_rules);
@@ -1084,6 +1508,228 @@ ProverResult SatClauseSetCheckUnsat(SatClauseSet_p satset, Clause_p *empty,
 }
 
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatIncStateAlloc()
+//
+//   Allocate an empty incremental SAT state. Atom terms will be
+//   protected from garbage collection in gc.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+SatIncState_p SatIncStateAlloc(GCAdmin_p gc)
+{
+   SatIncState_p handle = SatIncStateCellAlloc();
+
+   handle->solver        = NULL;
+   handle->satset        = SatClauseSetAlloc();
+   handle->satset->atoms = PStackAlloc();
+   handle->refs_size     = SAT_REFS_INIT_SIZE;
+   handle->refs          = SecureMalloc(SAT_REFS_INIT_SIZE*sizeof(SatClauseRef_p));
+   memset(handle->refs, 0, SAT_REFS_INIT_SIZE*sizeof(SatClauseRef_p));
+   handle->targets       = PDIntArrayAlloc(8, 8);
+   handle->gc            = gc;
+   handle->check         = 0;
+   handle->live          = 0;
+   handle->retired       = 0;
+   handle->core_size     = 0;
+   GCRegisterTermStack(gc, handle->satset->atoms);
+   sat_inc_new_solver(handle);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatIncStateFree()
+//
+//   Free an incremental SAT state (including the solver).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SatIncStateFree(SatIncState_p junk)
+{
+   SatIncStateReset(junk);
+   picosat_reset(junk->solver);
+   GCDeregisterTermStack(junk->gc, junk->satset->atoms);
+   FREE(junk->refs);
+   SatClauseSetFree(junk->satset);
+   PDArrayFree(junk->targets);
+   SatIncStateCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatIncStateReset()
+//
+//   Forget all clauses and atoms and start over with a fresh solver.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, via PicoSAT interface
+//
+/----------------------------------------------------------------------*/
+
+void SatIncStateReset(SatIncState_p state)
+{
+   long i;
+
+   for(i=0; i<state->refs_size; i++)
+   {
+      if(state->refs[i])
+      {
+         sat_inc_ref_free(state->refs[i]);
+         state->refs[i] = NULL;
+      }
+   }
+   state->live = 0;
+   if(state->satset->renumber_index)
+   {
+      PDRangeArrFree(state->satset->renumber_index);
+      state->satset->renumber_index = NULL;
+   }
+   state->satset->max_lit = 0;
+   PStackReset(state->satset->atoms);
+   sat_inc_new_solver(state);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatIncStateUpdate()
+//
+//   Bring satstate up to date with the (grounded) clauses in the
+//   proof state. Only clauses that are new (or have changed) since
+//   the last update are grounded and added to the solver, clauses
+//   that are gone are retired. If the grounding substitution has
+//   changed, the state is rebuilt from scratch. Returns the number
+//   of newly encoded clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, inserts terms into
+//                   state->terms, via PicoSAT interface.
+//
+/----------------------------------------------------------------------*/
+
+long SatIncStateUpdate(SatIncState_p satstate, ProofState_p state,
+                       GroundingStrategy strat, bool norm_const)
+{
+   Subst_p subst;
+   long    res = 0;
+
+   subst = sat_grounding_subst(state, strat, norm_const);
+   if(sat_inc_targets_changed(satstate, subst))
+   {
+      SatIncStateReset(satstate);
+   }
+   satstate->check++;
+   res += sat_inc_import_set(satstate, state->processed_pos_rules);
+   res += sat_inc_import_set(satstate, state->processed_pos_eqns);
+   res += sat_inc_import_set(satstate, state->processed_neg_units);
+   res += sat_inc_import_set(satstate, state->processed_non_units);
+   res += sat_inc_import_set(satstate, state->unprocessed);
+   SubstDelete(subst);
+
+   sat_refs_rehash(satstate, satstate->refs_size, true);
+   if(satstate->retired > satstate->live)
+   {
+      sat_inc_new_solver(satstate);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SatIncStateCheckUnsat()
+//
+//   Check the clauses of satstate (as of the last update) for
+//   unsatisfiability. If unsat is shown, *empty is set to the empty
+//   clause, derived from the clauses of the failed assumptions.
+//
+// Global Variables: -
+//
+// Side Effects    : Runs SAT solver, memory operations
+//
+/----------------------------------------------------------------------*/
+
+ProverResult SatIncStateCheckUnsat(SatIncState_p satstate, Clause_p *empty,
+                                   int sat_check_decision_limit)
+{
+   ProverResult   res;
+   int            solverres;
+   long           i;
+   SatClauseRef_p ref;
+   Clause_p       parent;
+
+   for(i=0; i<satstate->refs_size; i++)
+   {
+      if((ref = satstate->refs[i]))
+      {
+         picosat_assume(satstate->solver, ref->selector);
+      }
+   }
+
+   /* PicoSAT counts each assumption as a decision */
+   if(sat_check_decision_limit >= 0)
+   {
+      sat_check_decision_limit += satstate->live;
+   }
+   solverres = picosat_sat(satstate->solver, sat_check_decision_limit);
+
+   switch(solverres)
+   {
+   case PICOSAT_SATISFIABLE:
+         res = PRSatisfiable;
+         break;
+   case PICOSAT_UNSATISFIABLE:
+         res = PRUnsatisfiable;
+         break;
+   default:
+         res = PRGaveUp;
+   }
+
+   if(res == PRUnsatisfiable)
+   {
+      PStack_p unsat_core = PStackAlloc();
+
+      fprintf(GlobalOut, "# SatCheck found unsatisfiable ground set\n");
+      *empty = EmptyClauseAlloc();
+      for(i=0; i<satstate->refs_size; i++)
+      {
+         ref = satstate->refs[i];
+         if(ref && picosat_failed_assumption(satstate->solver, ref->selector))
+         {
+            PStackPushP(unsat_core, ref->source);
+         }
+      }
+      satstate->core_size = PStackGetSP(unsat_core);
+      assert(!PStackEmpty(unsat_core));
+      parent = PStackPopP(unsat_core);
+      ClausePushDerivation(*empty, DCSatGen, parent, NULL);
+      while(!PStackEmpty(unsat_core))
+      {
+         parent = PStackPopP(unsat_core);
+         ClausePushDerivation(*empty, DCCnfAddArg, parent, NULL);
+      }
+      PStackFree(unsat_core);
+   }
+   return res;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
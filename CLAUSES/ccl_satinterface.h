@@ -18,6 +18,7 @@
   Changes
 
   Created: Fri Sep 15 20:29:49 CEST 2017
+  Sat Oct 17 2026: Incremental checking with a persistent solver.
 
   -----------------------------------------------------------------------*/
 
@@ -50,6 +51,7 @@ typedef struct satclausesetcell
    int          max_lit;
    PStack_p     set;            // Actual set (clauses must be freed)
    PStack_p     exported;       // Subset of clauses exported to the solver state
+   PStack_p     atoms;          // If non-NULL, atom terms by number-1
    long         core_size;      // Size of the unsat core, if any
    long         set_size_limit; // Limit after which insertions will fail
                                 // if -1 no limit is set.
@@ -72,6 +74,44 @@ typedef enum
 typedef bool (*SatClauseFilter)(SatClause_p);
 typedef PicoSAT* SatSolver_p;
 
+
+/* A clause of the proof state as known to an incremental SAT
+   state. The clause is identified by the entry numbers of its
+   literal terms (which are never reused), so that clauses changed in
+   place are recognized and re-encoded. */
+
+typedef struct satclauserefcell
+{
+   Clause_p    source;
+   SatClause_p encoding;   // Ground instance, without the selector
+   int         selector;   // Activation variable, assumed true
+   int         lit_no;
+   long        *lit_ids;   // lterm (with sign) and rterm per literal
+   long        check;      // Number of the last check that saw it
+}SatClauseRefCell, *SatClauseRef_p;
+
+
+/* Persistent solver state for incremental SAT checking. Every
+   encoded clause C is added as C|-s for a fresh selector s, and s is
+   assumed for all clauses still in the proof state. Clauses that
+   disappear are retired by adding the unit -s. Atom terms are
+   protected from garbage collection, so that the atom numbering
+   stays valid between checks. */
+
+typedef struct satincstatecell
+{
+   SatSolver_p    solver;
+   SatClauseSet_p satset;    // Atom numbering (satset->set is unused)
+   SatClauseRef_p *refs;     // Open addressing, hashed by source
+   long           refs_size; // Power of 2
+   PDArray_p      targets;   // Grounding target id per sort
+   GCAdmin_p      gc;
+   long           check;
+   long           live;      // Clauses currently assumed
+   long           retired;   // Retired clauses still in the solver
+   long           core_size;
+}SatIncStateCell, *SatIncState_p;
+
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
@@ -84,6 +124,9 @@ extern char* GroundingStratNames[];
 SatClause_p SatClauseAlloc(int lit_no);
 void        SatClauseFree(SatClause_p junk);
 
+#define SatClauseRefCellAlloc()    (SatClauseRefCell*)SizeMalloc(sizeof(SatClauseRefCell))
+#define SatClauseRefCellFree(junk) SizeFree(junk, sizeof(SatClauseRefCell))
+
 #define SatClauseSetCellAlloc()    (SatClauseSetCell*)SizeMalloc(sizeof(SatClauseSetCell))
 #define SatClauseSetCellFree(junk) SizeFree(junk, sizeof(SatClauseSetCell))
 
@@ -100,6 +143,7 @@ void           SatClauseSetFree(SatClauseSet_p junk);
 #define SatClauseSetCoreSize(satset) (satset)->core_size
 
 
+SatClause_p SatClauseCreate(Clause_p clause, SatClauseSet_p set);
 SatClause_p SatClauseCreateAndStore(Clause_p clause, SatClauseSet_p set);
 void        SatClausePrint(FILE* out, SatClause_p satclause);
 
@@ -121,6 +165,19 @@ ProverResult SatClauseSetCheckUnsat(SatClauseSet_p satset, Clause_p *empty,
                                     SatSolver_p solver,
                                     int sat_check_decision_level);
 
+#define SatIncStateCellAlloc()    (SatIncStateCell*)SizeMalloc(sizeof(SatIncStateCell))
+#define SatIncStateCellFree(junk) SizeFree(junk, sizeof(SatIncStateCell))
+
+#define SatIncStateLiveClauses(state) ((state)->live)
+#define SatIncStateCoreSize(state)    ((state)->core_size)
+
+SatIncState_p SatIncStateAlloc(GCAdmin_p gc);
+void          SatIncStateFree(SatIncState_p junk);
+void          SatIncStateReset(SatIncState_p state);
+long          SatIncStateUpdate(SatIncState_p satstate, ProofState_p state,
+                                GroundingStrategy strat, bool norm_const);
+ProverResult  SatIncStateCheckUnsat(SatIncState_p satstate, Clause_p *empty,
+                                    int sat_check_decision_limit);
 
 
 #endif
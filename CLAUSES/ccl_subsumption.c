@@ -17,6 +17,16 @@
   Changes
 
   Created: Sun Jun  7 15:12:29 MET DST 1998
+  Fri Oct 16 2026: ClauseSetFindFVSubsumedClausesPar(), statistics
+  counters are thread local.
+  Sat Oct 17 2026: ClauseSetFindMultiSubsumerCandidates(), scratch
+  substitutions.
+  Sat Oct 17 2026: ParSubsumeAlloc(), helpers copy the subsumer into
+  private banks.
+  Sat Oct 17 2026: Helpers free their banks and substitution pools
+  themselves, their substitution statistics are counted.
+  Sat Oct 17 2026: ClauseSetFindFVSubsumersPar() for forward
+  subsumption of a batch of clauses.
 
   -----------------------------------------------------------------------*/
 
@@ -31,16 +41,45 @@ PERF_CTR_DEFINE(SetSubsumeTimer);
 PERF_CTR_DEFINE(SubsumeTimer);
 
 bool StrongUnitForwardSubsumption     = false;
-long ClauseClauseSubsumptionCalls     = 0;
-long ClauseClauseSubsumptionCallsRec  = 0;
-long ClauseClauseSubsumptionSuccesses = 0;
-long UnitClauseClauseSubsumptionCalls = 0;
+THREAD_LOCAL long ClauseClauseSubsumptionCalls     = 0;
+THREAD_LOCAL long ClauseClauseSubsumptionCallsRec  = 0;
+THREAD_LOCAL long ClauseClauseSubsumptionSuccesses = 0;
+THREAD_LOCAL long UnitClauseClauseSubsumptionCalls = 0;
 
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
 /*---------------------------------------------------------------------*/
 
+/* Shared data of the workers in ClauseSetFindFVSubsumedClausesPar() */
+
+typedef struct par_subsume_job
+{
+   ParSubsume_p par;
+   Clause_p     subsumer;
+   PStack_p     cands;       /* Candidates to test */
+   long         cand_no;
+   char         *subsumed;   /* Result flag per candidate */
+   long         (*counters)[6]; /* Statistics of the helper threads */
+}ParSubsumeJob;
+
+/* Shared data of the workers in ClauseSetFindFVSubsumersPar() */
+
+typedef struct par_fw_subsume_job
+{
+   ParSubsume_p par;
+   int          workers;     /* Instances of the job that run */
+   PStack_p     cands;       /* Candidate subsumers, each followed by
+                                the set of members it may subsume */
+   long         cand_no;
+   PStack_p     members;     /* At most MULTI_SUBSUMER_MAX clauses */
+   long         (*first)[MULTI_SUBSUMER_MAX]; /* Per worker and member:
+                                                 Index of the first
+                                                 subsumer found, or
+                                                 -1 */
+   long         (*counters)[6]; /* Statistics of the helper threads */
+}ParFWSubsumeJob;
+
 
 /*---------------------------------------------------------------------*/
 /*                         Internal Functions                          */
@@ -188,7 +227,7 @@ Clause_p unit_clause_set_subsumes_clause(ClauseSet_p set,
 
 static bool eqn_topsubsumes_termpair(Eqn_p eqn, Term_p t1, Term_p t2)
 {
-   Subst_p subst = SubstAlloc();
+   Subst_p subst = SubstBorrow();
    bool    res = false;
 
    assert(eqn);
@@ -209,7 +248,7 @@ static bool eqn_topsubsumes_termpair(Eqn_p eqn, Term_p t1, Term_p t2)
          res = true;
       }
    }
-   SubstDelete(subst);
+   SubstReturn(subst);
 
    return res;
 }
@@ -295,7 +334,7 @@ static bool eqn_subsumes_termpair(Eqn_p eqn, Term_p t1, Term_p t2)
 /* Old version used for comparison only */
 Eqn_p find_spec_literal_old(Eqn_p lit, Eqn_p list)
 {
-   Subst_p subst = SubstAlloc();
+   Subst_p subst = SubstBorrow();
 
    for(;list;list = list->next)
    {
@@ -324,7 +363,7 @@ Eqn_p find_spec_literal_old(Eqn_p lit, Eqn_p list)
       }
       SubstBacktrack(subst);
    }
-   SubstDelete(subst);
+   SubstReturn(subst);
    return list;
 }
 #endif
@@ -332,7 +371,7 @@ Eqn_p find_spec_literal_old(Eqn_p lit, Eqn_p list)
 /* New version using ordering */
 static Eqn_p find_spec_literal(Eqn_p lit, Eqn_p list)
 {
-   Subst_p subst = SubstAlloc();
+   Subst_p subst = SubstBorrow();
    int cmpres;
 
    for(;list;list = list->next)
@@ -374,7 +413,7 @@ static Eqn_p find_spec_literal(Eqn_p lit, Eqn_p list)
       }
       SubstBacktrack(subst);
    }
-   SubstDelete(subst);
+   SubstReturn(subst);
    return list;
 }
 
@@ -680,7 +719,7 @@ static bool clause_subsumes_clause(Clause_p subsumer, Clause_p
       PERF_CTR_EXIT(SubsumeTimer);
       return false;
    }
-   subst = SubstAlloc();
+   subst = SubstBorrow();
    ClauseClauseSubsumptionCallsRec++;
 
    pick_list = IntArrayAlloc(ClauseLiteralNumber(sub_candidate));
@@ -690,7 +729,7 @@ static bool clause_subsumes_clause(Clause_p subsumer, Clause_p
                               pick_list);
    IntArrayFree(pick_list, ClauseLiteralNumber(sub_candidate));
 
-   SubstDelete(subst);
+   SubstReturn(subst);
 
    PERF_CTR_EXIT(SubsumeTimer);
 
@@ -1149,10 +1188,664 @@ Clause_p clauseset_find_variant_clause_indexed(FVIndex_p index,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: clause_set_subsumes_clause_columns()
+//
+//   Return a clause from the column store cols that subsumes
+//   vec->clause, or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static
+Clause_p clause_set_subsumes_clause_columns(FVIColumns_p cols,
+                                            FreqVector_p vec)
+{
+   FVIColumnsIter_p iter = FVIColumnsIterAlloc(cols, vec, FVICandSubsumes);
+   Clause_p         clause;
+
+   assert(vec->clause->weight == ClauseStandardWeight(vec->clause));
+
+   while((clause = FVIColumnsIterNext(iter)))
+   {
+      if(clause_subsumes_clause(clause, vec->clause))
+      {
+         break;
+      }
+   }
+   FVIColumnsIterFree(iter);
+   return clause;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clauseset_find_subsumed_clauses_columns()
+//
+//   Find all clauses in the column store cols that are subsumed by
+//   vec->clause and push them onto res. If first is true, stop after
+//   the first one and return it.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static
+Clause_p clauseset_find_subsumed_clauses_columns(FVIColumns_p cols,
+                                                 FreqVector_p vec,
+                                                 PStack_p res,
+                                                 bool first)
+{
+   FVIColumnsIter_p iter = FVIColumnsIterAlloc(cols, vec, FVICandSubsumed);
+   Clause_p         clause;
+
+   assert(vec->clause->weight == ClauseStandardWeight(vec->clause));
+
+   while((clause = FVIColumnsIterNext(iter)))
+   {
+      if(clause_subsumes_clause(vec->clause, clause))
+      {
+         if(first)
+         {
+            break;
+         }
+         PStackPushP(res, clause);
+      }
+   }
+   FVIColumnsIterFree(iter);
+   return clause;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clauseset_find_variant_clause_columns()
+//
+//   Find and return a variant of vec->clause in the column store
+//   cols, or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static
+Clause_p clauseset_find_variant_clause_columns(FVIColumns_p cols,
+                                               FreqVector_p vec)
+{
+   FVIColumnsIter_p iter = FVIColumnsIterAlloc(cols, vec, FVICandVariant);
+   Clause_p         clause;
+
+   while((clause = FVIColumnsIterNext(iter)))
+   {
+      if(clause_subsumes_clause(clause, vec->clause) &&
+         clause_subsumes_clause(vec->clause, clause))
+      {
+         break;
+      }
+   }
+   FVIColumnsIterFree(iter);
+   return clause;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_tree_collect_clauses()
+//
+//   Push all clauses from tree onto res, in the order in which
+//   clause_tree_find_subsumed_clauses() visits them.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static
+void clause_tree_collect_clauses(PTree_p tree, PStack_p res)
+{
+   if(!tree)
+   {
+      return;
+   }
+   PStackPushP(res, tree->key);
+   clause_tree_collect_clauses(tree->lson, res);
+   clause_tree_collect_clauses(tree->rson, res);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clauseset_collect_subsumed_candidates_indexed()
+//
+//   Push all clauses in index that pass the feature vector test for
+//   being subsumed by vec->clause onto res (in the same order as
+//   clauseset_find_subsumed_clauses_indexed()).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static
+void clauseset_collect_subsumed_candidates_indexed(FVIndex_p index,
+                                                   FreqVector_p vec,
+                                                   long feature,
+                                                   PStack_p res)
+{
+   if(feature == vec->size)
+   {
+      clause_tree_collect_clauses(index->u1.clauses, res);
+   }
+   else if(index->u1.successors)
+   {
+      long i;
+      FVIndex_p next;
+      IntMapIter_p iter;
+
+      iter = IntMapIterAlloc(index->u1.successors, vec->array[feature], LONG_MAX);
+
+      while((next = IntMapIterNext(iter, &i)))
+      {
+         if(next->clause_count)
+         {
+            clauseset_collect_subsumed_candidates_indexed(next, vec,
+                                                          feature+1, res);
+         }
+      }
+      IntMapIterFree(iter);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clauseset_collect_subsumed_candidates()
+//
+//   Push all clauses from set that may be subsumed by subsumer
+//   (according to the feature vector index, if any) onto res.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static
+void clauseset_collect_subsumed_candidates(ClauseSet_p set,
+                                           FVPackedClause_p subsumer,
+                                           PStack_p res)
+{
+   Clause_p handle;
+
+   if(set->fvindex && set->fvindex->columns)
+   {
+      FVIColumnsIter_p iter = FVIColumnsIterAlloc(set->fvindex->columns,
+                                                  subsumer,
+                                                  FVICandSubsumed);
+      while((handle = FVIColumnsIterNext(iter)))
+      {
+         PStackPushP(res, handle);
+      }
+      FVIColumnsIterFree(iter);
+   }
+   else if(set->fvindex)
+   {
+      clauseset_collect_subsumed_candidates_indexed(set->fvindex->index,
+                                                    subsumer, 0, res);
+   }
+   else
+   {
+      for(handle = set->anchor->succ;
+          handle!= set->anchor;
+          handle = handle->succ)
+      {
+         PStackPushP(res, handle);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: multi_subsumer_mask()
+//
+//   Return the subset of mask (a set of indices into vecs) of the
+//   vectors whose value for feature is at least value.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline uint64_t multi_subsumer_mask(PStack_p vecs, long feature,
+                                           long value, uint64_t mask)
+{
+   uint64_t rest = mask;
+   int      j;
+
+   while(rest)
+   {
+      j = __builtin_ctzll(rest);
+      rest &= rest-1;
+      if(value > ((FreqVector_p)PStackElementP(vecs, j))->array[feature])
+      {
+         mask &= ~(UINT64_C(1)<<j);
+      }
+   }
+   return mask;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_tree_collect_multi_candidates()
+//
+//   Push all clauses from tree, each followed by mask, onto res.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static
+void clause_tree_collect_multi_candidates(PTree_p tree, uint64_t mask,
+                                          PStack_p res)
+{
+   if(!tree)
+   {
+      return;
+   }
+   PStackPushP(res, tree->key);
+   PStackPushInt(res, (long)mask);
+   clause_tree_collect_multi_candidates(tree->lson, mask, res);
+   clause_tree_collect_multi_candidates(tree->rson, mask, res);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clauseset_collect_multi_subsumers_indexed()
+//
+//   Traverse index once for all vectors in vecs. bound is the
+//   componentwise maximum of vecs, mask is the set of vectors that
+//   are still compatible with the path to index. Push all clauses
+//   compatible with at least one vector, together with the set of
+//   these vectors, onto res.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static
+void clauseset_collect_multi_subsumers_indexed(FVIndex_p index,
+                                               PStack_p vecs,
+                                               FreqVector_p bound,
+                                               long feature,
+                                               uint64_t mask,
+                                               PStack_p res)
+{
+   if(feature == bound->size)
+   {
+      clause_tree_collect_multi_candidates(index->u1.clauses, mask, res);
+   }
+   else if(index->u1.successors)
+   {
+      long i;
+      uint64_t next_mask;
+      FVIndex_p next;
+      IntMapIter_p iter;
+
+      iter = IntMapIterAlloc(index->u1.successors, 0, bound->array[feature]);
+      while((next = IntMapIterNext(iter, &i)))
+      {
+         if(next->clause_count &&
+            (next_mask = multi_subsumer_mask(vecs, feature, i, mask)))
+         {
+            clauseset_collect_multi_subsumers_indexed(next, vecs, bound,
+                                                      feature+1,
+                                                      next_mask, res);
+         }
+      }
+      IntMapIterFree(iter);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: clauseset_collect_multi_subsumers_columns()
+//
+//   As clauseset_collect_multi_subsumers_indexed(), but for a column
+//   store. The stored values are saturated, which can only make the
+//   test more permissive.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static
+void clauseset_collect_multi_subsumers_columns(FVIColumns_p cols,
+                                               PStack_p vecs,
+                                               FreqVector_p bound,
+                                               uint64_t mask,
+                                               PStack_p res)
+{
+   FVIColumnsIter_p iter = FVIColumnsIterAlloc(cols, bound, FVICandSubsumes);
+   Clause_p         handle;
+   uint64_t         cand_mask;
+   long             f;
+
+   while((handle = FVIColumnsIterNext(iter)))
+   {
+      cand_mask = mask;
+      for(f=0; cand_mask && (f<bound->size); f++)
+      {
+         cand_mask = multi_subsumer_mask(vecs, f,
+                                         FVIColumnsIterValue(iter, f),
+                                         cand_mask);
+      }
+      if(cand_mask)
+      {
+         PStackPushP(res, handle);
+         PStackPushInt(res, (long)cand_mask);
+      }
+   }
+   FVIColumnsIterFree(iter);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: par_subsume_worker()
+//
+//   Test every workers-th candidate (starting at worker) against the
+//   subsumer. Worker 0 (the calling thread) uses the subsumer itself.
+//   Every other worker uses a variable-disjoint copy of it in its own
+//   private bank, which is created on first use. Both the bank and
+//   the copy are allocated in the helper thread, so the memory state
+//   of the calling thread (and with it the proof search) is the same
+//   for any number of workers. The copy keeps the literal order and
+//   the weight of the subsumer. Ground subsumers are not copied.
+//   Helper threads record their statistics in job->counters.
+//
+// Global Variables: ClauseClauseSubsumptionCalls,
+//                   ClauseClauseSubsumptionCallsRec,
+//                   ClauseClauseSubsumptionSuccesses,
+//                   UnitClauseClauseSubsumptionCalls,
+//                   SubstBorrowCount, SubstBorrowAllocCount
+//
+// Side Effects    : Memory operations in the helper threads, binds
+//                   variables of the subsumer copy only.
+//
+/----------------------------------------------------------------------*/
+
+static
+void par_subsume_worker(void* data, int worker)
+{
+   ParSubsumeJob *job = data;
+   int           workers = ThreadPoolWorkers(job->par->pool);
+   Clause_p      subsumer = job->subsumer;
+   ClauseCell    copy;
+   TB_p          bank = NULL;
+   long          i;
+
+   if(worker)
+   {
+      ClauseClauseSubsumptionCalls     = 0;
+      ClauseClauseSubsumptionCallsRec  = 0;
+      ClauseClauseSubsumptionSuccesses = 0;
+      UnitClauseClauseSubsumptionCalls = 0;
+      SubstBorrowCount                 = 0;
+      SubstBorrowAllocCount            = 0;
+
+      if(!ClauseIsGround(subsumer))
+      {
+         if(!job->par->banks[worker])
+         {
+            job->par->banks[worker] = TBArenaAlloc(job->par->sig);
+         }
+         bank = job->par->banks[worker];
+         copy = *subsumer;
+         copy.literals = EqnListCopy(subsumer->literals, bank);
+         copy.set      = NULL;
+         copy.pred     = NULL;
+         copy.succ     = NULL;
+         subsumer      = &copy;
+         assert(ClauseIsSubsumeOrdered(subsumer));
+      }
+   }
+   for(i=worker; i<job->cand_no; i+=workers)
+   {
+      job->subsumed[i] =
+         clause_subsumes_clause(subsumer, PStackElementP(job->cands, i));
+   }
+   if(worker)
+   {
+      if(bank)
+      {
+         EqnListFree(copy.literals);
+         TBArenaReset(bank);
+      }
+      job->counters[worker][0] = ClauseClauseSubsumptionCalls;
+      job->counters[worker][1] = ClauseClauseSubsumptionCallsRec;
+      job->counters[worker][2] = ClauseClauseSubsumptionSuccesses;
+      job->counters[worker][3] = UnitClauseClauseSubsumptionCalls;
+      job->counters[worker][4] = SubstBorrowCount;
+      job->counters[worker][5] = SubstBorrowAllocCount;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: par_subsume_free_worker()
+//
+//   Free the private bank of the worker. This has to happen in the
+//   helper thread that allocated it, as its memory is released with
+//   the thread's arena when the thread terminates.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static
+void par_subsume_free_worker(void* data, int worker)
+{
+   ParSubsume_p par = data;
+
+   if(worker && par->banks[worker])
+   {
+      par->banks[worker]->sig = NULL;
+      TBFree(par->banks[worker]);
+      par->banks[worker] = NULL;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: par_fw_subsume_worker()
+//
+//   Test every workers-th candidate subsumer (starting at worker)
+//   against the members it may subsume, and record for each member
+//   the index of the first subsumer found by this worker. Candidates
+//   are only tested against members that have not yet been subsumed
+//   by an earlier candidate of the same worker. As in
+//   par_subsume_worker(), helpers bind variables only in copies of
+//   the subsumers in their own banks, and record their statistics in
+//   job->counters.
+//
+// Global Variables: ClauseClauseSubsumptionCalls,
+//                   ClauseClauseSubsumptionCallsRec,
+//                   ClauseClauseSubsumptionSuccesses,
+//                   UnitClauseClauseSubsumptionCalls,
+//                   SubstBorrowCount, SubstBorrowAllocCount
+//
+// Side Effects    : Memory operations in the helper threads, binds
+//                   variables of the subsumer copies only.
+//
+/----------------------------------------------------------------------*/
+
+static
+void par_fw_subsume_worker(void* data, int worker)
+{
+   ParFWSubsumeJob *job = data;
+   int           workers = job->workers;
+   long          *first = job->first[worker];
+   long          member_no = PStackGetSP(job->members), i, j;
+   uint64_t      open, rest;
+   Clause_p      subsumer;
+   ClauseCell    copy;
+   TB_p          bank = NULL;
+
+   if(worker)
+   {
+      ClauseClauseSubsumptionCalls     = 0;
+      ClauseClauseSubsumptionCallsRec  = 0;
+      ClauseClauseSubsumptionSuccesses = 0;
+      UnitClauseClauseSubsumptionCalls = 0;
+      SubstBorrowCount                 = 0;
+      SubstBorrowAllocCount            = 0;
+
+      if(!job->par->banks[worker])
+      {
+         job->par->banks[worker] = TBArenaAlloc(job->par->sig);
+      }
+      bank = job->par->banks[worker];
+   }
+   for(j=0; j<member_no; j++)
+   {
+      first[j] = -1;
+   }
+   open = (member_no == MULTI_SUBSUMER_MAX)?
+      ~UINT64_C(0):((UINT64_C(1)<<member_no)-1);
+
+   for(i=worker; open && (i<job->cand_no); i+=workers)
+   {
+      rest = (uint64_t)PStackElementInt(job->cands, 2*i+1) & open;
+      if(!rest)
+      {
+         continue;
+      }
+      subsumer = PStackElementP(job->cands, 2*i);
+      if(bank && !ClauseIsGround(subsumer))
+      {
+         copy = *subsumer;
+         copy.literals = EqnListCopy(subsumer->literals, bank);
+         copy.set      = NULL;
+         copy.pred     = NULL;
+         copy.succ     = NULL;
+         subsumer      = &copy;
+         assert(ClauseIsSubsumeOrdered(subsumer));
+      }
+      while(rest)
+      {
+         j = __builtin_ctzll(rest);
+         rest &= rest-1;
+         if(clause_subsumes_clause(subsumer,
+                                   PStackElementP(job->members, j)))
+         {
+            first[j] = i;
+            open &= ~(UINT64_C(1)<<j);
+         }
+      }
+      if(subsumer == &copy)
+      {
+         EqnListFree(copy.literals);
+      }
+   }
+   if(worker)
+   {
+      TBArenaReset(bank);
+      job->counters[worker][0] = ClauseClauseSubsumptionCalls;
+      job->counters[worker][1] = ClauseClauseSubsumptionCallsRec;
+      job->counters[worker][2] = ClauseClauseSubsumptionSuccesses;
+      job->counters[worker][3] = UnitClauseClauseSubsumptionCalls;
+      job->counters[worker][4] = SubstBorrowCount;
+      job->counters[worker][5] = SubstBorrowAllocCount;
+   }
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: ParSubsumeAlloc()
+//
+//   Allocate a context for parallel subsumption with the
+//   given number of workers (including the calling thread) for
+//   clauses over sig.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, starts threads
+//
+/----------------------------------------------------------------------*/
+
+ParSubsume_p ParSubsumeAlloc(Sig_p sig, int workers)
+{
+   ParSubsume_p handle = ParSubsumeCellAlloc();
+   int          w;
+
+   /* Helpers borrow scratch substitutions from their own pools */
+   ThreadPoolAddExitHook(SubstPoolFree);
+   handle->pool  = ThreadPoolAlloc(workers);
+   handle->sig   = sig;
+   handle->banks = SizeMalloc(workers*sizeof(TB_p));
+   for(w=0; w<workers; w++)
+   {
+      handle->banks[w] = NULL;
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ParSubsumeFree()
+//
+//   Free a parallel subsumption context. The helpers free their
+//   banks (and, when they terminate, their substitution pools)
+//   themselves.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, stops threads
+//
+/----------------------------------------------------------------------*/
+
+void ParSubsumeFree(ParSubsume_p junk)
+{
+   int workers = ThreadPoolWorkers(junk->pool);
+
+   ThreadPoolRun(junk->pool, par_subsume_free_worker, junk);
+   SizeFree(junk->banks, workers*sizeof(TB_p));
+   ThreadPoolFree(junk->pool);
+   ParSubsumeCellFree(junk);
+}
+
+
 
 /*-----------------------------------------------------------------------
 //
@@ -1445,8 +2138,16 @@ Clause_p ClauseSetSubsumesFVPackedClause(ClauseSet_p set,
 
    if(set->fvindex && sub_candidate->array)
    {
-      res = clause_set_subsumes_clause_indexed(set->fvindex->index,
-                                               sub_candidate, 0);
+      if(set->fvindex->columns)
+      {
+         res = clause_set_subsumes_clause_columns(set->fvindex->columns,
+                                                  sub_candidate);
+      }
+      else
+      {
+         res = clause_set_subsumes_clause_indexed(set->fvindex->index,
+                                                  sub_candidate, 0);
+      }
       PERF_CTR_EXIT(SetSubsumeTimer);
       return res;
    }
@@ -1480,7 +2181,14 @@ Clause_p ClauseSetSubsumesClause(ClauseSet_p set, Clause_p sub_candidate)
       FreqVector_p vec = OptimizedVarFreqVectorCompute(sub_candidate,
                                                        set->fvindex->perm_vector,
                                                        set->fvindex->cspec);
-      res =  clause_set_subsumes_clause_indexed(set->fvindex->index, vec, 0);
+      if(set->fvindex->columns)
+      {
+         res = clause_set_subsumes_clause_columns(set->fvindex->columns, vec);
+      }
+      else
+      {
+         res = clause_set_subsumes_clause_indexed(set->fvindex->index, vec, 0);
+      }
       FreqVectorFree(vec);
       PERF_CTR_EXIT(SetSubsumeTimer);
       return res;
@@ -1491,6 +2199,71 @@ Clause_p ClauseSetSubsumesClause(ClauseSet_p set, Clause_p sub_candidate)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetFindMultiSubsumerCandidates()
+//
+//   vecs is a stack of at most MULTI_SUBSUMER_MAX feature vectors
+//   (computed for the index of set). Find all clauses in set that
+//   pass the feature vector test for subsuming the clause of at
+//   least one of them, with a single traversal of the index. Push
+//   each such clause onto res, followed by the bit set (as an int)
+//   of the indices of the vectors it is compatible with. Return the
+//   number of clauses found.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long ClauseSetFindMultiSubsumerCandidates(ClauseSet_p set, PStack_p vecs,
+                                          PStack_p res)
+{
+   long         old_sp = PStackGetSP(res), i, j;
+   uint64_t     mask;
+   FreqVector_p bound, vec;
+
+   assert(set->fvindex);
+   assert(!PStackEmpty(vecs));
+   assert(PStackGetSP(vecs) <= MULTI_SUBSUMER_MAX);
+
+   PERF_CTR_ENTRY(SetSubsumeTimer);
+   vec   = PStackElementP(vecs, 0);
+   bound = FreqVectorAlloc(vec->size);
+   for(i=0; i<vec->size; i++)
+   {
+      bound->array[i] = vec->array[i];
+   }
+   for(j=1; j<PStackGetSP(vecs); j++)
+   {
+      vec = PStackElementP(vecs, j);
+      assert(vec->size == bound->size);
+      for(i=0; i<vec->size; i++)
+      {
+         bound->array[i] = MAX(bound->array[i], vec->array[i]);
+      }
+   }
+   mask = (PStackGetSP(vecs) == MULTI_SUBSUMER_MAX)?
+      ~UINT64_C(0):((UINT64_C(1)<<PStackGetSP(vecs))-1);
+
+   if(set->fvindex->columns)
+   {
+      clauseset_collect_multi_subsumers_columns(set->fvindex->columns, vecs,
+                                                bound, mask, res);
+   }
+   else
+   {
+      clauseset_collect_multi_subsumers_indexed(set->fvindex->index, vecs,
+                                                bound, 0, mask, res);
+   }
+   FreqVectorFree(bound);
+   PERF_CTR_EXIT(SetSubsumeTimer);
+
+   return (PStackGetSP(res)-old_sp)/2;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseSetFindSubsumedClause()
@@ -1549,7 +2322,12 @@ long ClauseSetFindFVSubsumedClauses(ClauseSet_p set,
    PERF_CTR_ENTRY(SetSubsumeTimer);
    assert(subsumer->clause->weight == ClauseStandardWeight(subsumer->clause));
 
-   if(set->fvindex)
+   if(set->fvindex && set->fvindex->columns)
+   {
+      clauseset_find_subsumed_clauses_columns(set->fvindex->columns,
+                                              subsumer, res, false);
+   }
+   else if(set->fvindex)
    {
       clauseset_find_subsumed_clauses_indexed(set->fvindex->index,
                                               subsumer, 0, res);
@@ -1564,6 +2342,213 @@ long ClauseSetFindFVSubsumedClauses(ClauseSet_p set,
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetFindFVSubsumedClausesPar()
+//
+//   As ClauseSetFindFVSubsumedClauses(), but distribute the
+//   subsumption tests over the workers of par. Candidates are
+//   collected from the index first, each worker tests its share
+//   against its own variable-disjoint copy of the subsumer, and the
+//   subsumed clauses are pushed in candidate order. The copies are
+//   made by the helper threads in their private banks, so the result
+//   and all side effects are the same as for the sequential version. Falls back
+//   to sequential testing for few candidates, for higher-order
+//   problems, and if the memory management is not thread safe.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, runs jobs in par->pool
+//
+/----------------------------------------------------------------------*/
+
+long ClauseSetFindFVSubsumedClausesPar(ClauseSet_p set,
+                                       FVPackedClause_p subsumer,
+                                       PStack_p res,
+                                       ParSubsume_p par)
+{
+   long          old_sp = PStackGetSP(res), i;
+   int           w, workers = ThreadPoolWorkers(par->pool);
+   PStack_p      cands;
+   ParSubsumeJob job;
+
+   if(!ThreadPoolMemIsSafe || workers < 2 ||
+      problemType != PROBLEM_FO ||
+      ClauseIsEmpty(subsumer->clause))
+   {
+      return ClauseSetFindFVSubsumedClauses(set, subsumer, res);
+   }
+   PERF_CTR_ENTRY(SetSubsumeTimer);
+   assert(subsumer->clause->weight == ClauseStandardWeight(subsumer->clause));
+
+   cands = PStackAlloc();
+   clauseset_collect_subsumed_candidates(set, subsumer, cands);
+
+   if(PStackGetSP(cands) < PAR_SUBSUME_MIN_CANDIDATES)
+   {
+      for(i=0; i<PStackGetSP(cands); i++)
+      {
+         if(clause_subsumes_clause(subsumer->clause,
+                                   PStackElementP(cands, i)))
+         {
+            PStackPushP(res, PStackElementP(cands, i));
+         }
+      }
+   }
+   else
+   {
+      job.par      = par;
+      job.subsumer = subsumer->clause;
+      job.cands    = cands;
+      job.cand_no  = PStackGetSP(cands);
+      job.subsumed = SizeMalloc(job.cand_no*sizeof(char));
+      job.counters = SizeMalloc(workers*sizeof(long[6]));
+
+      ThreadPoolRun(par->pool, par_subsume_worker, &job);
+
+      for(i=0; i<job.cand_no; i++)
+      {
+         if(job.subsumed[i])
+         {
+            PStackPushP(res, PStackElementP(cands, i));
+         }
+      }
+      for(w=1; w<workers; w++)
+      {
+         ClauseClauseSubsumptionCalls     += job.counters[w][0];
+         ClauseClauseSubsumptionCallsRec  += job.counters[w][1];
+         ClauseClauseSubsumptionSuccesses += job.counters[w][2];
+         UnitClauseClauseSubsumptionCalls += job.counters[w][3];
+         SubstBorrowCount                 += job.counters[w][4];
+         SubstBorrowAllocCount            += job.counters[w][5];
+      }
+      SizeFree(job.counters, workers*sizeof(long[6]));
+      SizeFree(job.subsumed, job.cand_no*sizeof(char));
+   }
+   PStackFree(cands);
+   PERF_CTR_EXIT(SetSubsumeTimer);
+   return PStackGetSP(res)-old_sp;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetFindFVSubsumersPar()
+//
+//   members is a stack of clauses packed for the index of set, all
+//   with correct weights and in subsumption order. For each member,
+//   find a clause in set that subsumes it and store it in
+//   subsumers[i] (or NULL). The candidate subsumers of up to
+//   MULTI_SUBSUMER_MAX members are found with a single traversal of
+//   the index and distributed over the workers of par (if par is
+//   not NULL). For every member, the subsumer is the first one in
+//   the order of the index, i.e. the one found by
+//   ClauseSetSubsumesFVPackedClause(), independent of the number of
+//   workers. Return the number of subsumed members.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, runs jobs in par->pool
+//
+/----------------------------------------------------------------------*/
+
+long ClauseSetFindFVSubsumersPar(ClauseSet_p set, PStack_p members,
+                                 Clause_p *subsumers, ParSubsume_p par)
+{
+   long             res = 0, start, end, i, j, best;
+   int              w, workers = 1;
+   PStack_p         vecs, chunk, cands;
+   FVPackedClause_p pclause;
+   ParFWSubsumeJob  job;
+
+   if(!set->fvindex)
+   {
+      for(i=0; i<PStackGetSP(members); i++)
+      {
+         subsumers[i] =
+            ClauseSetSubsumesFVPackedClause(set, PStackElementP(members, i));
+         res += subsumers[i]?1:0;
+      }
+      return res;
+   }
+   if(par && ThreadPoolMemIsSafe && problemType == PROBLEM_FO)
+   {
+      workers = ThreadPoolWorkers(par->pool);
+   }
+   vecs  = PStackAlloc();
+   chunk = PStackAlloc();
+   cands = PStackAlloc();
+   job.par      = par;
+   job.cands    = cands;
+   job.members  = chunk;
+   job.first    = SizeMalloc(workers*sizeof(long[MULTI_SUBSUMER_MAX]));
+   job.counters = SizeMalloc(workers*sizeof(long[6]));
+
+   for(start=0; start<PStackGetSP(members); start=end)
+   {
+      end = MIN(start+MULTI_SUBSUMER_MAX, PStackGetSP(members));
+      PStackReset(vecs);
+      PStackReset(chunk);
+      PStackReset(cands);
+      for(i=start; i<end; i++)
+      {
+         pclause = PStackElementP(members, i);
+         assert(pclause->array);
+         assert(pclause->clause->weight ==
+                ClauseStandardWeight(pclause->clause));
+         assert(ClauseIsSubsumeOrdered(pclause->clause));
+         PStackPushP(vecs, pclause);
+         PStackPushP(chunk, pclause->clause);
+      }
+      job.cand_no = ClauseSetFindMultiSubsumerCandidates(set, vecs, cands);
+
+      if(workers > 1 && job.cand_no >= PAR_SUBSUME_MIN_CANDIDATES)
+      {
+         job.workers = workers;
+         ThreadPoolRun(par->pool, par_fw_subsume_worker, &job);
+         for(w=1; w<workers; w++)
+         {
+            ClauseClauseSubsumptionCalls     += job.counters[w][0];
+            ClauseClauseSubsumptionCallsRec  += job.counters[w][1];
+            ClauseClauseSubsumptionSuccesses += job.counters[w][2];
+            UnitClauseClauseSubsumptionCalls += job.counters[w][3];
+            SubstBorrowCount                 += job.counters[w][4];
+            SubstBorrowAllocCount            += job.counters[w][5];
+         }
+         w = workers;
+      }
+      else
+      {
+         job.workers = 1;
+         par_fw_subsume_worker(&job, 0);
+         w = 1;
+      }
+      for(j=0; j<end-start; j++)
+      {
+         best = -1;
+         for(i=0; i<w; i++)
+         {
+            if(job.first[i][j] != -1 &&
+               (best == -1 || job.first[i][j] < best))
+            {
+               best = job.first[i][j];
+            }
+         }
+         subsumers[start+j] = (best == -1)?NULL:
+            PStackElementP(cands, 2*best);
+         res += subsumers[start+j]?1:0;
+      }
+   }
+   SizeFree(job.counters, workers*sizeof(long[6]));
+   SizeFree(job.first, workers*sizeof(long[MULTI_SUBSUMER_MAX]));
+   PStackFree(cands);
+   PStackFree(chunk);
+   PStackFree(vecs);
+
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseSetFindFirstFVSubsumedClause()
@@ -1585,7 +2570,12 @@ Clause_p ClauseSetFindFirstFVSubsumedClause(ClauseSet_p set,
    PERF_CTR_ENTRY(SetSubsumeTimer);
    assert(subsumer->clause->weight == ClauseStandardWeight(subsumer->clause));
 
-   if(set->fvindex)
+   if(set->fvindex && set->fvindex->columns)
+   {
+      res = clauseset_find_subsumed_clauses_columns(set->fvindex->columns,
+                                                    subsumer, NULL, true);
+   }
+   else if(set->fvindex)
    {
       res = clauseset_find_first_subsumed_clause_indexed(set->fvindex->index,
                                                    subsumer, 0);
@@ -1684,6 +2674,11 @@ Clause_p ClauseSetFindFVVariantClause(ClauseSet_p set,
 {
    assert(set->fvindex);
 
+   if(set->fvindex->columns)
+   {
+      return clauseset_find_variant_clause_columns(set->fvindex->columns,
+                                                   clause);
+   }
    return clauseset_find_variant_clause_indexed(set->fvindex->index,
                                                 clause, 0);
 }
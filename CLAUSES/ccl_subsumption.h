@@ -18,6 +18,9 @@
   Changes
 
   Created: Sat Jul  5 02:28:25 MET DST 1997
+  Fri Oct 16 2026: Parallel backward subsumption.
+  Sat Oct 17 2026: Candidates for several subsumption queries at once.
+  Sat Oct 17 2026: Private banks for the subsumer copies of workers.
 
   -----------------------------------------------------------------------*/
 
@@ -26,28 +29,55 @@
 #define CCL_SUBSUPTION
 
 #include <clb_os_wrapper.h>
+#include <clb_threadpool.h>
 #include <ccl_unit_simplify.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
 /*---------------------------------------------------------------------*/
 
+/* Context for parallel subsumption: The worker threads and, for each
+   helper thread, an arena-backed term bank for its copies of
+   subsumers. The banks are created by the helpers themselves on
+   first use (banks[0] is unused). */
 
+typedef struct par_subsume_cell
+{
+   ThreadPool_p pool;
+   Sig_p        sig;
+   TB_p         *banks;
+}ParSubsumeCell, *ParSubsume_p;
 
 
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
+/* Below this number of candidates (after feature vector filtering),
+   ClauseSetFindFVSubsumedClausesPar() and
+   ClauseSetFindFVSubsumersPar() do not bother to start the
+   workers. */
+#define PAR_SUBSUME_MIN_CANDIDATES 64
+
+/* Maximal number of feature vectors for one query of
+   ClauseSetFindMultiSubsumerCandidates() (bits in a uint64_t). */
+#define MULTI_SUBSUMER_MAX 64
+
+#define ParSubsumeCellAlloc()    (ParSubsumeCell*)SizeMalloc(sizeof(ParSubsumeCell))
+#define ParSubsumeCellFree(junk) SizeFree(junk, sizeof(ParSubsumeCell))
+
 PERF_CTR_DECL(SetSubsumeTimer);
 PERF_CTR_DECL(SubsumeTimer);
 
 extern bool StrongUnitForwardSubsumption;
-extern long ClauseClauseSubsumptionCalls;
-extern long ClauseClauseSubsumptionCallsRec;
-extern long ClauseClauseSubsumptionSuccesses;
-extern long UnitClauseClauseSubsumptionCalls;
+extern THREAD_LOCAL long ClauseClauseSubsumptionCalls;
+extern THREAD_LOCAL long ClauseClauseSubsumptionCallsRec;
+extern THREAD_LOCAL long ClauseClauseSubsumptionSuccesses;
+extern THREAD_LOCAL long UnitClauseClauseSubsumptionCalls;
+
 
+ParSubsume_p ParSubsumeAlloc(Sig_p sig, int workers);
+void         ParSubsumeFree(ParSubsume_p junk);
 
 bool     LiteralSubsumesClause(Eqn_p literal, Clause_p clause);
 bool     UnitClauseSubsumesClause(Clause_p unit, Clause_p clause);
@@ -65,6 +95,9 @@ Clause_p ClauseSetSubsumesFVPackedClause(ClauseSet_p set,
                                          FVPackedClause_p sub_candidate);
 Clause_p ClauseSetSubsumesClause(ClauseSet_p set, Clause_p
                                  sub_candidate);
+long     ClauseSetFindMultiSubsumerCandidates(ClauseSet_p set,
+                                              PStack_p vecs,
+                                              PStack_p res);
 Clause_p ClauseSetFindSubsumedClause(ClauseSet_p set, Clause_p
                                      set_position, Clause_p
                                      subsumer);
@@ -72,6 +105,14 @@ Clause_p ClauseSetFindSubsumedClause(ClauseSet_p set, Clause_p
 long     ClauseSetFindFVSubsumedClauses(ClauseSet_p set,
                                         FVPackedClause_p subsumer,
                                         PStack_p res);
+long     ClauseSetFindFVSubsumedClausesPar(ClauseSet_p set,
+                                           FVPackedClause_p subsumer,
+                                           PStack_p res,
+                                           ParSubsume_p par);
+long     ClauseSetFindFVSubsumersPar(ClauseSet_p set,
+                                     PStack_p members,
+                                     Clause_p *subsumers,
+                                     ParSubsume_p par);
 
 Clause_p ClauseSetFindFirstFVSubsumedClause(ClauseSet_p set,
                                             FVPackedClause_p subsumer);
@@ -6,9 +6,10 @@ Author: Stephan Schulz
 
 Contents
 
-  Functions for detecting tautologies using the algorithm suggested by
-  Roberto Nieuwenhuis: Do ground completion on negative literals, see
-  if they imply the positive ones
+  Functions for detecting tautologies using the idea suggested by
+  Roberto Nieuwenhuis: Treat the clause as ground and see if the
+  negative literals imply one of the positive ones. This used to be
+  done by ground completion, now by congruence closure.
 
   Copyright 1998, 1999 by the author.
   This code is released under the GNU General Public Licence and
@@ -20,6 +21,8 @@ Changes
 
 <1> Tue May  4 17:41:06 MEST 1999
     New
+<2> Sat Oct 17 2026
+    Congruence closure instead of ground completion.
 
 -----------------------------------------------------------------------*/
 
@@ -44,10 +47,10 @@ Changes
 
 /*-----------------------------------------------------------------------
 //
-// Function: TO_ground_compare()
+// Function: clause_terms_shared()
 //
-//   Compare two terms with a very simple total ordering extendable to
-//   a reduction ordering.
+//   Return true if all terms of the clause are shared (and hence
+//   identical terms are represented by the same cell).
 //
 // Global Variables: -
 //
@@ -55,176 +58,28 @@ Changes
 //
 /----------------------------------------------------------------------*/
 
-CompareResult TO_ground_compare(Term_p t1, Term_p t2)
+static bool clause_terms_shared(Clause_p clause)
 {
-   long          w1, w2;
-   CompareResult res = to_equal;
-   int           i;
-   PStack_p      stack = PStackAlloc();
-
-   PStackPushP(stack, t1);
-   PStackPushP(stack, t2);
+   Eqn_p handle;
 
-   while(!PStackEmpty(stack))
+   for(handle = clause->literals; handle; handle = handle->next)
    {
-      t2 = PStackPopP(stack);
-      t1 = PStackPopP(stack);
-
-      w1 = TermStandardWeight(t1);
-      w2 = TermStandardWeight(t2);
-
-      if(w1<w2)
-      {
-    res = to_lesser;
-      }
-      else if(w1>w2)
-      {
-    res = to_greater;
-      }
-      else if(t1->f_code < t2->f_code)
-      {
-    res = to_lesser;
-      }
-      else if(t1->f_code > t2->f_code)
-      {
-    res = to_greater;
-      }
-      else if(t1->arity < t2->arity)
-      {
-         res = to_lesser;
-      }
-      else if(t1->arity > t2->arity)
-      {
-         res = to_greater;
-      }
-      if(res!= to_equal)
+      if(!TermIsShared(handle->lterm) || !TermIsShared(handle->rterm))
       {
-    break;
+         return false;
       }
-      assert(problemType == PROBLEM_HO || t1->arity == t2->arity);
-      for(i = 0; i<t1->arity; i++)
-      {
-    PStackPushP(stack, t1->args[i]);
-    PStackPushP(stack, t2->args[i]);
-      }
-   }
-   PStackFree(stack);
-
-   return res;
-}
-
-/*-----------------------------------------------------------------------
-//
-// Function: ground_orient_eqn()
-//
-//   Orient an equation (by setting or deleting appropriate
-//   flag). Return true if terms are different, false otherwise.
-//
-// Global Variables: -
-//
-// Side Effects    : Sets flag
-//
-/----------------------------------------------------------------------*/
-
-static bool ground_orient_eqn(Eqn_p eqn)
-{
-   CompareResult cmp;
-
-   cmp = TO_ground_compare(eqn->lterm, eqn->rterm);
-   assert(cmp != to_uncomparable);
-
-   if(cmp == to_greater)
-   {
-      EqnSetProp(eqn, EPGONatural);
-   }
-   else
-   {
-      EqnDelProp(eqn, EPGONatural);
    }
    return true;
 }
 
-/*-----------------------------------------------------------------------
-//
-// Function: term_compute_top_nf()
-//
-//   Checks if one of the eqns can reduce *ref, if yes
-//   does so and returns true. Otherwise returns false.
-//
-// Global Variables: -
-//
-// Side Effects    : Memory operations
-//
-/----------------------------------------------------------------------*/
-
-static bool term_compute_top_nf(TermRef ref, Eqn_p eqns)
-{
-   Eqn_p handle = eqns;
-   Term_p lside, rside;
-
-   while(handle)
-   {
-      if(EqnQueryProp(handle, EPGONatural))
-      {
-    lside = handle->lterm;
-    rside = handle->rterm;
-      }
-      else
-      {
-    lside = handle->rterm;
-    rside = handle->lterm;
-      }
-      if(TermStructEqualNoDeref(lside, *ref))
-      {
-    TermFree(*ref);
-    *ref = TermCopy(rside, handle->bank->vars, false);
-    return true;
-      }
-      handle = handle->next;
-   }
-   return false;
-}
-
-/*-----------------------------------------------------------------------
-//
-// Function: term_compute_ground_NF()
-//
-//   Compute a ground normal form of *ref with respect to eqns. *ref
-//   should be unshared, eqns should be interreduced. Return true if
-//   term changed. This is probably
-//   not an optimal implementation, but *ref and eqns should be pretty
-//   small and not worth any of the overhead of the more sophisticated
-//   algorithms.
-//
-// Global Variables: -
-//
-// Side Effects    : Memory management, changes *ref
-//
-/----------------------------------------------------------------------*/
-
-static bool term_compute_ground_NF(TermRef ref, Eqn_p eqns)
-{
-   int i;
-   bool res = false, tmp;
-
-   for(i=0 ; i< (*ref)->arity; i++)
-   {
-      tmp = term_compute_ground_NF((&(*ref)->args[i]), eqns);
-      res = res||tmp;
-   }
-   tmp = term_compute_top_nf(ref, eqns);
-   res = res||tmp;
-
-   return res;
-}
 
 /*-----------------------------------------------------------------------
 //
-// Function: ground_normalize_eqn()
+// Function: clause_is_cc_tautology()
 //
-//   Normalize eqn with respect to eqns (which should be
-//   interreduced). Return true if maximal side has been rewritten,
-//   false otherwise.
+//   Return true if the negative literals of clause (read as ground
+//   equations) imply one of the positive literals under congruence
+//   closure.
 //
 // Global Variables: -
 //
@@ -232,104 +87,31 @@ static bool term_compute_ground_NF(TermRef ref, Eqn_p eqns)
 //
 /----------------------------------------------------------------------*/
 
-static bool ground_normalize_eqn(Eqn_p eqn, Eqn_p eqns)
-{
-   bool res = false, tmp;
-   Term_p term, shared;
-
-   term = TermCopy(eqn->lterm, eqn->bank->vars, false);
-   tmp  = term_compute_ground_NF(&term, eqns);
-   if(tmp)
-   {
-      shared = TBInsert(eqn->bank, term, DEREF_NEVER);
-      eqn->lterm = shared;
-      res = EqnQueryProp(eqn, EPGONatural);
-   }
-   TermFree(term);
-
-   term = TermCopy(eqn->rterm, eqn->bank->vars, false);
-   tmp  = term_compute_ground_NF(&term, eqns);
-   if(tmp)
-   {
-      shared = TBInsert(eqn->bank, term, DEREF_NEVER);
-      eqn->rterm = shared;
-      res = res || EqnQueryProp(eqn, EPGONatural);
-   }
-   TermFree(term);
-
-   return res;
-}
-
-/*-----------------------------------------------------------------------
-//
-// Function: ground_backward_contract()
-//
-//   Normalize all eqations in from with respect to eqns. Put those
-//   whose maximal side has changed into to.
-//
-// Global Variables:
-//
-// Side Effects    :
-//
-/----------------------------------------------------------------------*/
-
-static void ground_backward_contract(EqnRef from, Eqn_p eqns, EqnRef to)
+static bool clause_is_cc_tautology(Clause_p clause)
 {
-   Eqn_p handle;
-   bool   res;
+   GroundCC_p cc = GroundCCAlloc();
+   Eqn_p      handle;
+   bool       res = false;
 
-   while(*from)
+   for(handle = clause->literals; handle; handle = handle->next)
    {
-      res = ground_normalize_eqn(*from, eqns);
-      if(res)
+      if(EqnIsNegative(handle))
       {
-    handle = EqnListExtractFirst(from);
-    EqnListInsertFirst(to, handle);
-      }
-      else
-      {
-    from = &((*from)->next);
+         GroundCCAssertEqual(cc, handle->lterm, handle->rterm);
       }
    }
-}
-
-
-/*-----------------------------------------------------------------------
-//
-// Function: ground_complete_neg_eqns()
-//
-//   Complete the negative equations in *list. Return completed
-//   system.
-//
-// Global Variables: -
-//
-// Side Effects    : Changes *list, memory operations
-//
-/----------------------------------------------------------------------*/
-
-static void ground_complete_neg_eqns(EqnRef list)
-{
-   Eqn_p unproc = NULL, proc = NULL, handle;
-   bool  cmp;
-
-   unproc = *list;
-
-   while(unproc)
+   for(handle = clause->literals; handle; handle = handle->next)
    {
-      handle = EqnListExtractFirst(&unproc);
-      assert(!handle->next);
-      ground_normalize_eqn(handle, proc);
-      if(handle->lterm==handle->rterm)
+      if(EqnIsPositive(handle) &&
+         GroundCCEqual(cc, handle->lterm, handle->rterm))
       {
-    EqnFree(handle);
-    continue;
+         res = true;
+         break;
       }
-      cmp = ground_orient_eqn(handle);
-      UNUSED(cmp); assert(cmp);
-      ground_backward_contract(&proc, handle, &unproc);
-      EqnListInsertFirst(&proc, handle);
    }
-   *list = proc;
+   GroundCCFree(cc);
+
+   return res;
 }
 
 
@@ -343,7 +125,8 @@ static void ground_complete_neg_eqns(EqnRef list)
 // Function: ClauseIsTautology()
 //
 //   Return true if clause certainly is a tautology, false if this
-//   cannot be shown at the accepted expense.
+//   cannot be shown at the accepted expense. Clauses that are not
+//   made of shared terms are copied into work_bank first.
 //
 // Global Variables: -
 //
@@ -353,9 +136,9 @@ static void ground_complete_neg_eqns(EqnRef list)
 
 bool ClauseIsTautology(TB_p work_bank, Clause_p clause)
 {
-   Eqn_p    rw_system, handle;
+   Eqn_p    handle;
    Clause_p work_copy;
-   bool     res = false;
+   bool     res;
 
    for(handle = clause->literals; handle; handle = handle->next)
    {
@@ -368,37 +151,16 @@ bool ClauseIsTautology(TB_p work_bank, Clause_p clause)
    {
       return false;
    }
-
-   work_copy = ClauseCopy(clause, work_bank);
-   rw_system = EqnListExtractByProps(&(work_copy->literals),
-                                     EPIsPositive, true);
-   assert(rw_system);
-   if(clause->neg_lit_no > 1)
-   {
-      ground_complete_neg_eqns(&rw_system);
-   }
-   else
+   if(clause_terms_shared(clause))
    {
-      ground_orient_eqn(rw_system);
+      return clause_is_cc_tautology(clause);
    }
-
-   for(handle = work_copy->literals; handle; handle = handle->next)
-   {
-      assert(EqnIsPositive(handle));
-
-      ground_normalize_eqn(handle, rw_system);
-      if(handle->lterm == handle->rterm)
-      {
-         res = true;
-         break;
-      }
-   }
-   EqnListFree(rw_system);
+   work_copy = ClauseCopy(clause, work_bank);
+   res = clause_is_cc_tautology(work_copy);
    ClauseFree(work_copy);
 
    return res;
-   }
-
+}
 
 
 /*---------------------------------------------------------------------*/
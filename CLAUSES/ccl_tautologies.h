@@ -6,9 +6,9 @@ Author: Stephan Schulz
 
 Contents
 
-  Functions for detecting tautologies using the algorithm suggested by
-  Roberto Nieuwenhuis: Do ground completion on negative literals, see
-  if they imply the positive ones
+  Functions for detecting tautologies using the idea suggested by
+  Roberto Nieuwenhuis: Treat the clause as ground and see if the
+  negative literals imply one of the positive ones.
 
   Copyright 1998, 1999 by the author.
   This code is released under the GNU General Public Licence and
@@ -20,6 +20,8 @@ Changes
 
 <1> Tue May  4 17:23:56 MEST 1999
     New
+<2> Sat Oct 17 2026
+    Use ccl_groundcc.h
 
 -----------------------------------------------------------------------*/
 
@@ -27,7 +29,7 @@ Changes
 
 #define CCL_TAUTOLOGIES
 
-#include <ccl_clauses.h>
+#include <ccl_groundcc.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
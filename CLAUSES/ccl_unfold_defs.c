@@ -18,6 +18,7 @@
   Changes
 
   Created: Wed Aug 14 20:00:53 CEST 2002
+  Sat Oct 17 2026: Optionally filter clauses entailed by ground units
 
   -----------------------------------------------------------------------*/
 
@@ -300,7 +301,8 @@ long ClauseSetUnfoldAllEqDefs(ClauseSet_p set, ClauseSet_p passive,
 // Function: ClauseSetPreprocess()
 //
 //   Perform preprocessing on the clause set: Removing tautologies,
-//   definition unfolding and canonization. Returns number of clauses
+//   optionally clauses entailed by the ground units, definition
+//   unfolding and canonization. Returns number of clauses
 //   removed. If passive is true, potential unfolding is applied to
 //   clauses in that set as well.
 //
@@ -311,12 +313,17 @@ long ClauseSetUnfoldAllEqDefs(ClauseSet_p set, ClauseSet_p passive,
 /----------------------------------------------------------------------*/
 
 long ClauseSetPreprocess(ClauseSet_p set, ClauseSet_p passive,
-                         ClauseSet_p archive, TB_p tmp_terms)
+                         ClauseSet_p archive, TB_p tmp_terms,
+                         bool filter_ground_entailed)
 {
    long res;
 
    ClauseSetRemoveSuperfluousLiterals(set);
    res = ClauseSetFilterTautologies(set, tmp_terms);
+   if(filter_ground_entailed)
+   {
+      res += ClauseSetFilterGroundEntailed(set);
+   }
    ClauseSetCanonize(set);
 
    return res;
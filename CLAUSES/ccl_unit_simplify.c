@@ -73,7 +73,7 @@ const SimplifyRes SIMPLIFY_FAILED = {.pos = NULL, .remaining_args = MATCH_FAILED
 SimplifyRes FindTopSimplifyingUnit(ClauseSet_p units, Term_p t1,
                Term_p t2)
 {
-   Subst_p     subst = SubstAlloc();
+   Subst_p     subst = SubstBorrow();
    int remains = MATCH_FAILED;
    ClausePos_p pos;
    SimplifyRes res = SIMPLIFY_FAILED;
@@ -97,12 +97,11 @@ SimplifyRes FindTopSimplifyingUnit(ClauseSet_p units, Term_p t1,
         assert(pos->clause->set == units);
         assert(remains == mi->remaining_args);
         res = (SimplifyRes){.pos = pos, .remaining_args = remains};
-        MatchResFree(mi);
         break;
       }
    }
    PDTreeSearchExit(units->demod_index);
-   SubstDelete(subst);
+   SubstReturn(subst);
    return res;
 }
 
@@ -122,7 +121,7 @@ SimplifyRes FindTopSimplifyingUnit(ClauseSet_p units, Term_p t1,
 SimplifyRes FindSignedTopSimplifyingUnit(ClauseSet_p units, Term_p t1,
                 Term_p t2, bool sign)
 {
-   Subst_p     subst = SubstAlloc();
+   Subst_p     subst = SubstBorrow();
    int remains = MATCH_FAILED;
    ClausePos_p pos;
    SimplifyRes res = SIMPLIFY_FAILED;
@@ -146,13 +145,11 @@ SimplifyRes FindSignedTopSimplifyingUnit(ClauseSet_p units, Term_p t1,
         assert(pos->clause->set == units);
         assert(remains == mi->remaining_args);
         res = (SimplifyRes){.pos = pos, .remaining_args = remains};
-        MatchResFree(mi);
         break;
       }
-      MatchResFree(mi);
    }
    PDTreeSearchExit(units->demod_index);
-   SubstDelete(subst);
+   SubstReturn(subst);
    return res;
 }
 
@@ -0,0 +1,3 @@
+#define PICOSAT_CC "gcc"
+#define PICOSAT_CFLAGS "-DTRACE -Wall -Wextra -DNDEBUG -O3"
+#define PICOSAT_VERSION "965"
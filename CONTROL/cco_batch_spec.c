@@ -16,6 +16,13 @@
 
   Created: Tue Jun 29 04:41:18 CEST 2010
 
+  Changes
+
+  Fri Oct 16 2026: Optionally run provers in forked processes
+  instead of external eprover processes (BatchForkRunners).
+  Sat Oct 17 2026: Optionally load/save the axioms from/to a binary
+  image (BatchAxiomImage).
+
   -----------------------------------------------------------------------*/
 
 #include "cco_batch_spec.h"
@@ -26,6 +33,16 @@
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+/* If true, provers are forked from the current process and work
+   directly on the already parsed axioms, instead of writing each
+   problem into a file and running an external prover on it. */
+bool BatchForkRunners = false;
+
+/* If set, the parsed axioms are loaded from this image file if it
+   was created from the same axiom files, otherwise they are parsed
+   and the image is (re-)written for the next start. */
+char* BatchAxiomImage = NULL;
+
 char* BatchFilters[] =
 {
    "threshold010000",
@@ -116,14 +133,198 @@ char* BatchStrategiesDiv[] =
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: batch_find_strategy()
+//
+//   If options select a single strategy of the built-in schedule
+//   (via "-x<name>"), return its index in StratSchedule, otherwise
+//   return -1.
+//
+// Global Variables: StratSchedule
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int batch_find_strategy(char* options)
+{
+   char *heuristic = strstr(options, "-x");
+   int  i;
+   size_t len;
+
+   if(!heuristic)
+   {
+      return -1;
+   }
+   heuristic += 2;
+   len = strcspn(heuristic, " ");
+   for(i=0; StratSchedule[i].heu_name; i++)
+   {
+      if((strlen(StratSchedule[i].heu_name) == len) &&
+         (strncmp(StratSchedule[i].heu_name, heuristic, len) == 0))
+      {
+         return i;
+      }
+   }
+   return -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: batch_prove_in_process()
+//
+//   Run the proof search for the problem given by the clauses and
+//   formulas on the stacks (which are shared with ctrl) directly in
+//   this process, print the result in the same format as an external
+//   "eprover" run would, and terminate. This is only called in a
+//   process forked by ECtrlCreateForked(), and takes over (and
+//   destroys) ctrl. Only the options of the standard batch strategies
+//   are interpreted: "-x<name>" selects the given strategy of the
+//   built-in schedule (otherwise the whole schedule is run),
+//   "--assume-incompleteness" and "--conjectures-are-questions" have
+//   their usual meaning.
+//
+// Global Variables: StratSchedule, ScheduleTimeLimit, OutputLevel,
+//                   SilentTimeOut
+//
+// Side Effects    : Plenty, terminates the process
+//
+/----------------------------------------------------------------------*/
+
+static void batch_prove_in_process(StructFOFSpec_p ctrl,
+                                   PStack_p cspec,
+                                   PStack_p fspec,
+                                   char* options,
+                                   char* extra_options,
+                                   long cpu_time)
+{
+   ProofState_p     state;
+   ProofControl_p   control;
+   HeuristicParms_p h_parms   = HeuristicParmsAlloc();
+   FVIndexParms_p   fvi_parms = FVIndexParmsAlloc();
+   PStack_p         wfcb_defs = PStackAlloc();
+   PStack_p         hcb_defs  = PStackAlloc();
+   Clause_p         success;
+   Derivation_p     deriv;
+   long             neg_conjectures;
+   int              strat, retval;
+
+   OutputLevel       = 0;
+   ScheduleTimeLimit = cpu_time;
+   ESignalSetup(SIGXCPU);
+
+   state = ProofStateAllocFromTerms(ctrl->terms, FPIgnoreProps);
+   PStackClausesMove(cspec, state->axioms);
+   PStackFormulasMove(fspec, state->f_axioms);
+   state->has_interpreted_symbols =
+      FormulaSetHasInterpretedSymbol(state->f_axioms);
+   if(strstr(options, "--assume-incompleteness"))
+   {
+      state->state_is_complete = false;
+   }
+   FormulaSetArchive(state->f_axioms, state->f_ax_archive);
+   neg_conjectures =
+      FormulaSetPreprocConjectures(state->f_axioms,
+                                   state->f_ax_archive,
+                                   false,
+                                   strstr(extra_options,
+                                          "--conjectures-are-questions"));
+   FormulaSetCNF(state->f_axioms,
+                 state->f_ax_archive,
+                 state->axioms,
+                 state->terms,
+                 state->freshvars,
+                 state->gc_terms);
+   ProofStateLoadWatchlist(state, NULL, AutoFormat);
+   ClauseSetArchiveCopy(state->ax_archive, state->axioms);
+   ClauseSetPreprocess(state->axioms,
+                       state->watchlist,
+                       state->archive,
+                       state->tmp_terms,
+                       false);
+
+   strat = batch_find_strategy(options);
+   if(strat != -1)
+   {
+      h_parms->heuristic_name         = StratSchedule[strat].heu_name;
+      h_parms->order_params.ordertype = StratSchedule[strat].ordering;
+   }
+   else
+   {
+      /* Only returns in the child running a strategy */
+      ExecuteSchedule(StratSchedule, h_parms, false);
+   }
+   control = ProofControlAlloc();
+   ProofControlInit(state, control, h_parms,
+                    fvi_parms, wfcb_defs, hcb_defs);
+   ClauseSetUnfoldEqDefNormalize(state->axioms,
+                                 state->watchlist,
+                                 state->archive,
+                                 state->tmp_terms,
+                                 h_parms->eqdef_incrlimit,
+                                 h_parms->eqdef_maxclauses);
+   GlobalIndicesInit(&(state->wlindices),
+                     state->signature,
+                     control->heuristic_parms.rw_bw_index_type,
+                     "NoIndex",
+                     "NoIndex");
+   ProofStateInit(state, control);
+
+   success = Saturate(state, control, LONG_MAX,
+                      LONG_MAX, LONG_MAX, LONG_MAX, LONG_MAX,
+                      LLONG_MAX, LONG_MAX);
+   if(success)
+   {
+      fprintf(GlobalOut, "\n# Proof found!\n");
+      deriv = DerivationCompute(state->extract_roots, state->signature);
+      if(neg_conjectures)
+      {
+         TSTPOUT(GlobalOut,
+                 deriv->has_conjecture?"Theorem":"ContradictoryAxioms");
+      }
+      else
+      {
+         TSTPOUT(GlobalOut, "Unsatisfiable");
+      }
+      DerivationPrintConditional(GlobalOut, "CNFRefutation", deriv,
+                                 state->signature, POList, false);
+      retval = PROOF_FOUND;
+   }
+   else if(ClauseSetEmpty(state->unprocessed) &&
+           state->state_is_complete &&
+           !SigHasUnimplementedInterpretedSymbols(state->signature) &&
+           !state->has_interpreted_symbols)
+   {
+      fprintf(GlobalOut, "\n# No proof found!\n");
+      TSTPOUT(GlobalOut, neg_conjectures?"CounterSatisfiable":"Satisfiable");
+      retval = SATISFIABLE;
+   }
+   else
+   {
+      fprintf(GlobalOut, "\n# Failure: No proof found!\n");
+      if(!SilentTimeOut)
+      {
+         TSTPOUT(GlobalOut, "GaveUp");
+      }
+      retval = INCOMPLETE_PROOFSTATE;
+   }
+   fflush(GlobalOut);
+   _exit(retval);
+}
+
+
 
 /*-----------------------------------------------------------------------
 //
 // Function: batch_create_runner()
 //
-//   Create a EPCtrl block associated with a running instance of E.
+//   Create a EPCtrl block associated with a running instance of E
+//   (either an external process, or a forked copy of this process,
+//   see BatchForkRunners).
 //
-// Global Variables:
+// Global Variables: BatchForkRunners
 //
 // Side Effects    :
 //
@@ -154,6 +355,20 @@ EPCtrl_p batch_create_runner(StructFOFSpec_p ctrl,
    /* fprintf(GlobalOut, "# Spec has %d clauses and %d formulas (%lld)\n",
       PStackGetSP(cspec), PStackGetSP(fspec), GetSecTimeMod()); */
 
+   AxFilterPrintBuf(name, 320, ax_filter);
+   if(BatchForkRunners)
+   {
+      pctrl = ECtrlCreateForked(name, options, cpu_time, NULL);
+      if(!pctrl)
+      {
+         batch_prove_in_process(ctrl, cspec, fspec,
+                                options, extra_options, cpu_time);
+      }
+      PStackFree(cspec);
+      PStackFree(fspec);
+      return pctrl;
+   }
+
    file = TempFileName();
    fp   = SecureFOpen(file, "w");
 
@@ -165,7 +380,6 @@ EPCtrl_p batch_create_runner(StructFOFSpec_p ctrl,
    /* fprintf(GlobalOut, "# Written new problem (%lld)\n",
     * GetSecTimeMod()); */
 
-   AxFilterPrintBuf(name, 320, ax_filter);
    pctrl = ECtrlCreateGeneric(executable, name, options, extra_options, cpu_time, file);
 
    PStackFree(cspec);
@@ -553,8 +767,11 @@ BatchSpec_p BatchSpecParse(Scanner_p in, char* executable,
 // Function: BatchStructFOFSpecInit()
 //
 //   Initialize a BatchStructFOFSpecCell up to the symbol frequency.
+//   If BatchAxiomImage is set and names an intact image of the same
+//   (unchanged) axiom files, the axioms are loaded from there instead
+//   of parsed, otherwise the image is written after parsing.
 //
-// Global Variables: -
+// Global Variables: BatchAxiomImage
 //
 // Side Effects    : Yes ;-)
 //
@@ -564,9 +781,36 @@ long BatchStructFOFSpecInit(BatchSpec_p spec,
                             StructFOFSpec_p ctrl,
                             char *default_dir)
 {
-   long res;
+   long        res = 0;
+   SpecImage_p image = NULL;
 
-   res = StructFOFSpecParseAxioms(ctrl, spec->includes, spec->format, default_dir);
+   if(BatchAxiomImage && SpecImageFileIsImage(BatchAxiomImage))
+   {
+      image = SpecImageOpen(BatchAxiomImage);
+      if(image && SpecImageMatchesSources(image, spec->includes, default_dir))
+      {
+         fprintf(GlobalOut, "# Loading axiom image %s\n", BatchAxiomImage);
+         res = StructFOFSpecLoadImage(ctrl, image);
+      }
+      else if(image)
+      {
+         fprintf(GlobalOut, "# Axiom image %s is for different or "
+                 "changed axioms\n", BatchAxiomImage);
+         SpecImageClose(image);
+         image = NULL;
+      }
+   }
+   res += StructFOFSpecParseAxioms(ctrl, spec->includes, spec->format, default_dir);
+   if(image)
+   {
+      SpecImageClose(image);
+   }
+   else if(BatchAxiomImage)
+   {
+      fprintf(GlobalOut, "# Writing axiom image %s\n", BatchAxiomImage);
+      StructFOFSpecSaveImage(ctrl, BatchAxiomImage, spec->includes,
+                             default_dir);
+   }
    StructFOFSpecInitDistrib(ctrl);
 
    return res;
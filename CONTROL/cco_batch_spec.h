@@ -31,7 +31,10 @@
 #include <ccl_formulafunc.h>
 #include <ccl_sine.h>
 #include <cco_sine.h>
+#include <cco_spec_image.h>
 #include <cco_proc_ctrl.h>
+#include <cco_proofproc.h>
+#include <cco_scheduling.h>
 #include <cio_network.h>
 
 
@@ -77,6 +80,9 @@ typedef struct batch_spec_cell
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
+extern bool BatchForkRunners;
+extern char* BatchAxiomImage;
+
 #define BatchSpecCellAlloc()    (BatchSpecCell*)SizeMalloc(sizeof(BatchSpecCell))
 #define BatchSpecCellFree(junk) SizeFree(junk, sizeof(BatchSpecCell))
 
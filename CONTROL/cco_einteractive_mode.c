@@ -17,6 +17,14 @@
 
   Created: Lost in the mist of time!
 
+  Changes
+
+  Sat Oct 17 2026: Jobs run concurrently (up to a per-session limit)
+  and are queued otherwise. Results are collected without blocking
+  the session. New STATUS command.
+  Sat Oct 17 2026: Axiom sets loaded from the server library are
+  kept as binary images in InteractiveImageDir (if set).
+
   -----------------------------------------------------------------------*/
 
 #include "cco_einteractive_mode.h"
@@ -26,6 +34,11 @@
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+/* If set, LOAD keeps an image of each axiom set from the server
+   library in this directory and loads the set from there as long as
+   the library file is unchanged. */
+char* InteractiveImageDir = NULL;
+
 char* help_message = "\
 # Note : Block commands that are of the form of \"COMMAND <NAME> ... GO\"\n\
 # should have the \"COMMAND <NAME>\" and GO each on a seperate line of\n\
@@ -37,7 +50,13 @@ char* help_message = "\
 #- UNSTAGE <NAME>    : Unstages the axiom set <NAME>.\n\
 #- REMOVE <NAME>     : Removes the axiom set <NAME> from the memory.\n\
 #- DOWNLOAD <NAME>   : Prints the axiom set <NAME>.\n\
-#- RUN <NAME> ... GO : Runs a job with the name <NAME>.\n\
+#- RUN <NAME> [<WC> [<CPU>]] ... GO : Runs a job with the name <NAME>,\n\
+#                      optionally with a wall-clock limit and a CPU\n\
+#                      limit (per process) in seconds. Jobs are\n\
+#                      queued if the server already runs the maximal\n\
+#                      number of jobs for this session. Results are\n\
+#                      sent when a job is done.\n\
+#- STATUS            : Prints the status of running and queued jobs.\n\
 #- LIST              : Prints the status of the axiom sets.\n\
 #- HELP              : Prints the help message.\n\
 #- QUIT              : Closes the connection with the server.\n\
@@ -53,6 +72,7 @@ char* help_message = "\
 #define LOAD_COMMAND "LOAD"
 #define RUN_COMMAND "RUN"
 #define LIST_COMMAND "LIST"
+#define STATUS_COMMAND "STATUS"
 #define HELP_COMMAND "HELP"
 #define QUIT_COMMAND "QUIT"
 #define END_OF_BLOCK_TOKEN "GO\n"
@@ -65,6 +85,8 @@ char* help_message = "\
 #define OK_DOWNLOADED_MESSAGE "204 ok : downloaded\n"
 #define OK_ADDED_MESSAGE "205 ok : added\n"
 #define OK_LOADED_MESSAGE "206 ok : loaded\n"
+#define OK_STARTED_MESSAGE "207 ok : job started\n"
+#define OK_QUEUED_MESSAGE "208 ok : job queued\n"
 
 // Defining Failure messages
 #define ERR_ERROR_MESSAGE "499 Err : Something went wrong\n"
@@ -89,10 +111,35 @@ PStack_p get_directory_listings(DStr_p dir);
 void AcceptAxiomSetName(Scanner_p in, DStr_p dest);
 char* run_command(InteractiveSpec_p interactive,
                   DStr_p jobname,
-                  DStr_p input_axioms);
+                  DStr_p input_axioms,
+                  long wct_limit,
+                  long cpu_limit);
+char* status_command(InteractiveSpec_p interactive);
+void  execute_job(InteractiveSpec_p interactive,
+                  InteractiveJob_p job,
+                  FILE* out);
+void  start_job(InteractiveSpec_p interactive, InteractiveJob_p job);
+void  finish_job(InteractiveSpec_p interactive,
+                 InteractiveJob_p job,
+                 bool timeout);
+void  schedule_jobs(InteractiveSpec_p interactive);
+void  wait_for_command(InteractiveSpec_p interactive);
 char* add_command(InteractiveSpec_p interactive,
                   DStr_p axiomsname,
                   DStr_p input_axioms);
+char* insert_axiom_set(InteractiveSpec_p interactive,
+                       DStr_p axiomsname,
+                       ClauseSet_p cset,
+                       FormulaSet_p fset,
+                       DStr_p raw_data);
+char* load_axiom_image(InteractiveSpec_p interactive,
+                       DStr_p axiomsname,
+                       char* source,
+                       DStr_p raw_data);
+void  save_axiom_image(InteractiveSpec_p interactive,
+                       DStr_p axiomsname,
+                       char* source,
+                       StrTree_p known_includes);
 char* stage_command(InteractiveSpec_p interactive, DStr_p axiom_set);
 char* list_command(InteractiveSpec_p interactive);
 void  quit_command(InteractiveSpec_p interactive);
@@ -108,82 +155,345 @@ char* load_command(InteractiveSpec_p interactive, DStr_p filename);
 
 /*-----------------------------------------------------------------------
 //
-// Function:
+// Function: execute_job()
 //
+//   Run the proof job in the current (freshly forked) process, write
+//   the result to out and terminate.
 //
+// Global Variables: -
 //
-// Global Variables:
-//
-// Side Effects    :
+// Side Effects    : I/O, terminates the process
 //
 /----------------------------------------------------------------------*/
 
-char* run_command(InteractiveSpec_p interactive,
-                  DStr_p jobname,
-                  DStr_p input_axioms)
+void execute_job(InteractiveSpec_p interactive,
+                 InteractiveJob_p job,
+                 FILE* out)
 {
-
    Scanner_p job_scanner;
    ClauseSet_p dummy;
    FormulaSet_p fset;
-   char* message;
-   char buffer[256];
-   long wct_limit=30;
-   int pid;
 
-   if ((pid = fork()) == -1)
+   if(interactive->sock_fd != -1)
+   {
+      close(interactive->sock_fd);
+   }
+
+   job_scanner = CreateScanner(StreamTypeUserString,
+                               DStrView(job->input),
+                               true,
+                               NULL, true);
+   ScannerSetFormat(job_scanner, TSTPFormat);
+   dummy = ClauseSetAlloc();
+   fset = FormulaSetAlloc();
+   FormulaAndClauseSetParse(job_scanner, fset, dummy, interactive->ctrl->terms,
+                            NULL,
+                            &(interactive->ctrl->parsed_includes));
+
+   // cset and fset are handed over to BatchProcessProblem and are
+   // freed there (via StructFOFSpecBacktrackToSpec()).
+   (void)BatchProcessProblem(interactive->spec,
+                             job->wct_limit,
+                             interactive->ctrl,
+                             DStrView(job->name),
+                             dummy,
+                             fset,
+                             out,
+                             -1,
+                             true);
+   fprintf(out, "\n# Processing finished for %s\n\n", DStrView(job->name));
+
+   DestroyScanner(job_scanner);
+   fclose(out);
+   exit(0);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: start_job()
+//
+//   Fork a process for the job and add it to the running jobs.
+//
+// Global Variables: -
+//
+// Side Effects    : Forks, I/O
+//
+/----------------------------------------------------------------------*/
+
+void start_job(InteractiveSpec_p interactive, InteractiveJob_p job)
+{
+   EPCtrl_p proc;
+   FILE*    out;
+   DStr_p   message;
+
+   proc = ECtrlCreateForked(DStrView(job->name), "", job->cpu_limit, &out);
+   if(!proc)
+   {
+      execute_job(interactive, job, out);
+   }
+   job->proc = proc;
+   EPCtrlSetAddProc(interactive->job_procs, proc);
+   PStackPushP(interactive->running_jobs, job);
+
+   message = DStrAlloc();
+   DStrAppendStr(message, "\n# Processing started for ");
+   DStrAppendDStr(message, job->name);
+   DStrAppendStr(message, "\n");
+   print_to_outstream(DStrView(message), interactive->fp, interactive->sock_fd);
+   DStrFree(message);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: finish_job()
+//
+//   Send the output of the terminated (or, if timeout is true,
+//   overdue) job to the client, then remove and free the job.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O, kills processes, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void finish_job(InteractiveSpec_p interactive,
+                InteractiveJob_p job,
+                bool timeout)
+{
+   PStackPointer i;
+   DStr_p message = DStrAlloc();
+
+   DStrAppendDStr(message, job->proc->output);
+   if(timeout || !DStrLen(job->proc->output))
+   {
+      /* The job did not complete normally and did not report
+         anything itself */
+      DStrAppendStr(message, timeout?
+                    "# SZS status Timeout for ":"# SZS status Error for ");
+      DStrAppendDStr(message, job->name);
+      DStrAppendStr(message, "\n\n# Processing finished for ");
+      DStrAppendDStr(message, job->name);
+      DStrAppendStr(message, "\n\n");
+   }
+   print_to_outstream(DStrView(message), interactive->fp, interactive->sock_fd);
+   DStrFree(message);
+
+   for(i=0; i<PStackGetSP(interactive->running_jobs); i++)
+   {
+      if(PStackElementP(interactive->running_jobs, i) == job)
+      {
+         PStackDiscardElement(interactive->running_jobs, i);
+         break;
+      }
+   }
+   EPCtrlSetDeleteProc(interactive->job_procs, job->proc, false);
+   job->proc = NULL;
+   InteractiveJobFree(job);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: schedule_jobs()
+//
+//   Start queued jobs (in order) while there are free job slots.
+//
+// Global Variables: -
+//
+// Side Effects    : Forks, I/O
+//
+/----------------------------------------------------------------------*/
+
+void schedule_jobs(InteractiveSpec_p interactive)
+{
+   while(!PQueueEmpty(interactive->queued_jobs) &&
+         (PStackGetSP(interactive->running_jobs) < interactive->max_jobs))
    {
-      return ERR_ERROR_MESSAGE;
+      start_job(interactive, PQueueGetNextP(interactive->queued_jobs));
    }
-   else if(pid > 0)
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: wait_for_command()
+//
+//   Collect the output of running jobs, finish terminated and
+//   overdue jobs and start queued ones, until the client has sent
+//   something.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O, process control
+//
+/----------------------------------------------------------------------*/
+
+void wait_for_command(InteractiveSpec_p interactive)
+{
+   fd_set           readfds;
+   struct timeval   waittime;
+   int              maxfd, fd;
+   EPCtrl_p         proc;
+   InteractiveJob_p job;
+   PStackPointer    i;
+   bool             eof;
+
+   while(true)
    {
-      wait(NULL);
+      FD_ZERO(&readfds);
+      maxfd = EPCtrlSetFDSet(interactive->job_procs, &readfds);
+      FD_SET(interactive->sock_fd, &readfds);
+      maxfd = MAX(maxfd, interactive->sock_fd);
+      waittime.tv_sec  = 0;
+      waittime.tv_usec = 500000;
+
+      if(select(maxfd+1, &readfds, NULL, NULL, &waittime) == -1)
+      {
+         if(errno != EINTR)
+         {
+            TmpErrno = errno;
+            SysError("Cannot wait for input", SYS_ERROR);
+         }
+         FD_ZERO(&readfds);
+      }
+      for(fd=0; fd<=maxfd; fd++)
+      {
+         if((fd == interactive->sock_fd) || !FD_ISSET(fd, &readfds))
+         {
+            continue;
+         }
+         proc = EPCtrlSetFindProc(interactive->job_procs, fd);
+         eof = EPCtrlGetResult(proc, interactive->job_procs->buffer,
+                               EPCTRL_BUFSIZE);
+         if(eof)
+         {
+            for(i=0; i<PStackGetSP(interactive->running_jobs); i++)
+            {
+               job = PStackElementP(interactive->running_jobs, i);
+               if(job->proc == proc)
+               {
+                  finish_job(interactive, job, false);
+                  break;
+               }
+            }
+         }
+      }
+      for(i=PStackGetSP(interactive->running_jobs)-1; i>=0; i--)
+      {
+         job = PStackElementP(interactive->running_jobs, i);
+         if(GetSecTime()-job->proc->start_time >
+            job->wct_limit+INTERACTIVE_JOB_GRACE_TIME)
+         {
+            finish_job(interactive, job, true);
+         }
+      }
+      schedule_jobs(interactive);
+
+      if(FD_ISSET(interactive->sock_fd, &readfds))
+      {
+         break;
+      }
    }
-   else if(pid == 0)
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: run_command()
+//
+//   Queue a new job and start it if possible. Limits of 0 are
+//   replaced by the defaults.
+//
+// Global Variables: -
+//
+// Side Effects    : May fork, I/O
+//
+/----------------------------------------------------------------------*/
+
+char* run_command(InteractiveSpec_p interactive,
+                  DStr_p jobname,
+                  DStr_p input_axioms,
+                  long wct_limit,
+                  long cpu_limit)
+{
+   InteractiveJob_p job;
+
+   if(!wct_limit)
    {
+      wct_limit = 30;
       if(interactive->spec->per_prob_limit)
       {
          wct_limit = interactive->spec->per_prob_limit;
       }
+   }
+   if(!cpu_limit)
+   {
+      cpu_limit = wct_limit;
+   }
+   job = InteractiveJobAlloc(jobname, input_axioms, wct_limit, cpu_limit);
+   PQueueStoreP(interactive->queued_jobs, job);
+   schedule_jobs(interactive);
 
+   return job->proc?OK_STARTED_MESSAGE:OK_QUEUED_MESSAGE;
+}
 
-      fprintf(stdout, "%s", DStrView(jobname));
-      fflush(stdout);
 
-      sprintf(buffer, "\n# Processing started for %s\n", DStrView(jobname));
-      message = buffer;
+/*-----------------------------------------------------------------------
+//
+// Function: status_command()
+//
+//   Print the running and the queued jobs.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O
+//
+/----------------------------------------------------------------------*/
 
-      print_to_outstream(message, interactive->fp, interactive->sock_fd);
+char* status_command(InteractiveSpec_p interactive)
+{
+   PStackPointer    i;
+   long             index;
+   InteractiveJob_p job;
+   DStr_p           message = DStrAlloc();
 
-      job_scanner = CreateScanner(StreamTypeUserString,
-                                  DStrView(input_axioms),
-                                  true,
-                                  NULL, true);
-      ScannerSetFormat(job_scanner, TSTPFormat);
-      dummy = ClauseSetAlloc();
-      fset = FormulaSetAlloc();
-      FormulaAndClauseSetParse(job_scanner, fset, dummy, interactive->ctrl->terms,
-                               NULL,
-                               &(interactive->ctrl->parsed_includes));
-
-      // cset and fset are handed over to BatchProcessProblem and are
-      // freed there (via StructFOFSpecBacktrackToSpec()).
-      (void)BatchProcessProblem(interactive->spec,
-                                wct_limit,
-                                interactive->ctrl,
-                                DStrView(jobname),
-                                dummy,
-                                fset,
-                                interactive->fp,
-                                interactive->sock_fd,
-                                true);
-      sprintf(buffer, "\n# Processing finished for %s\n\n", DStrView(jobname));
-      message = buffer;
-      print_to_outstream(message, interactive->fp, interactive->sock_fd);
-
-      DestroyScanner(job_scanner);
-      exit(0);
+   if(!PStackEmpty(interactive->running_jobs))
+   {
+      DStrAppendStr(message, "Running :\n");
+      for(i=0; i<PStackGetSP(interactive->running_jobs); i++)
+      {
+         job = PStackElementP(interactive->running_jobs, i);
+         DStrAppendStr(message, "  ");
+         DStrAppendDStr(message, job->name);
+         DStrAppendStr(message, " (");
+         DStrAppendInt(message, GetSecTime()-job->proc->start_time);
+         DStrAppendStr(message, " s of ");
+         DStrAppendInt(message, job->wct_limit);
+         DStrAppendStr(message, " s)\n");
+      }
+   }
+   if(!PQueueEmpty(interactive->queued_jobs))
+   {
+      DStrAppendStr(message, "Queued :\n");
+      for(index = PQueueTailIndex(interactive->queued_jobs);
+          index != -1;
+          index = PQueueIncIndex(interactive->queued_jobs, index))
+      {
+         job = PQueueElementP(interactive->queued_jobs, index);
+         DStrAppendStr(message, "  ");
+         DStrAppendDStr(message, job->name);
+         DStrAppendStr(message, "\n");
+      }
+   }
+   if(!DStrLen(message))
+   {
+      DStrAppendStr(message, "No jobs.\n");
    }
+   print_to_outstream(DStrView(message), interactive->fp, interactive->sock_fd);
+   DStrFree(message);
+
    return OK_SUCCESS_MESSAGE;
 }
 
@@ -207,9 +517,6 @@ char* add_command(InteractiveSpec_p interactive,
    Scanner_p axioms_scanner;
    ClauseSet_p dummy;
    FormulaSet_p fset;
-   AxiomSet_p axiom_set;
-   PStackPointer i;
-   AxiomSet_p    handle;
    char *file;
    FILE *fp;
 
@@ -229,10 +536,39 @@ char* add_command(InteractiveSpec_p interactive,
                             NULL,
                             &(interactive->ctrl->parsed_includes));
    DestroyScanner(axioms_scanner);
-   DStrAppendDStr(dummy->identifier, axiomsname);
-   DStrAppendDStr(fset->identifier, axiomsname);
 
-   axiom_set = AxiomSetAlloc(dummy, fset, input_axioms, 0);
+   return insert_axiom_set(interactive, axiomsname, dummy, fset,
+                           input_axioms);
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: insert_axiom_set()
+//
+//   Add the axiom set (cset, fset) under the name axiomsname, unless
+//   the name is already taken (in this case, the sets are freed).
+//   Return the message for the client.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+char* insert_axiom_set(InteractiveSpec_p interactive,
+                       DStr_p axiomsname,
+                       ClauseSet_p cset,
+                       FormulaSet_p fset,
+                       DStr_p raw_data)
+{
+   AxiomSet_p axiom_set;
+   PStackPointer i;
+   AxiomSet_p    handle;
+
+   DStrSet(cset->identifier, DStrView(axiomsname));
+   DStrSet(fset->identifier, DStrView(axiomsname));
+
+   axiom_set = AxiomSetAlloc(cset, fset, raw_data, 0);
 
    int name_taken = 0;
    for(i=0; i<PStackGetSP(interactive->axiom_sets); i++)
@@ -256,6 +592,135 @@ char* add_command(InteractiveSpec_p interactive,
    }
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: axiom_image_name()
+//
+//   Return the name of the image file for the axiom set axiomsname
+//   in InteractiveImageDir.
+//
+// Global Variables: InteractiveImageDir
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static DStr_p axiom_image_name(DStr_p axiomsname)
+{
+   DStr_p res = DStrAlloc();
+
+   DStrAppendStr(res, InteractiveImageDir);
+   DStrAppendStr(res, "/");
+   DStrAppendDStr(res, axiomsname);
+   DStrAppendStr(res, ".eimg");
+
+   return res;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: load_axiom_image()
+//
+//   If there is an intact image of the (unchanged) library file
+//   source in InteractiveImageDir, add the axiom set from there and
+//   return the message for the client. Otherwise return NULL.
+//
+// Global Variables: InteractiveImageDir
+//
+// Side Effects    : Memory operations, changes term bank
+//
+/----------------------------------------------------------------------*/
+
+char* load_axiom_image(InteractiveSpec_p interactive,
+                       DStr_p axiomsname,
+                       char* source,
+                       DStr_p raw_data)
+{
+   DStr_p      name = axiom_image_name(axiomsname);
+   SpecImage_p image = NULL;
+   PStack_p    sources = PStackAlloc(),
+               csets = PStackAlloc(),
+               fsets = PStackAlloc();
+   char        *res = NULL;
+
+   PStackPushP(sources, source);
+   if(SpecImageFileIsImage(DStrView(name)))
+   {
+      image = SpecImageOpen(DStrView(name));
+   }
+   if(image && SpecImageMatchesSources(image, sources, NULL))
+   {
+      SpecImageLoad(image, interactive->ctrl->terms, csets, fsets,
+                    &(interactive->ctrl->parsed_includes));
+      assert(PStackGetSP(csets) == 1 && PStackGetSP(fsets) == 1);
+      res = insert_axiom_set(interactive, axiomsname,
+                             PStackTopP(csets), PStackTopP(fsets),
+                             raw_data);
+   }
+   if(image)
+   {
+      SpecImageClose(image);
+   }
+   PStackFree(fsets);
+   PStackFree(csets);
+   PStackFree(sources);
+   DStrFree(name);
+
+   return res;
+}
+
+/*-----------------------------------------------------------------------
+//
+// Function: save_axiom_image()
+//
+//   Write an image of the just added axiom set axiomsname, parsed
+//   from the library file source, to InteractiveImageDir. The
+//   include files parsed for it are those in the spec's parsed
+//   includes but not in known_includes.
+//
+// Global Variables: InteractiveImageDir
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void save_axiom_image(InteractiveSpec_p interactive,
+                      DStr_p axiomsname,
+                      char* source,
+                      StrTree_p known_includes)
+{
+   DStr_p     name = axiom_image_name(axiomsname);
+   AxiomSet_p handle = PStackTopP(interactive->axiom_sets);
+   PStack_p   sources = PStackAlloc(),
+              csets = PStackAlloc(),
+              fsets = PStackAlloc(),
+              trav;
+   StrTree_p  includes = NULL, cell;
+   IntOrP     dummy = {0};
+
+   trav = StrTreeTraverseInit(interactive->ctrl->parsed_includes);
+   while((cell = StrTreeTraverseNext(trav)))
+   {
+      if(!StrTreeFind(&known_includes, cell->key))
+      {
+         StrTreeStore(&includes, cell->key, dummy, dummy);
+      }
+   }
+   StrTreeTraverseExit(trav);
+
+   PStackPushP(sources, source);
+   PStackPushP(csets, handle->cset);
+   PStackPushP(fsets, handle->fset);
+   SpecImageSave(DStrView(name), interactive->ctrl->terms, csets, fsets,
+                 sources, includes, NULL);
+
+   StrTreeFree(includes);
+   PStackFree(fsets);
+   PStackFree(csets);
+   PStackFree(sources);
+   DStrFree(name);
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function:
@@ -620,10 +1085,12 @@ char* unstage_command(InteractiveSpec_p interactive, DStr_p axiom_set)
 
 char* load_command(InteractiveSpec_p interactive, DStr_p filename)
 {
-   PStack_p files;
+   PStack_p files, trav;
    DStr_p handle, file_content;
    char *ret;
    int found;
+   StrTree_p known, cell;
+   IntOrP dummy = {0};
 
    if(DStrLen(interactive->server_lib))
    {
@@ -653,8 +1120,31 @@ char* load_command(InteractiveSpec_p interactive, DStr_p filename)
             DStrAppendStr(handle, "/");
             DStrAppendDStr(handle, filename);
             FileLoad(DStrView(handle), file_content);
+            ret = NULL;
+            if(InteractiveImageDir)
+            {
+               ret = load_axiom_image(interactive, filename,
+                                      DStrView(handle), file_content);
+            }
+            if(!ret)
+            {
+               known = NULL;
+               trav = StrTreeTraverseInit(interactive->ctrl->parsed_includes);
+               while((cell = StrTreeTraverseNext(trav)))
+               {
+                  StrTreeStore(&known, cell->key, dummy, dummy);
+               }
+               StrTreeTraverseExit(trav);
+               ret = add_command(interactive, filename, file_content);
+               if(InteractiveImageDir &&
+                  strcmp(ret, OK_ADDED_MESSAGE) == 0)
+               {
+                  save_axiom_image(interactive, filename,
+                                   DStrView(handle), known);
+               }
+               StrTreeFree(known);
+            }
             DStrFree(handle);
-            ret = add_command(interactive, filename, file_content);
             if( strcmp(ret, OK_ADDED_MESSAGE) == 0 )
             {
                ret = OK_LOADED_MESSAGE;
@@ -821,7 +1311,8 @@ void AcceptAxiomSetName(Scanner_p in, DStr_p dest){
 InteractiveSpec_p InteractiveSpecAlloc(BatchSpec_p spec,
                                        StructFOFSpec_p ctrl,
                                        FILE* fp,
-                                       int sock_fd)
+                                       int sock_fd,
+                                       int max_jobs)
 {
    InteractiveSpec_p handle = InteractiveSpecCellAlloc();
    handle->spec = spec;
@@ -830,6 +1321,10 @@ InteractiveSpec_p InteractiveSpecAlloc(BatchSpec_p spec,
    handle->sock_fd = sock_fd;
    handle->axiom_sets = PStackAlloc();
    handle->server_lib = DStrAlloc();
+   handle->max_jobs = max_jobs;
+   handle->queued_jobs = PQueueAlloc();
+   handle->running_jobs = PStackAlloc();
+   handle->job_procs = EPCtrlSetAlloc();
    return handle;
 }
 
@@ -839,10 +1334,11 @@ InteractiveSpec_p InteractiveSpecAlloc(BatchSpec_p spec,
 // Function: InteractiveSpecFree()
 //
 //   Free an interactive spec structure. The BatchSpec struct and StructFOFSpec are not freed.
+//   Running jobs are killed.
 //
 // Global Variables: -
 //
-// Side Effects    : Memory management
+// Side Effects    : Memory management, kills processes
 //
 /----------------------------------------------------------------------*/
 
@@ -850,6 +1346,22 @@ void InteractiveSpecFree(InteractiveSpec_p spec)
 {
    PStackPointer i;
    AxiomSet_p   handle;
+   InteractiveJob_p job;
+
+   while(!PQueueEmpty(spec->queued_jobs))
+   {
+      job = PQueueGetNextP(spec->queued_jobs);
+      InteractiveJobFree(job);
+   }
+   PQueueFree(spec->queued_jobs);
+   while(!PStackEmpty(spec->running_jobs))
+   {
+      job = PStackPopP(spec->running_jobs);
+      job->proc = NULL; /* Freed with job_procs */
+      InteractiveJobFree(job);
+   }
+   PStackFree(spec->running_jobs);
+   EPCtrlSetFree(spec->job_procs, false);
 
    for(i=0; i<PStackGetSP(spec->axiom_sets); i++)
    {
@@ -910,6 +1422,57 @@ void AxiomSetFree(AxiomSet_p axiom_set)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: InteractiveJobAlloc()
+//
+//   Allocate an initialized (queued) job with copies of name and
+//   input.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+InteractiveJob_p InteractiveJobAlloc(DStr_p name,
+                                     DStr_p input,
+                                     long wct_limit,
+                                     long cpu_limit)
+{
+   InteractiveJob_p handle = InteractiveJobCellAlloc();
+   handle->name = DStrAlloc();
+   DStrAppendDStr(handle->name, name);
+   handle->input = DStrAlloc();
+   DStrAppendDStr(handle->input, input);
+   handle->wct_limit = wct_limit;
+   handle->cpu_limit = cpu_limit;
+   handle->proc = NULL;
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: InteractiveJobFree()
+//
+//   Free a job. The process control block (if any) is not freed.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory management
+//
+/----------------------------------------------------------------------*/
+
+void InteractiveJobFree(InteractiveJob_p job)
+{
+   assert(!job->proc);
+   DStrFree(job->name);
+   DStrFree(job->input);
+   InteractiveJobCellFree(job);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: StartDeductionServer()
@@ -927,18 +1490,20 @@ void StartDeductionServer(BatchSpec_p spec,
                           StructFOFSpec_p ctrl,
                           char* server_lib,
                           FILE* fp,
-                          int sock_fd)
+                          int sock_fd,
+                          int max_jobs)
 {
    DStr_p input   = DStrAlloc();
    DStr_p dummyStr = DStrAlloc();
    InteractiveSpec_p interactive;
    bool done = false;
    Scanner_p in;
+   long wct_limit, cpu_limit;
 
    char* dummy;
    DStr_p input_command = DStrAlloc();
 
-   interactive = InteractiveSpecAlloc(spec, ctrl, fp, sock_fd);
+   interactive = InteractiveSpecAlloc(spec, ctrl, fp, sock_fd, max_jobs);
    if(server_lib)
    {
       DStrAppendStr(interactive->server_lib,server_lib);
@@ -952,6 +1517,7 @@ void StartDeductionServer(BatchSpec_p spec,
       /*print_to_outstream(message, fp, sock_fd);*/
       if( sock_fd != -1)
       {
+         wait_for_command(interactive);
          dummy = TCPStringRecvX(sock_fd);
          DStrAppendBuffer(input, dummy, strlen(dummy));
          FREE(dummy);
@@ -1030,6 +1596,16 @@ void StartDeductionServer(BatchSpec_p spec,
          DStrReset(dummyStr);
          DStrAppendDStr(dummyStr, AktToken(in)->literal);
          AcceptInpTok(in, Identifier);
+         wct_limit = 0;
+         cpu_limit = 0;
+         if(TestInpTok(in, PosInt))
+         {
+            wct_limit = ParseIntLimited(in, 1, LONG_MAX);
+            if(TestInpTok(in, PosInt))
+            {
+               cpu_limit = ParseIntLimited(in, 1, LONG_MAX);
+            }
+         }
          DStrReset(input);
          if(sock_fd != -1)
          {
@@ -1039,13 +1615,20 @@ void StartDeductionServer(BatchSpec_p spec,
          {
             ReadTextBlock(input, stdin, END_OF_BLOCK_TOKEN);
          }
-         print_to_outstream(run_command(interactive, dummyStr, input), fp, sock_fd);
+         print_to_outstream(run_command(interactive, dummyStr, input,
+                                        wct_limit, cpu_limit),
+                            fp, sock_fd);
       }
       else if(TestInpId(in, LIST_COMMAND))
       {
          AcceptInpId(in, LIST_COMMAND);
          print_to_outstream(list_command(interactive), fp, sock_fd);
       }
+      else if(TestInpId(in, STATUS_COMMAND))
+      {
+         AcceptInpId(in, STATUS_COMMAND);
+         print_to_outstream(status_command(interactive), fp, sock_fd);
+      }
       else if(TestInpId(in, HELP_COMMAND))
       {
          AcceptInpId(in, HELP_COMMAND);
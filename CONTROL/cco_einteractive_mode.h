@@ -16,6 +16,11 @@ Contents
 
 Changes
 
+<1> Sat Oct 17 2026
+    Concurrent jobs (InteractiveJobCell).
+<2> Sat Oct 17 2026
+    Axiom images for loaded axiom sets (InteractiveImageDir).
+
 -----------------------------------------------------------------------*/
 
 #ifndef CCO_EINTERACTIVE_MODE
@@ -28,8 +33,10 @@ Changes
 #include <cio_network.h>
 #include <clb_dstrings.h>
 #include <clb_pstacks.h>
+#include <clb_pqueue.h>
 #include <cio_scanner.h>
 #include <cco_batch_spec.h>
+#include <cco_spec_image.h>
 #include <dirent.h>
 #include <sys/wait.h>
 
@@ -46,6 +53,20 @@ typedef struct axiom_set_cell
   DStr_p raw_data;
 } AxiomSetCell, *AxiomSet_p;
 
+/* A proof job submitted with RUN. Jobs wait in a queue until one of
+   the max_jobs slots of the session is free, then run in a forked
+   process. The output of the process is collected and sent to the
+   client when it terminates. */
+
+typedef struct interactive_job_cell
+{
+  DStr_p name;
+  DStr_p input;
+  long wct_limit;   /* Seconds, for the whole job */
+  long cpu_limit;   /* Seconds, for each process of the job */
+  EPCtrl_p proc;    /* NULL while the job is queued */
+} InteractiveJobCell, *InteractiveJob_p;
+
 typedef struct interactive_spec_cell
 {
   BatchSpec_p spec;
@@ -54,6 +75,10 @@ typedef struct interactive_spec_cell
   int sock_fd;
   PStack_p axiom_sets;
   DStr_p server_lib;
+  int max_jobs;
+  PQueue_p queued_jobs;
+  PStack_p running_jobs;
+  EPCtrlSet_p job_procs; /* Processes of the running jobs */
 } InteractiveSpecCell, *InteractiveSpec_p;
 
 
@@ -64,10 +89,20 @@ typedef struct interactive_spec_cell
 #define InteractiveSpecCellAlloc()    (InteractiveSpecCell*)SizeMalloc(sizeof(InteractiveSpecCell))
 #define InteractiveSpecCellFree(junk) SizeFree(junk, sizeof(InteractiveSpecCell))
 
+/* A job is killed if it is still running this many seconds after its
+   wall-clock limit. */
+#define INTERACTIVE_JOB_GRACE_TIME 5
+
+/* Default for the number of jobs a session runs concurrently */
+#define INTERACTIVE_DEFAULT_MAX_JOBS 1
+
+extern char* InteractiveImageDir;
+
 InteractiveSpec_p InteractiveSpecAlloc(BatchSpec_p spec,
                                        StructFOFSpec_p ctrl,
                                        FILE* fp,
-                                       int sock_fd);
+                                       int sock_fd,
+                                       int max_jobs);
 
 void InteractiveSpecFree(InteractiveSpec_p spec);
 
@@ -82,11 +117,22 @@ AxiomSet_p AxiomSetAlloc(ClauseSet_p cset,
 
 void AxiomSetFree(AxiomSet_p axiomset);
 
+#define InteractiveJobCellAlloc()    (InteractiveJobCell*)SizeMalloc(sizeof(InteractiveJobCell))
+#define InteractiveJobCellFree(junk) SizeFree(junk, sizeof(InteractiveJobCell))
+
+InteractiveJob_p InteractiveJobAlloc(DStr_p name,
+                                     DStr_p input,
+                                     long wct_limit,
+                                     long cpu_limit);
+
+void InteractiveJobFree(InteractiveJob_p job);
+
 void StartDeductionServer(BatchSpec_p spec,
                           StructFOFSpec_p ctrl,
                           char* server_lib,
                           FILE* fp,
-                          int sock_fd);
+                          int sock_fd,
+                          int max_jobs);
 
 #endif
 
@@ -41,27 +41,94 @@
 
 /*-----------------------------------------------------------------------
 //
-// Function: forward_contract_keep()
+// Function: forward_contract_subsumed()
 //
-//   Apply all forward-contracting inferences to clause. Return NULL
-//   if it becomes trivial, a FVPackedClause containing it
-//   otherwise. Does not delete clause. Subsumed and trivial clauses
-//   are counted in the cells pointed to by the 4th and 5th
-//   argument. Provide dummies to avoid this.
+//   Document that pclause->clause is subsumed by subsumer, count it
+//   and unpack it (the clause itself is not freed).
+//
+// Global Variables: OutputLevel, GlobalOut
+//
+// Side Effects    : Output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void forward_contract_subsumed(FVPackedClause_p pclause,
+                                      Clause_p subsumer,
+                                      unsigned long* subsumed_count)
+{
+   DocClauseQuote(GlobalOut, OutputLevel, 6, pclause->clause,
+                  "subsumed", subsumer);
+   (*subsumed_count)++;
+   FVUnpackClause(pclause);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: forward_contract_finish()
+//
+//   Last part of forward_contract_keep() for a clause that has not
+//   been found redundant: Apply contextual simplify-reflect (if
+//   requested), select literals and mark maximal terms. Return the
+//   (possibly repacked) clause.
 //
 // Global Variables: -
 //
-// Side Effects    : Marks maximals terms and literals in the clause.
+// Side Effects    : Changes the clause
 //
 /----------------------------------------------------------------------*/
 
-static FVPackedClause_p forward_contract_keep(ProofState_p state, ProofControl_p
-                                              control, Clause_p clause, unsigned long*
-                                              subsumed_count, unsigned long* trivial_count,
-                                              bool non_unit_subsumption,
-                                              bool context_sr,
-                                              bool condense,
-                                              RewriteLevel level)
+static FVPackedClause_p forward_contract_finish(ProofState_p state,
+                                                ProofControl_p control,
+                                                FVPackedClause_p pclause,
+                                                bool context_sr)
+{
+   Clause_p clause = pclause->clause;
+
+   if(context_sr && ClauseLiteralNumber(clause) > 1)
+   {
+      state->context_sr_count +=
+         ClauseContextualSimplifyReflect(state->processed_non_units,
+                                         clause);
+      ClauseSubsumeOrderSortLits(clause);
+      pclause = FVIndexPackClause(FVUnpackClause(pclause),
+                                  state->processed_non_units->fvindex);
+   }
+   ClauseDelProp(clause, CPIsOriented);
+   DoLiteralSelection(control, clause);
+   ClauseCondMarkMaximalTerms(control->ocb, clause);
+
+   return pclause;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: forward_contract_modify()
+//
+//   First part of forward_contract_keep(): Apply the modifying
+//   inferences and the cheap redundancy tests (including subsumption
+//   by unit clauses) to clause. Return NULL if it becomes redundant,
+//   a FVPackedClause containing it otherwise. In this case, *done is
+//   set to false if clause still needs the non-unit subsumption test
+//   (it then is in subsumption order) and forward_contract_finish().
+//
+// Global Variables: -
+//
+// Side Effects    : Changes clause, counts redundant clauses.
+//
+/----------------------------------------------------------------------*/
+
+static FVPackedClause_p forward_contract_modify(ProofState_p state,
+                                                ProofControl_p control,
+                                                Clause_p clause,
+                                                unsigned long* subsumed_count,
+                                                unsigned long* trivial_count,
+                                                bool non_unit_subsumption,
+                                                bool context_sr,
+                                                bool condense,
+                                                RewriteLevel level,
+                                                bool *done)
 {
    FVPackedClause_p pclause;
    Clause_p subsumer = 0;
@@ -70,6 +137,7 @@ static FVPackedClause_p forward_contract_keep(ProofState_p state, ProofControl_p
    assert(clause);
    assert(state);
 
+   *done = true;
    if(control->heuristic_parms.enable_given_forward_simpl)
    {
       trivial = ForwardModifyClause(state, control, clause,
@@ -117,49 +185,81 @@ static FVPackedClause_p forward_contract_keep(ProofState_p state, ProofControl_p
          subsumer = UnitClauseSetSubsumesClause(state->processed_neg_units,
                                                 clause);
       }
-      if(!subsumer && (ClauseLiteralNumber(clause)>1) && non_unit_subsumption)
-      {
-         ClauseSubsumeOrderSortLits(clause);
-         subsumer = ClauseSetSubsumesFVPackedClause(state->processed_non_units, pclause);
-      }
       if(subsumer)
       {
-         DocClauseQuote(GlobalOut, OutputLevel, 6, pclause->clause,
-                        "subsumed", subsumer);
-         (*subsumed_count)++;
-         FVUnpackClause(pclause);
-         ENSURE_NULL(pclause);
+         forward_contract_subsumed(pclause, subsumer, subsumed_count);
          return NULL;
       }
-      if(context_sr && ClauseLiteralNumber(clause) > 1)
+      if((ClauseLiteralNumber(clause)>1) && non_unit_subsumption)
       {
-         state->context_sr_count +=
-            ClauseContextualSimplifyReflect(state->processed_non_units,
-                                            clause);
          ClauseSubsumeOrderSortLits(clause);
-         pclause = FVIndexPackClause(FVUnpackClause(pclause),
-                                state->processed_non_units->fvindex);
-
       }
+      *done = false;
+      return pclause;
    }
-   else /* !control->enable_given_forward_simpl -- this is just a
-         * minimal subset of what is done above*/
+   /* !control->enable_given_forward_simpl -- this is just a minimal
+    * subset of what is done above*/
+   if(ClauseIsEmpty(clause))
    {
-      if(ClauseIsEmpty(clause))
-      {
-         return FVIndexPackClause(clause, NULL);
-      }
-      clause->weight = ClauseStandardWeight(clause);
-      pclause = FVIndexPackClause(clause, state->processed_non_units->fvindex);
+      return FVIndexPackClause(clause, NULL);
    }
-   ClauseDelProp(clause, CPIsOriented);
-   DoLiteralSelection(control, clause);
-   ClauseCondMarkMaximalTerms(control->ocb, clause);
+   clause->weight = ClauseStandardWeight(clause);
+   pclause = FVIndexPackClause(clause, state->processed_non_units->fvindex);
+   forward_contract_finish(state, control, pclause, false);
 
    return pclause;
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: forward_contract_keep()
+//
+//   Apply all forward-contracting inferences to clause. Return NULL
+//   if it becomes trivial, a FVPackedClause containing it
+//   otherwise. Does not delete clause. Subsumed and trivial clauses
+//   are counted in the cells pointed to by the 4th and 5th
+//   argument. Provide dummies to avoid this.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks maximals terms and literals in the clause.
+//
+/----------------------------------------------------------------------*/
+
+static FVPackedClause_p forward_contract_keep(ProofState_p state, ProofControl_p
+                                              control, Clause_p clause, unsigned long*
+                                              subsumed_count, unsigned long* trivial_count,
+                                              bool non_unit_subsumption,
+                                              bool context_sr,
+                                              bool condense,
+                                              RewriteLevel level)
+{
+   FVPackedClause_p pclause;
+   Clause_p subsumer = 0;
+   bool done;
+
+   pclause = forward_contract_modify(state, control, clause,
+                                     subsumed_count, trivial_count,
+                                     non_unit_subsumption, context_sr,
+                                     condense, level, &done);
+   if(!pclause || done)
+   {
+      return pclause;
+   }
+   if((ClauseLiteralNumber(clause)>1) && non_unit_subsumption)
+   {
+      subsumer = ClauseSetSubsumesFVPackedClause(state->processed_non_units, pclause);
+   }
+   if(subsumer)
+   {
+      forward_contract_subsumed(pclause, subsumer, subsumed_count);
+      return NULL;
+   }
+   return forward_contract_finish(state, control, pclause, context_sr);
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -287,6 +387,94 @@ FVPackedClause_p ForwardContractClause(ProofState_p state,
    return res;
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: ForwardContractClauseBatch()
+//
+//   Forward-contract all clauses in batch with the (unchanged)
+//   processed clauses, with the same result as ForwardContractClause()
+//   with non-unit subsumption for each of them. Each entry of batch
+//   is replaced by the packed clause, or by NULL if the clause has
+//   been deleted. The modifying inferences run in the calling thread
+//   (they insert terms into the shared term bank). Non-unit forward
+//   subsumption of all clauses of the batch is done together by
+//   ClauseSetFindFVSubsumersPar(), i.e. distributed over the workers
+//   of par if it is not NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes and frees clauses, memory operations,
+//                   runs jobs in par->pool
+//
+/----------------------------------------------------------------------*/
+
+void ForwardContractClauseBatch(ProofState_p state,
+                                ProofControl_p control,
+                                PStack_p batch,
+                                bool context_sr,
+                                bool condense,
+                                RewriteLevel level,
+                                ParSubsume_p par)
+{
+   FVPackedClause_p pclause;
+   Clause_p         clause, *subsumers;
+   PStack_p         open    = PStackAlloc(),
+                    members = PStackAlloc();
+   PStackPointer    i, j, k = 0;
+   bool             done;
+
+   for(i=0; i<PStackGetSP(batch); i++)
+   {
+      clause  = PStackElementP(batch, i);
+      pclause = forward_contract_modify(state, control, clause,
+                                        &(state->proc_forward_subsumed_count),
+                                        &(state->proc_trivial_count),
+                                        true, context_sr, condense,
+                                        level, &done);
+      if(!pclause)
+      {
+         ClauseFree(clause);
+      }
+      else if(!done)
+      {
+         PStackPushInt(open, i);
+         if(ClauseLiteralNumber(clause)>1)
+         {
+            PStackPushP(members, pclause);
+         }
+      }
+      PStackAssignP(batch, i, pclause);
+   }
+   subsumers = SizeMalloc((PStackGetSP(members)+1)*sizeof(Clause_p));
+   ClauseSetFindFVSubsumersPar(state->processed_non_units, members,
+                               subsumers, par);
+
+   for(j=0; j<PStackGetSP(open); j++)
+   {
+      i       = PStackElementInt(open, j);
+      pclause = PStackElementP(batch, i);
+      clause  = pclause->clause;
+      if(ClauseLiteralNumber(clause)>1 && subsumers[k++])
+      {
+         forward_contract_subsumed(pclause, subsumers[k-1],
+                                   &(state->proc_forward_subsumed_count));
+         ClauseFree(clause);
+         PStackAssignP(batch, i, NULL);
+      }
+      else
+      {
+         PStackAssignP(batch, i,
+                       forward_contract_finish(state, control, pclause,
+                                               context_sr));
+      }
+   }
+   assert(k == PStackGetSP(members));
+   SizeFree(subsumers, (PStackGetSP(members)+1)*sizeof(Clause_p));
+   PStackFree(members);
+   PStackFree(open);
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: ForwardContractSet()
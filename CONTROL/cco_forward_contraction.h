@@ -61,6 +61,14 @@ FVPackedClause_p ForwardContractClause(ProofState_p state,
                                        bool condense,
                                        RewriteLevel level);
 
+void ForwardContractClauseBatch(ProofState_p state,
+                                ProofControl_p control,
+                                PStack_p batch,
+                                bool context_sr,
+                                bool condense,
+                                RewriteLevel level,
+                                ParSubsume_p par);
+
 Clause_p ForwardContractSet(ProofState_p state, ProofControl_p
                             control, ClauseSet_p set, bool
                             non_unit_subsumption, RewriteLevel level,
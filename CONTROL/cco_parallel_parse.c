@@ -0,0 +1,1434 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_parallel_parse.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Parsing and clausification of the input in forked worker
+  processes.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sat Oct 17 2026
+    New
+<2> Sat Oct 17 2026
+    Clausification in worker processes
+
+-----------------------------------------------------------------------*/
+
+#include <sys/wait.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "cco_parallel_parse.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Number of worker processes for parsing and clausifying the input
+   (1 means no parallel preprocessing) */
+
+int ParseWorkers = 1;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* A part of the input, parsed by one worker (start and end are
+   byte positions), or a range of formulas clausified by one worker
+   (start and end are indices). The worker writes an image of the
+   result to image, the derivation steps of clausification to ops,
+   and everything it prints to log. The array of units is shared
+   with the workers, which report the number of clause identifiers
+   they used in clause_allocs, and the state of their variable bank
+   for the default type (see VarMapCell) in the var_ fields. */
+
+typedef struct parse_unit_cell
+{
+   long  start;
+   long  end;
+   bool  is_include;
+   char  *image;
+   char  *ops;
+   char  *log;
+   pid_t pid;
+   bool  ok;
+   long  clause_allocs;
+   bool  var_ok;
+   bool  var_shift;
+   long  var_size;
+   long  var_count;
+}ParseUnitCell, *ParseUnit_p;
+
+/* Variables are handed out by the variable bank in the order of a
+   stack per type, starting at a counter that keeps running over
+   formulas (and is reset for each clause). A worker starts with the
+   bank as it was at the fork, so the parent maps the variables of
+   its image to the stack positions the sequential code would have
+   used: Positions from base on are moved to target, new positions
+   are filled as by VarBankGetFreshVar(). This is only done for
+   variables of the default type, and only if the worker created no
+   other variables (checked with the state at the fork kept here). */
+
+typedef struct var_map_cell
+{
+   VarBank_p vars;
+   Type_p    type;
+   PDArray_p positions; /* Position+1 of the initial variables */
+   PDArray_p counts;    /* Initial counters for all types */
+   long      size;      /* Initial stack size */
+   FunCode   fresh;     /* Initial fresh_count */
+   long      count;     /* Initial counter */
+   long      base;
+   long      target;
+}VarMapCell, *VarMap_p;
+
+/* Function run in the worker process of a unit. It gets the unit
+   and the job description given to run_workers(). */
+
+typedef void (*UnitWorkerFun)(ParseUnit_p unit, void* data);
+
+/* Everything the workers for parsing and for clausification need,
+   respectively. */
+
+typedef struct parse_job_cell
+{
+   Scanner_p in;
+   TB_p      terms;
+   StrTree_p *skip_includes;
+   VarMap_p  var_map;
+}ParseJobCell, *ParseJob_p;
+
+typedef struct cnf_job_cell
+{
+   PStack_p  forms;
+   TB_p      terms;
+   VarBank_p fresh_vars;
+   long      miniscope_limit;
+   VarMap_p  var_map;
+}CNFJobCell, *CNFJob_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: find_statements()
+//
+//   Find the starts of all top-level statements in the TPTP text
+//   buf (of length len), skipping comments and quoted strings, and
+//   push them (and whether they are include directives) onto
+//   starts. Return false if the text cannot be split safely (typed
+//   or unknown statements, where later statements depend on earlier
+//   declarations, or unterminated comments or strings).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool find_statements(char* buf, long len, PStack_p starts)
+{
+   long i = 0, j;
+   char c, last = '.';
+   char *end;
+
+   while(i<len)
+   {
+      c = buf[i];
+      if(isspace((unsigned char)c))
+      {
+         i++;
+         continue;
+      }
+      if(c == '%' || c == '#')
+      {
+         end = memchr(buf+i, '\n', len-i);
+         i = end?(end-buf)+1:len;
+         continue;
+      }
+      if(c == '/' && i+1 < len && buf[i+1] == '*')
+      {
+         for(j=i+2; j+1<len && !(buf[j] == '*' && buf[j+1] == '/'); j++)
+         {
+            /* Nothing */
+         }
+         if(j+1 >= len)
+         {
+            return false;
+         }
+         i = j+2;
+         continue;
+      }
+      if(c == '\'' || c == '"')
+      {
+         for(j=i+1; j<len && buf[j] != c; j++)
+         {
+            if(buf[j] == '\\')
+            {
+               j++;
+            }
+            if(j<len && buf[j] == '\n')
+            {
+               return false;
+            }
+         }
+         if(j >= len)
+         {
+            return false;
+         }
+         i    = j+1;
+         last = c;
+         continue;
+      }
+      if(last == '.')
+      {
+         if(len-i > 4 &&
+            (strncmp(buf+i, "fof(", 4)==0 || strncmp(buf+i, "cnf(", 4)==0))
+         {
+            PStackPushInt(starts, i);
+            PStackPushInt(starts, false);
+         }
+         else if(len-i > 8 && strncmp(buf+i, "include(", 8)==0)
+         {
+            PStackPushInt(starts, i);
+            PStackPushInt(starts, true);
+         }
+         else
+         {
+            return false;
+         }
+      }
+      last = c;
+      i++;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: var_map_init()
+//
+//   Record the state of the variable bank of terms for the default
+//   type in map.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void var_map_init(VarMap_p map, TB_p terms)
+{
+   VarBankStack_p stack;
+   PStackPointer  i;
+   Term_p         var;
+
+   map->vars      = terms->vars;
+   map->type      = map->vars->sort_table->default_type;
+   stack          = VarBankGetStack(map->vars, map->type->type_uid);
+   map->positions = PDIntArrayAlloc(2*PStackGetSP(stack)+2, 0);
+   for(i=0; i<PStackGetSP(stack); i++)
+   {
+      var = PStackElementP(stack, i);
+      PDArrayAssignInt(map->positions, -var->f_code, i+1);
+   }
+   map->counts = PDArrayCopy(map->vars->v_counts);
+   map->size   = PStackGetSP(stack);
+   map->fresh  = map->vars->fresh_count;
+   map->count  = PDArrayElementInt(map->vars->v_counts,
+                                   map->type->type_uid);
+   map->base   = LONG_MAX;
+   map->target = LONG_MAX;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: var_map_free()
+//
+//   Free the data of map.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void var_map_free(VarMap_p map)
+{
+   PDArrayFree(map->positions);
+   PDArrayFree(map->counts);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: var_map_report()
+//
+//   Worker: Report the state of the variable bank to the unit, and
+//   whether it can be mapped (only variables of the default type
+//   were created, and, if check_counts, no others were used).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void var_map_report(VarMap_p map, ParseUnit_p unit,
+                           bool check_counts)
+{
+   VarBankStack_p stack = VarBankGetStack(map->vars, map->type->type_uid);
+   long           i;
+
+   unit->var_size  = PStackGetSP(stack);
+   unit->var_count = PDArrayElementInt(map->vars->v_counts,
+                                       map->type->type_uid);
+   unit->var_ok    = (map->vars->fresh_count-map->fresh ==
+                      2*(unit->var_size-map->size));
+   for(i=0; check_counts && i<PDArraySize(map->vars->v_counts); i++)
+   {
+      if(i != map->type->type_uid &&
+         PDArrayElementInt(map->vars->v_counts, i) !=
+         PDArrayElementInt(map->counts, i))
+      {
+         unit->var_ok = false;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: var_map_pos()
+//
+//   Return the position in the parent for a stack position (or
+//   counter value) of a worker.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long var_map_pos(VarMap_p map, long pos)
+{
+   return pos >= map->base? pos-map->base+map->target : pos;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: var_at_position()
+//
+//   Return the variable at position pos of the stack of the default
+//   type, creating variables up to it as VarBankGetFreshVar() does.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the variable bank
+//
+/----------------------------------------------------------------------*/
+
+static Term_p var_at_position(VarMap_p map, long pos)
+{
+   TypeUniqueID   uid   = map->type->type_uid;
+   VarBankStack_p stack = VarBankGetStack(map->vars, uid);
+   long           count = PDArrayElementInt(map->vars->v_counts, uid);
+
+   while(PStackGetSP(stack) <= pos)
+   {
+      PDArrayAssignInt(map->vars->v_counts, uid, PStackGetSP(stack));
+      VarBankGetFreshVar(map->vars, map->type);
+   }
+   PDArrayAssignInt(map->vars->v_counts, uid, count);
+   return PStackElementP(stack, pos);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: var_map_var()
+//
+//   ImageVarMapFun: Return the variable of the parent for a variable
+//   of a worker image, or NULL if it is not of the default type.
+//
+// Global Variables: -
+//
+// Side Effects    : May change the variable bank
+//
+/----------------------------------------------------------------------*/
+
+static Term_p var_map_var(void* data, FunCode f_code, Type_p type)
+{
+   VarMap_p map = data;
+   long     pos;
+
+   if(type != map->type)
+   {
+      return NULL;
+   }
+   if(-f_code <= map->fresh)
+   {
+      pos = PDArrayElementInt(map->positions, -f_code)-1;
+   }
+   else if((-f_code-map->fresh)%2 == 0)
+   {
+      pos = map->size+(-f_code-map->fresh)/2-1;
+   }
+   else
+   {
+      pos = -1;
+   }
+   if(pos < 0)
+   {
+      return NULL;
+   }
+   return var_at_position(map, var_map_pos(map, pos));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: var_map_finish()
+//
+//   After loading the image of a unit, bring the variable bank into
+//   the state it would have after processing the unit here.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the variable bank
+//
+/----------------------------------------------------------------------*/
+
+static void var_map_finish(VarMap_p map, ParseUnit_p unit)
+{
+   if(unit->var_size > map->size)
+   {
+      var_at_position(map, var_map_pos(map, unit->var_size-1));
+   }
+   PDArrayAssignInt(map->vars->v_counts, map->type->type_uid,
+                    var_map_pos(map, unit->var_count));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: init_units()
+//
+//   Initialize everything but the ranges (and include flags) of the
+//   count units.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void init_units(ParseUnit_p units, long count)
+{
+   long i;
+
+   for(i=0; i<count; i++)
+   {
+      units[i].image         = NULL;
+      units[i].ops           = NULL;
+      units[i].log           = NULL;
+      units[i].pid           = -1;
+      units[i].ok            = false;
+      units[i].clause_allocs = 0;
+      units[i].var_ok        = false;
+      units[i].var_shift     = false;
+      units[i].var_size      = 0;
+      units[i].var_count     = 0;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: build_units()
+//
+//   Group the statements found by find_statements() into units
+//   covering the input of length len: Each include directive is a
+//   unit of its own, other statements are collected into chunks of
+//   (about) chunk_size bytes. Store the units in res (which must
+//   have room for one unit per statement) and return their number.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long build_units(PStack_p starts, long len, long chunk_size,
+                        ParseUnit_p res)
+{
+   long          count = 0, start;
+   bool          is_include, last_include = false;
+   PStackPointer i;
+
+   res[0].start      = 0;
+   res[0].is_include = false;
+   for(i=0; i<PStackGetSP(starts); i+=2)
+   {
+      start      = PStackElementInt(starts, i);
+      is_include = PStackElementInt(starts, i+1);
+      if(i == 0)
+      {
+         res[0].is_include = is_include;
+      }
+      else if(is_include || last_include ||
+              start-res[count].start >= chunk_size)
+      {
+         res[count].end = start;
+         count++;
+         res[count].start      = start;
+         res[count].is_include = is_include;
+      }
+      last_include = is_include;
+   }
+   res[count].end = len;
+   count++;
+
+   init_units(res, count);
+   return count;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_unit_worker()
+//
+//   Worker process: Parse the unit and write the result as an image.
+//   Does not return.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, output, terminates the process
+//
+/----------------------------------------------------------------------*/
+
+static void parse_unit_worker(ParseUnit_p unit, void* data)
+{
+   ParseJob_p   job = data;
+   WFormula_p   form;
+   FormulaSet_p fset  = FormulaSetAlloc();
+   ClauseSet_p  wlset = ClauseSetAlloc();
+   PStack_p     csets = PStackAlloc(),
+                fsets = PStackAlloc(),
+                sources = PStackAlloc();
+   long         clause_count = ClauseGetAllocCount();
+
+   if(!ScannerSetRange(job->in, unit->start, unit->end))
+   {
+      _exit(EXIT_FAILURE);
+   }
+   FormulaAndClauseSetParse(job->in, fset, wlset, job->terms, NULL,
+                            job->skip_includes);
+   CheckInpTok(job->in, NoToken);
+   unit->clause_allocs = ClauseGetAllocCount()-clause_count;
+
+   /* Clauses reset the variable counter. If the unit starts with a
+      formula, its variables are shifted to where the counter of the
+      parent is, which is only possible if no clause follows. */
+   var_map_report(job->var_map, unit, true);
+   form = fset->anchor->succ;
+   unit->var_shift = (form != fset->anchor) && !form->is_clause;
+   for(; unit->var_shift && form != fset->anchor; form = form->succ)
+   {
+      if(form->is_clause)
+      {
+         unit->var_ok = false;
+      }
+   }
+   if(unit->var_shift && !ClauseSetEmpty(wlset))
+   {
+      unit->var_ok = false;
+   }
+
+   PStackPushP(csets, wlset);
+   PStackPushP(fsets, fset);
+   SpecImageSave(unit->image, job->terms, csets, fsets, sources,
+                 *(job->skip_includes), NULL);
+   fflush(stdout);
+   fflush(stderr);
+   _exit(EXIT_SUCCESS);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: run_workers()
+//
+//   Process all units with worker (which gets data as its second
+//   argument) in forked processes, with at most workers of them
+//   running at the same time. The output of each process goes to
+//   the log of its unit. Set unit->ok for all units that were
+//   processed successfully.
+//
+// Global Variables: -
+//
+// Side Effects    : Creates processes, temporary files
+//
+/----------------------------------------------------------------------*/
+
+static void run_workers(ParseUnit_p units, long count, int workers,
+                        UnitWorkerFun worker, void* data)
+{
+   long  next = 0, i;
+   int   running = 0, status, fd;
+   pid_t pid;
+
+   fflush(GlobalOut);
+   fflush(stdout);
+   fflush(stderr);
+   while(next < count || running)
+   {
+      while(next < count && running < workers)
+      {
+         units[next].image = TempFileName();
+         units[next].ops   = TempFileName();
+         units[next].log   = TempFileName();
+         units[next].pid   = fork();
+         if(units[next].pid == 0)
+         {
+            fd = open(units[next].log, O_WRONLY|O_TRUNC);
+            if(fd == -1 || dup2(fd, STDOUT_FILENO) == -1 ||
+               dup2(fd, STDERR_FILENO) == -1)
+            {
+               _exit(EXIT_FAILURE);
+            }
+            close(fd);
+            worker(&(units[next]), data);
+         }
+         if(units[next].pid != -1)
+         {
+            running++;
+         }
+         next++;
+      }
+      if(!running)
+      {
+         break;
+      }
+      pid = waitpid(-1, &status, 0);
+      if(pid == -1)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         break;
+      }
+      for(i=0; i<next; i++)
+      {
+         if(units[i].pid == pid)
+         {
+            units[i].ok  = WIFEXITED(status) && !WEXITSTATUS(status);
+            units[i].pid = -1;
+            running--;
+            break;
+         }
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: copy_log()
+//
+//   Copy the output of a worker to stderr.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void copy_log(char* log)
+{
+   FILE   *in = fopen(log, "r");
+   char   buf[4096];
+   size_t got;
+
+   if(!in)
+   {
+      return;
+   }
+   while((got = fread(buf, 1, sizeof(buf), in)))
+   {
+      fwrite(buf, 1, got, stderr);
+   }
+   fclose(in);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: include_status()
+//
+//   Compare the include files parsed for an image (minus those in
+//   known, which were already known before it was created) with
+//   those in current. Return 0 if none of them are in current, 1
+//   if all of them are, and -1 otherwise.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int include_status(SpecImage_p image, StrTree_p known,
+                          StrTree_p current)
+{
+   PStackPointer i;
+   char          *name;
+   long          new_no = 0, old_no = 0;
+
+   for(i=0; i<PStackGetSP(image->includes); i++)
+   {
+      name = PStackElementP(image->includes, i);
+      if(!StrTreeFind(&known, name))
+      {
+         if(StrTreeFind(&current, name))
+         {
+            old_no++;
+         }
+         else
+         {
+            new_no++;
+         }
+      }
+   }
+   if(!old_no)
+   {
+      return 0;
+   }
+   return new_no?-1:1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: merge_unit()
+//
+//   Move the result of a worker into fset and wlset, with variables
+//   as if it was parsed here. Return the number of elements, or -1
+//   if the unit needs to be parsed again (because it shares include
+//   files with earlier units, its variables cannot be mapped, or its
+//   image cannot be read).
+//
+// Global Variables: (via ClauseSetAllocCount())
+//
+// Side Effects    : Memory operations, changes term bank and sets
+//
+/----------------------------------------------------------------------*/
+
+static long merge_unit(ParseUnit_p unit, FormulaSet_p fset,
+                       ClauseSet_p wlset, TB_p terms,
+                       StrTree_p known, StrTree_p *skip_includes,
+                       VarMap_p var_map)
+{
+   SpecImage_p   image = SpecImageOpen(unit->image);
+   PStack_p      csets = PStackAlloc(),
+                 fsets = PStackAlloc();
+   ClauseSet_p   cset;
+   FormulaSet_p  tmp_fset;
+   long          res = 0, clause_count = ClauseGetAllocCount();
+
+   if(!image)
+   {
+      PStackFree(csets);
+      PStackFree(fsets);
+      return -1;
+   }
+   switch(include_status(image, known, *skip_includes))
+   {
+   case 0:
+         if(!unit->var_ok)
+         {
+            res = -1;
+            break;
+         }
+         var_map->base   = unit->var_shift?var_map->count:LONG_MAX;
+         var_map->target = PDArrayElementInt(terms->vars->v_counts,
+                                             var_map->type->type_uid);
+         res = SpecImageLoadMapped(image, terms, csets, fsets,
+                                   skip_includes, 0,
+                                   var_map_var, var_map);
+         var_map_finish(var_map, unit);
+         /* Clause identifiers continue as if the unit was parsed
+            here */
+         ClauseSetAllocCount(clause_count+unit->clause_allocs);
+         while(!PStackEmpty(csets))
+         {
+            tmp_fset = PStackPopP(fsets);
+            cset     = PStackPopP(csets);
+            FormulaSetInsertSet(fset, tmp_fset);
+            ClauseSetInsertSet(wlset, cset);
+            FormulaSetFree(tmp_fset);
+            ClauseSetFree(cset);
+         }
+         copy_log(unit->log);
+         break;
+   case 1:
+         /* All includes already parsed before, the sequential parser
+            would have skipped them */
+         break;
+   default:
+         res = -1;
+         break;
+   }
+   SpecImageClose(image);
+   PStackFree(csets);
+   PStackFree(fsets);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: remove_unit_files()
+//
+//   Remove the temporary files of all units that were started.
+//
+// Global Variables: -
+//
+// Side Effects    : Removes files, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void remove_unit_files(ParseUnit_p units, long count)
+{
+   long i;
+
+   for(i=0; i<count; i++)
+   {
+      if(units[i].image)
+      {
+         TempFileRemove(units[i].image);
+         FREE(units[i].image);
+         TempFileRemove(units[i].ops);
+         FREE(units[i].ops);
+         TempFileRemove(units[i].log);
+         FREE(units[i].log);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ops_put()
+//
+//   Write a single word of clausification data.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void ops_put(FILE* out, long word)
+{
+   fwrite(&word, sizeof(long), 1, out);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ops_get()
+//
+//   Read a single word of clausification data written by a worker.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, terminates on error
+//
+/----------------------------------------------------------------------*/
+
+static long ops_get(FILE* in, char* name)
+{
+   long word;
+
+   if(fread(&word, sizeof(long), 1, in) != 1)
+   {
+      Error("%s: Clausification data is truncated", OTHER_ERROR, name);
+   }
+   return word;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ops_put_derivation()
+//
+//   Write the number and the op-codes of the derivation steps on
+//   derivation (which may be NULL) from sp on. If form is non-NULL,
+//   the first step has to have form as its only argument (which is
+//   not written). All (other) steps must not have arguments, as
+//   they cannot be transferred. Return false if this does not hold.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static bool ops_put_derivation(FILE* out, PStack_p derivation,
+                               PStackPointer sp, WFormula_p form)
+{
+   PStackPointer  end = derivation?PStackGetSP(derivation):0;
+   DerivationCode op;
+
+   if(form)
+   {
+      if(end-sp < 2 || PStackElementP(derivation, sp+1) != form)
+      {
+         return false;
+      }
+      op = PStackElementInt(derivation, sp);
+      if(!DCOpHasFofArg1(op) || DCOpHasArg2(op))
+      {
+         return false;
+      }
+      ops_put(out, end-sp-1);
+      ops_put(out, op);
+      sp += 2;
+   }
+   else
+   {
+      ops_put(out, end-sp);
+   }
+   for(; sp<end; sp++)
+   {
+      op = PStackElementInt(derivation, sp);
+      if(DCOpHasArg1(op) || DCOpHasArg2(op))
+      {
+         return false;
+      }
+      ops_put(out, op);
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_unit_worker()
+//
+//   Worker process: Clausify the formulas of the unit and write the
+//   clauses and final formulas as an image, and their derivation
+//   steps and clause identifiers to the ops file of the unit. Does
+//   not return.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, terminates the process
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_unit_worker(ParseUnit_p unit, void* data)
+{
+   CNFJob_p      job = data;
+   FormulaSet_p  fset  = FormulaSetAlloc();
+   ClauseSet_p   cset  = ClauseSetAlloc();
+   PStack_p      csets = PStackAlloc(),
+                 fsets = PStackAlloc();
+   WFormula_p    form;
+   Clause_p      last, clause;
+   PStackPointer sp;
+   FILE          *out;
+   long          i, clause_no, clause_count = ClauseGetAllocCount();
+
+   out = fopen(unit->ops, "w");
+   if(!out)
+   {
+      _exit(EXIT_FAILURE);
+   }
+   for(i=unit->start; i<unit->end; i++)
+   {
+      form = PStackElementP(job->forms, i);
+      FormulaSetExtractEntry(form);
+      sp   = PStackGetSP(form->derivation);
+      last = cset->anchor->pred;
+      clause_no = WFormulaCNF2(form, cset, job->terms, job->fresh_vars,
+                               job->miniscope_limit);
+      FormulaSetInsert(fset, form);
+      if(!ops_put_derivation(out, form->derivation, sp, NULL))
+      {
+         _exit(EXIT_FAILURE);
+      }
+      ops_put(out, clause_no);
+      for(clause = last->succ; clause!=cset->anchor; clause = clause->succ)
+      {
+         ops_put(out, clause->ident-clause_count);
+         if(!ops_put_derivation(out, clause->derivation, 0, form))
+         {
+            _exit(EXIT_FAILURE);
+         }
+      }
+   }
+   unit->clause_allocs = ClauseGetAllocCount()-clause_count;
+   var_map_report(job->var_map, unit, false);
+   unit->var_shift = true;
+   if(ferror(out) || fclose(out) != 0)
+   {
+      _exit(EXIT_FAILURE);
+   }
+   PStackPushP(csets, cset);
+   PStackPushP(fsets, fset);
+   SpecImageSave(unit->image, job->terms, csets, fsets, NULL, NULL, NULL);
+   fflush(stdout);
+   fflush(stderr);
+   _exit(EXIT_SUCCESS);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: merge_cnf_unit()
+//
+//   Move the result of a clausification worker into clauseset, as
+//   if the formulas of the unit were clausified here: New Skolem
+//   symbols and definition predicates (those above fresh_from) are
+//   renamed, variables are mapped (if possible), the final formulas
+//   and derivation steps are transferred to the original formulas,
+//   and the clauses get the identifiers they would have had. Return
+//   the number of clauses, or -1 if the result cannot be read.
+//
+// Global Variables: (via ClauseSetAllocCount())
+//
+// Side Effects    : Memory operations, changes term bank, signature,
+//                   formulas and clauseset
+//
+/----------------------------------------------------------------------*/
+
+static long merge_cnf_unit(ParseUnit_p unit, PStack_p forms,
+                           ClauseSet_p clauseset, TB_p terms,
+                           FunCode fresh_from, VarMap_p var_map)
+{
+   SpecImage_p   image = SpecImageOpen(unit->image);
+   FILE          *in;
+   PStack_p      csets, fsets;
+   ClauseSet_p   cset;
+   FormulaSet_p  fset;
+   WFormula_p    form, tmp;
+   Clause_p      clause;
+   long          i, j, k, clause_no, op_no, res = 0,
+                 clause_count = ClauseGetAllocCount();
+
+   if(!image)
+   {
+      return -1;
+   }
+   in = fopen(unit->ops, "r");
+   if(!in)
+   {
+      SpecImageClose(image);
+      return -1;
+   }
+   csets = PStackAlloc();
+   fsets = PStackAlloc();
+   /* Variables renamed in the workers are new ones after those
+      already in the stack */
+   if(unit->var_ok)
+   {
+      var_map->base   = var_map->size;
+      var_map->target = PStackGetSP(VarBankGetStack(terms->vars,
+                                                    var_map->type->type_uid));
+      SpecImageLoadMapped(image, terms, csets, fsets, NULL, fresh_from,
+                          var_map_var, var_map);
+      var_map_finish(var_map, unit);
+   }
+   else
+   {
+      SpecImageLoadMapped(image, terms, csets, fsets, NULL, fresh_from,
+                          NULL, NULL);
+   }
+   SpecImageClose(image);
+   assert(PStackGetSP(csets) == 1);
+   cset = PStackPopP(csets);
+   fset = PStackPopP(fsets);
+
+   for(i=unit->start; i<unit->end; i++)
+   {
+      form = PStackElementP(forms, i);
+      tmp  = FormulaSetExtractFirst(fset);
+      form->tformula = tmp->tformula;
+      WFormulaFree(tmp);
+      op_no = ops_get(in, unit->ops);
+      for(j=0; j<op_no; j++)
+      {
+         WFormulaPushDerivation(form, ops_get(in, unit->ops), NULL, NULL);
+      }
+      clause_no = ops_get(in, unit->ops);
+      for(j=0; j<clause_no; j++)
+      {
+         clause = ClauseSetExtractFirst(cset);
+         if(!clause)
+         {
+            Error("%s: Clausification data does not match the image",
+                  OTHER_ERROR, unit->ops);
+         }
+         clause->ident = clause_count+ops_get(in, unit->ops);
+         op_no = ops_get(in, unit->ops);
+         ClausePushDerivation(clause, ops_get(in, unit->ops), form, NULL);
+         for(k=1; k<op_no; k++)
+         {
+            ClausePushDerivation(clause, ops_get(in, unit->ops), NULL, NULL);
+         }
+         ClauseSetInsert(clauseset, clause);
+      }
+      res += clause_no;
+   }
+   /* Clause identifiers continue as if the unit was clausified
+      here */
+   ClauseSetAllocCount(clause_count+unit->clause_allocs);
+   fclose(in);
+   ClauseSetFree(cset);
+   FormulaSetFree(fset);
+   PStackFree(csets);
+   PStackFree(fsets);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_sequential()
+//
+//   Clausify the formulas on forms from index start on into
+//   clauseset, collecting garbage as FormulaSetCNF2() does. Return
+//   the number of clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes formulas and
+//                   clauseset
+//
+/----------------------------------------------------------------------*/
+
+static long cnf_sequential(PStack_p forms, PStackPointer start,
+                           ClauseSet_p clauseset, TB_p terms,
+                           VarBank_p fresh_vars, GCAdmin_p gc,
+                           long miniscope_limit)
+{
+   WFormula_p    form;
+   PStackPointer i;
+   long          res = 0;
+   long          gc_threshold = TBNonVarTermNodes(terms)*TFORMULA_GC_LIMIT;
+
+   for(i=start; i<PStackGetSP(forms); i++)
+   {
+      form = PStackElementP(forms, i);
+      res += WFormulaCNF2(form, clauseset, terms, fresh_vars,
+                          miniscope_limit);
+      if(form->tformula &&
+         (TBNonVarTermNodes(terms)>gc_threshold))
+      {
+         GCCollect(gc);
+         gc_threshold = TBNonVarTermNodes(terms)*TFORMULA_GC_LIMIT;
+      }
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: copy_str_tree()
+//
+//   Return a copy of the keys of tree.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static StrTree_p copy_str_tree(StrTree_p tree)
+{
+   StrTree_p res = NULL, handle;
+   PStack_p  trav;
+   IntOrP    dummy = {0};
+
+   trav = StrTreeTraverseInit(tree);
+   while((handle = StrTreeTraverseNext(trav)))
+   {
+      StrTreeStore(&res, handle->key, dummy, dummy);
+   }
+   StrTreeTraverseExit(trav);
+
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: FormulaAndClauseSetParsePar()
+//
+//   Parse all statements from in, as FormulaAndClauseSetParse() (with
+//   no name selector), using up to workers worker processes, and
+//   check that the input is completely consumed. The result is the
+//   same as for sequential parsing: Units are merged in input order,
+//   so that symbols, formulas and clauses are created in the same
+//   order. Falls back to sequential parsing if the input is not a
+//   single memory-mapped TPTP file, uses typed formulas, or is too
+//   small. If a worker failed (e.g. because of a syntax error), the
+//   input from the start of its unit on is parsed sequentially.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes termbank and sets, creates
+//                   processes
+//
+/----------------------------------------------------------------------*/
+
+long FormulaAndClauseSetParsePar(Scanner_p in, FormulaSet_p fset,
+                                 ClauseSet_p wlset, TB_p terms,
+                                 StrTree_p *skip_includes,
+                                 int workers)
+{
+   Stream_p    stream = in->source;
+   PStack_p    starts;
+   ParseUnit_p units;
+   StrTree_p   known;
+   long        count, i, first_failed, unit_res, res = 0;
+   size_t      units_size;
+   bool        has_include = false;
+   VarMapCell  var_map;
+   ParseJobCell job = {in, terms, skip_includes, &var_map};
+
+   if(workers < 2 || ScannerGetFormat(in) == LOPFormat ||
+      stream->next || !stream->mapped)
+   {
+      res = FormulaAndClauseSetParse(in, fset, wlset, terms, NULL,
+                                     skip_includes);
+      CheckInpTok(in, NoToken);
+      return res;
+   }
+   starts = PStackAlloc();
+   if(find_statements(stream->buffer, stream->size, starts))
+   {
+      for(i=1; i<PStackGetSP(starts); i+=2)
+      {
+         has_include = has_include || PStackElementInt(starts, i);
+      }
+   }
+   else
+   {
+      PStackReset(starts);
+   }
+   units = MAP_FAILED;
+   units_size = (PStackGetSP(starts)/2+1)*sizeof(ParseUnitCell);
+   if(PStackGetSP(starts) >= 4 &&
+      (has_include || stream->size >= PARSE_PAR_MIN_SIZE))
+   {
+      units = mmap(NULL, units_size, PROT_READ|PROT_WRITE,
+                   MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+   }
+   if(units == MAP_FAILED)
+   {
+      PStackFree(starts);
+      res = FormulaAndClauseSetParse(in, fset, wlset, terms, NULL,
+                                     skip_includes);
+      CheckInpTok(in, NoToken);
+      return res;
+   }
+   count = build_units(starts, stream->size,
+                       MAX(stream->size/(4*workers), PARSE_PAR_MIN_CHUNK),
+                       units);
+   PStackFree(starts);
+   VERBOSE2(fprintf(stderr, "%s: Parsing %ld parts in parallel\n",
+                    ProgName, count););
+
+   known = copy_str_tree(*skip_includes);
+   var_map_init(&var_map, terms);
+   run_workers(units, count, workers, parse_unit_worker, &job);
+
+   for(i=0; i<count && units[i].ok; i++)
+   {
+      unit_res = merge_unit(&(units[i]), fset, wlset, terms,
+                            known, skip_includes, &var_map);
+      if(unit_res == -1)
+      {
+         ScannerSetRange(in, units[i].start, units[i].end);
+         unit_res = FormulaAndClauseSetParse(in, fset, wlset, terms, NULL,
+                                             skip_includes);
+         CheckInpTok(in, NoToken);
+      }
+      res += unit_res;
+   }
+   /* After the first failed worker (usually a syntax error), the rest
+      is parsed here, so that errors are reported as usual. Temporary
+      files are removed first, as errors terminate the process. */
+   first_failed = i;
+   remove_unit_files(units, count);
+   if(first_failed < count)
+   {
+      ScannerSetRange(in, units[first_failed].start, stream->size);
+      res += FormulaAndClauseSetParse(in, fset, wlset, terms, NULL,
+                                      skip_includes);
+      CheckInpTok(in, NoToken);
+   }
+   ScannerSetRange(in, stream->size, stream->size);
+   var_map_free(&var_map);
+   StrTreeFree(known);
+   munmap(units, units_size);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: FormulaSetCNF2Par()
+//
+//   Transform all formulae in set into CNF as FormulaSetCNF2(), with
+//   the clausification of the individual formulas (after the
+//   introduction of definitions) done by up to workers worker
+//   processes. The result is the same as for sequential
+//   clausification: Units of formulas are merged in input order,
+//   Skolem symbols and definition predicates introduced by the
+//   workers are renamed in the order in which they were created, and
+//   clauses get the identifiers they would have had. Only the
+//   variables of the final formulas may differ, so the caller should
+//   not use this if full derivations are printed. Falls back to
+//   sequential clausification for higher-order or small problems and
+//   when inferences are documented. Return number of clauses
+//   generated.
+//
+// Global Variables: OutputLevel, problemType
+//
+// Side Effects    : Plenty of memory stuff, creates processes
+//
+/----------------------------------------------------------------------*/
+
+long FormulaSetCNF2Par(FormulaSet_p set, FormulaSet_p archive,
+                       ClauseSet_p clauseset, TB_p terms,
+                       VarBank_p fresh_vars, GCAdmin_p gc,
+                       long miniscope_limit, int workers)
+{
+   WFormula_p    form, handle;
+   PStack_p      forms;
+   ParseUnit_p   units;
+   long          count, chunk, i, unit_res, res = 0;
+   long          old_nodes = TBNonVarTermNodes(terms);
+   size_t        units_size;
+   FunCode       fresh_from;
+   VarMapCell    var_map;
+   CNFJobCell    job = {NULL, terms, fresh_vars, miniscope_limit, &var_map};
+
+   if(workers < 2 || OutputLevel >= 2 || problemType == PROBLEM_HO ||
+      FormulaSetCardinality(set) < PARSE_PAR_MIN_FORMULAS)
+   {
+      return FormulaSetCNF2(set, archive, clauseset, terms, fresh_vars,
+                            gc, miniscope_limit);
+   }
+   TFormulaSetUnrollFOOL(set, archive, terms);
+   TFormulaSetIntroduceDefs(set, archive, terms);
+
+   /* The formulas are archived in the same order as by
+      FormulaSetCNF2() */
+   forms = PStackAlloc();
+   while(!FormulaSetEmpty(set))
+   {
+      handle = FormulaSetExtractFirst(set);
+      form = WFormulaFlatCopy(handle);
+      FormulaSetInsert(archive, handle);
+      WFormulaPushDerivation(form, DCFofQuote, handle, NULL);
+      FormulaSetInsert(archive, form);
+      PStackPushP(forms, form);
+   }
+
+   chunk = MAX(PStackGetSP(forms)/(4*workers), PARSE_PAR_MIN_CHUNK_FORMULAS);
+   count = (PStackGetSP(forms)+chunk-1)/chunk;
+   units_size = MAX(count,1)*sizeof(ParseUnitCell);
+   units = MAP_FAILED;
+   if(count >= 2)
+   {
+      units = mmap(NULL, units_size, PROT_READ|PROT_WRITE,
+                   MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+   }
+   if(units == MAP_FAILED)
+   {
+      res = cnf_sequential(forms, 0, clauseset, terms, fresh_vars, gc,
+                           miniscope_limit);
+   }
+   else
+   {
+      for(i=0; i<count; i++)
+      {
+         units[i].start = i*chunk;
+         units[i].end   = MIN((i+1)*chunk, PStackGetSP(forms));
+      }
+      init_units(units, count);
+      VERBOSE2(fprintf(stderr, "%s: Clausifying %ld parts in parallel\n",
+                       ProgName, count););
+
+      job.forms  = forms;
+      fresh_from = terms->sig->f_count;
+      var_map_init(&var_map, terms);
+      run_workers(units, count, workers, cnf_unit_worker, &job);
+
+      for(i=0; i<count && units[i].ok; i++)
+      {
+         unit_res = merge_cnf_unit(&(units[i]), forms, clauseset, terms,
+                                   fresh_from, &var_map);
+         if(unit_res == -1)
+         {
+            break;
+         }
+         copy_log(units[i].log);
+         res += unit_res;
+      }
+      /* Formulas of failed workers (and all following) are clausified
+         here */
+      if(i < count)
+      {
+         res += cnf_sequential(forms, units[i].start, clauseset, terms,
+                               fresh_vars, gc, miniscope_limit);
+      }
+      remove_unit_files(units, count);
+      munmap(units, units_size);
+      var_map_free(&var_map);
+   }
+   PStackFree(forms);
+
+   if(TBNonVarTermNodes(terms)!=old_nodes)
+   {
+      GCCollect(gc);
+   }
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
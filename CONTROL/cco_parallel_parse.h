@@ -0,0 +1,77 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_parallel_parse.h
+
+Author: agent (agent@local)
+
+Contents
+
+  Parsing of large (untyped) TPTP input files and clausification of
+  formula sets in forked worker processes. The input is split at
+  statement boundaries into chunks and include directives, the
+  formulas into ranges, each of which is processed by its own worker
+  and handed back to the parent as an axiom image.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sat Oct 17 2026
+    New
+<2> Sat Oct 17 2026
+    Raise PARSE_PAR_MIN_SIZE
+<3> Sat Oct 17 2026
+    FormulaSetCNF2Par(), lower PARSE_PAR_MIN_SIZE again
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCO_PARALLEL_PARSE
+
+#define CCO_PARALLEL_PARSE
+
+#include <cio_tempfile.h>
+#include <cco_spec_image.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Files without include directives are only split if they are at
+   least PARSE_PAR_MIN_SIZE bytes long, into chunks of at least
+   PARSE_PAR_MIN_CHUNK bytes. Formula sets are only clausified in
+   parallel if they have at least PARSE_PAR_MIN_FORMULAS formulas,
+   split into ranges of at least PARSE_PAR_MIN_CHUNK_FORMULAS. Below
+   these sizes, starting the workers and loading their images costs
+   more than the work done by them. */
+
+#define PARSE_PAR_MIN_SIZE           (1024*1024)
+#define PARSE_PAR_MIN_CHUNK          (64*1024)
+#define PARSE_PAR_MIN_FORMULAS       256
+#define PARSE_PAR_MIN_CHUNK_FORMULAS 64
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+extern int ParseWorkers;
+
+long FormulaAndClauseSetParsePar(Scanner_p in, FormulaSet_p fset,
+                                 ClauseSet_p wlset, TB_p terms,
+                                 StrTree_p *skip_includes,
+                                 int workers);
+long FormulaSetCNF2Par(FormulaSet_p set, FormulaSet_p archive,
+                       ClauseSet_p clauseset, TB_p terms,
+                       VarBank_p fresh_vars, GCAdmin_p gc,
+                       long miniscope_limit, int workers);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -18,26 +18,1133 @@ Changes
 
 <1> Mon Jun  8 18:26:14 MET DST 1998
     New
+<2> Fri Oct 16 2026
+    Optional parallel generation of paramodulants in forked workers.
+<3> Sat Oct 17 2026
+    Workers persist across given clauses and mirror the indices.
 
 -----------------------------------------------------------------------*/
 
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
 #include "cco_paramodulation.h"
 
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+int ParamodWorkers = 1;
+
+/* Partitioning of the work for ComputeAllParamodulantsIndexedPar():
+   The overlap candidates (unifiable subterm trees found in the
+   indices) are numbered in the order in which the sequential code
+   visits them. This order only depends on the indexed terms, not on
+   their addresses, so it is the same in all workers. Partition
+   pm_part_no of pm_part_count handles the candidates whose number is
+   congruent to pm_part_no. If pm_part_log is set, all generated
+   clauses are logged there (as PMChild_p). */
+
+static int      pm_part_count = 1;
+static int      pm_part_no    = 0;
+static long     pm_unit_count = 0;
+static PStack_p pm_part_log   = NULL;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Growable byte buffer for messages between prover and workers */
+
+typedef struct pmbuffercell
+{
+   char   *data;
+   size_t size;
+   size_t len;
+   size_t pos; /* Read position */
+}PMBufferCell, *PMBuffer_p;
+
+/* A clause generated by a worker. Within a candidate, the clauses are
+   returned ordered by partner clause and positions, which (unlike the
+   order of generation) does not depend on term addresses. */
+
+typedef struct pm_child_cell
+{
+   long           unit;
+   long           partner;     /* Ident of the indexed parent */
+   CompactPos     partner_pos;
+   CompactPos     given_pos;
+   long           seq;         /* Order of generation, for ties */
+   Clause_p       clause;
+   InfType        inf;
+   DerivationCode dc;
+   Clause_p       parent1;
+   Clause_p       parent2;
+}PMChildCell, *PMChild_p;
+
+#define PMChildCellAlloc()    (PMChildCell*)SizeMalloc(sizeof(PMChildCell))
+#define PMChildCellFree(junk) SizeFree(junk, sizeof(PMChildCell))
+
+/* A worker process as seen by the prover */
+
+typedef struct pm_worker_cell
+{
+   pid_t        pid;
+   int          fd;    /* Socket to the worker */
+   PMBufferCell reply; /* Reply to the current request */
+}PMWorkerCell;
+
+/* Messages in both directions start with a command character and the
+   size of the payload. */
+
+#define PM_CMD_INSERT   'I' /* Clause inserted into the indices */
+#define PM_CMD_DELETE   'D' /* Clause deleted from the indices */
+#define PM_CMD_GENERATE 'G' /* Compute paramodulants */
+#define PM_CMD_RESULT   'R' /* Reply to PM_CMD_GENERATE */
+
+#define PM_HEADER_SIZE  (sizeof(char)+sizeof(size_t))
+
+/* The running workers, the indices they mirror, the signature size
+   they know about, and the buffer for requests to them. */
+
+static PMWorkerCell    pm_workers[PM_MAX_WORKERS];
+static int             pm_worker_count   = 0;
+static bool            pm_workers_failed = false;
+static GlobalIndices_p pm_worker_indices = NULL;
+static FunCode         pm_worker_f_count = 0;
+static PMBufferCell    pm_request        = {NULL, 0, 0, 0};
+
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_unit_is_mine()
+//
+//   Count one overlap candidate and return true if it belongs to the
+//   current partition.
+//
+// Global Variables: pm_part_count, pm_part_no, pm_unit_count
+//
+// Side Effects    : Increases pm_unit_count
+//
+/----------------------------------------------------------------------*/
+
+static inline bool pm_unit_is_mine(void)
+{
+   return (pm_unit_count++ % pm_part_count) == pm_part_no;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_log_child()
+//
+//   If requested, log a newly generated clause together with the
+//   number of the candidate that produced it, the partner clause and
+//   positions of the inference, and the information needed to
+//   document it.
+//
+// Global Variables: pm_part_log, pm_unit_count
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void pm_log_child(Clause_p clause, InfType inf, DerivationCode dc,
+                         Clause_p parent1, Clause_p parent2,
+                         Clause_p partner, CompactPos partner_pos,
+                         CompactPos given_pos)
+{
+   PMChild_p child;
+
+   if(pm_part_log)
+   {
+      child = PMChildCellAlloc();
+      child->unit        = pm_unit_count-1;
+      child->partner     = partner->ident;
+      child->partner_pos = partner_pos;
+      child->given_pos   = given_pos;
+      child->seq         = PStackGetSP(pm_part_log);
+      child->clause      = clause;
+      child->inf         = inf;
+      child->dc          = dc;
+      child->parent1     = parent1;
+      child->parent2     = parent2;
+      PStackPushP(pm_part_log, child);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_child_cmp()
+//
+//   Compare two logged clauses (as PStack elements) by candidate,
+//   partner clause, positions, and order of generation.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int pm_child_cmp(const void* c1, const void* c2)
+{
+   const PMChildCell *child1 = ((const IntOrP*)c1)->p_val;
+   const PMChildCell *child2 = ((const IntOrP*)c2)->p_val;
+   int res;
+
+   res = CMP(child1->unit, child2->unit);
+   if(!res)
+   {
+      res = CMP(child1->partner, child2->partner);
+   }
+   if(!res)
+   {
+      res = CMP(child1->partner_pos, child2->partner_pos);
+   }
+   if(!res)
+   {
+      res = CMP(child1->given_pos, child2->given_pos);
+   }
+   if(!res)
+   {
+      res = CMP(child1->seq, child2->seq);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_buffer_put()
+//
+//   Append size bytes from data to buffer.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void pm_buffer_put(PMBuffer_p buffer, void* data, size_t size)
+{
+   if(buffer->len+size > buffer->size)
+   {
+      while(buffer->len+size > buffer->size)
+      {
+         buffer->size = buffer->size? 2*buffer->size : 4096;
+      }
+      buffer->data = SecureRealloc(buffer->data, buffer->size);
+   }
+   memcpy(buffer->data+buffer->len, data, size);
+   buffer->len += size;
+}
+
+#define PMBufferPut(buffer, val) pm_buffer_put((buffer), &(val), sizeof(val))
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_buffer_get()
+//
+//   Read size bytes from the buffer into data.
+//
+// Global Variables: -
+//
+// Side Effects    : Moves read position
+//
+/----------------------------------------------------------------------*/
+
+static void pm_buffer_get(PMBuffer_p buffer, void* data, size_t size)
+{
+   assert(buffer->pos+size <= buffer->len);
+   memcpy(data, buffer->data+buffer->pos, size);
+   buffer->pos += size;
+}
+
+#define PMBufferGet(buffer, val) pm_buffer_get((buffer), &(val), sizeof(val))
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_message_begin()
+//
+//   Reset buffer and start a message with the given command. The
+//   size is filled in by pm_message_end().
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void pm_message_begin(PMBuffer_p buffer, char cmd)
+{
+   size_t size = 0;
+
+   buffer->len = 0;
+   buffer->pos = 0;
+   PMBufferPut(buffer, cmd);
+   PMBufferPut(buffer, size);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_message_end()
+//
+//   Fill in the size of the message in buffer.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void pm_message_end(PMBuffer_p buffer)
+{
+   size_t size = buffer->len-PM_HEADER_SIZE;
+
+   memcpy(buffer->data+sizeof(char), &size, sizeof(size));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_buffer_put_term()
+//
+//   Serialize a term (in preorder). Only the properties that
+//   TBInsert() would keep are transferred.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void pm_buffer_put_term(PMBuffer_p buffer, Term_p term)
+{
+   TermProperties props = TermCellGiveProps(term, TPPredPos);
+   int i;
+
+   PMBufferPut(buffer, term->f_code);
+   PMBufferPut(buffer, term->arity);
+   PMBufferPut(buffer, term->type);
+   PMBufferPut(buffer, props);
+   for(i=0; i<term->arity; i++)
+   {
+      pm_buffer_put_term(buffer, term->args[i]);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_buffer_get_term()
+//
+//   Read a term written by pm_buffer_put_term() and insert it into
+//   bank. The buffer is trusted (messages are only accepted when
+//   complete).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes bank
+//
+/----------------------------------------------------------------------*/
+
+static Term_p pm_buffer_get_term(PMBuffer_p buffer, TB_p bank)
+{
+   FunCode        f_code;
+   int            arity, i;
+   Type_p         type;
+   TermProperties props;
+   Term_p         t;
+
+   PMBufferGet(buffer, f_code);
+   PMBufferGet(buffer, arity);
+   PMBufferGet(buffer, type);
+   PMBufferGet(buffer, props);
+
+   if(f_code < 0)
+   {
+      t = VarBankVarAssertAlloc(bank->vars, f_code, type);
+      TermSetBank(t, bank);
+   }
+   else
+   {
+      t = TermTopAlloc(f_code, arity);
+      t->type       = type;
+      t->properties = props;
+      for(i=0; i<arity; i++)
+      {
+         t->args[i] = pm_buffer_get_term(buffer, bank);
+      }
+      t = TBTermTopInsert(bank, t);
+   }
+   return t;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_buffer_put_clause()
+//
+//   Serialize the literals of a clause and the properties relevant
+//   for generating inferences with it.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void pm_buffer_put_clause(PMBuffer_p buffer, Clause_p clause)
+{
+   int   lit_no = ClauseLiteralNumber(clause);
+   Eqn_p lit;
+
+   PMBufferPut(buffer, clause->properties);
+   PMBufferPut(buffer, clause->proof_size);
+   PMBufferPut(buffer, clause->proof_depth);
+   PMBufferPut(buffer, lit_no);
+   for(lit=clause->literals; lit; lit=lit->next)
+   {
+      PMBufferPut(buffer, lit->properties);
+      pm_buffer_put_term(buffer, lit->lterm);
+      pm_buffer_put_term(buffer, lit->rterm);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_buffer_get_clause()
+//
+//   Rebuild a clause written by pm_buffer_put_clause() in bank and
+//   return it.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes bank, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static Clause_p pm_buffer_get_clause(PMBuffer_p buffer, TB_p bank)
+{
+   long              proof_size, proof_depth;
+   Clause_p          clause;
+   int               lit_no, i;
+   FormulaProperties props;
+   EqnProperties     lit_props;
+   Eqn_p             list = NULL, *tail = &list;
+   Term_p            lterm, rterm;
+
+   PMBufferGet(buffer, props);
+   PMBufferGet(buffer, proof_size);
+   PMBufferGet(buffer, proof_depth);
+   PMBufferGet(buffer, lit_no);
+   for(i=0; i<lit_no; i++)
+   {
+      PMBufferGet(buffer, lit_props);
+      lterm = pm_buffer_get_term(buffer, bank);
+      rterm = pm_buffer_get_term(buffer, bank);
+      *tail = EqnAlloc(lterm, rterm, bank, false);
+      (*tail)->properties = lit_props;
+      tail = &((*tail)->next);
+   }
+   clause = ClauseAlloc(list);
+   clause->properties  = props;
+   clause->proof_size  = proof_size;
+   clause->proof_depth = proof_depth;
+
+   return clause;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_worker_orig()
+//
+//   Return the clause of the prover that corresponds to clause in a
+//   worker. Clauses from before the fork are the same in both, the
+//   others are found in origs.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static Clause_p pm_worker_orig(NumTree_p *origs, Clause_p clause)
+{
+   NumTree_p cell = NumTreeFind(origs, (long)clause);
+
+   return cell? cell->val1.p_val : clause;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_buffer_put_log()
+//
+//   Serialize all clauses logged in log (sorted with pm_child_cmp()),
+//   terminated by a record with candidate number -1. Parents are
+//   translated to the prover's clauses with origs. Frees the log
+//   entries.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void pm_buffer_put_log(PMBuffer_p buffer, PStack_p log,
+                              NumTree_p *origs)
+{
+   PStackPointer i;
+   PMChild_p     child;
+   Clause_p      parent1, parent2;
+   long          unit;
+
+   PStackSort(log, pm_child_cmp);
+   for(i=0; i<PStackGetSP(log); i++)
+   {
+      child   = PStackElementP(log, i);
+      parent1 = pm_worker_orig(origs, child->parent1);
+      parent2 = pm_worker_orig(origs, child->parent2);
+
+      PMBufferPut(buffer, child->unit);
+      PMBufferPut(buffer, child->inf);
+      PMBufferPut(buffer, child->dc);
+      PMBufferPut(buffer, parent1);
+      PMBufferPut(buffer, parent2);
+      pm_buffer_put_clause(buffer, child->clause);
+      PMChildCellFree(child);
+   }
+   PStackReset(log);
+   unit = -1;
+   PMBufferPut(buffer, unit);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_buffer_get_child()
+//
+//   Rebuild the next clause of a worker reply in bank, insert it into
+//   store and document it. Return the clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes bank and store, output
+//
+/----------------------------------------------------------------------*/
+
+static Clause_p pm_buffer_get_child(PMBuffer_p buffer, TB_p bank,
+                                    ClauseSet_p store)
+{
+   long           unit;
+   Clause_p       clause, parent1, parent2;
+   InfType        inf;
+   DerivationCode dc;
+
+   PMBufferGet(buffer, unit);
+   PMBufferGet(buffer, inf);
+   PMBufferGet(buffer, dc);
+   PMBufferGet(buffer, parent1);
+   PMBufferGet(buffer, parent2);
+   clause = pm_buffer_get_clause(buffer, bank);
+
+   ClauseSetInsert(store, clause);
+   DocClauseCreationDefault(clause, inf, parent1, parent2);
+   ClausePushDerivation(clause, dc, parent1, parent2);
+
+   return clause;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_buffer_peek_unit()
+//
+//   Return the candidate number of the next record in the buffer
+//   (-1 at the end).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long pm_buffer_peek_unit(PMBuffer_p buffer)
+{
+   long unit;
+
+   memcpy(&unit, buffer->data+buffer->pos, sizeof(unit));
+   return unit;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_send_all()
+//
+//   Send the message in buffer to fd. Return false on error. Does
+//   not raise SIGPIPE if the other side is gone (where supported).
+//
+// Global Variables: -
+//
+// Side Effects    : IO
+//
+/----------------------------------------------------------------------*/
+
+static bool pm_send_all(int fd, PMBuffer_p buffer)
+{
+   size_t  done = 0;
+   ssize_t res;
+
+   while(done < buffer->len)
+   {
+      res = send(fd, buffer->data+done, buffer->len-done, MSG_NOSIGNAL);
+      if(res == -1)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         return false;
+      }
+      done += res;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_read_exact()
+//
+//   Read exactly size bytes from fd into data. Return false on error
+//   or end of file.
+//
+// Global Variables: -
+//
+// Side Effects    : IO
+//
+/----------------------------------------------------------------------*/
+
+static bool pm_read_exact(int fd, char* data, size_t size)
+{
+   ssize_t res;
+
+   while(size)
+   {
+      res = read(fd, data, size);
+      if(res == -1 && errno == EINTR)
+      {
+         continue;
+      }
+      if(res <= 0)
+      {
+         return false;
+      }
+      data += res;
+      size -= res;
+   }
+   return true;
+}
 
 
-/*---------------------------------------------------------------------*/
-/*                        Global Variables                             */
-/*---------------------------------------------------------------------*/
+/*-----------------------------------------------------------------------
+//
+// Function: pm_recv()
+//
+//   Read the next message from fd into buffer (with the read position
+//   at the start of the payload) and return its command in *cmd.
+//   Return false on error or end of file.
+//
+// Global Variables: -
+//
+// Side Effects    : IO, memory operations
+//
+/----------------------------------------------------------------------*/
 
+static bool pm_recv(int fd, PMBuffer_p buffer, char* cmd)
+{
+   size_t size;
 
-/*---------------------------------------------------------------------*/
-/*                      Forward Declarations                           */
-/*---------------------------------------------------------------------*/
+   buffer->len = 0;
+   buffer->pos = 0;
+   if(!pm_read_exact(fd, cmd, sizeof(char)) ||
+      !pm_read_exact(fd, (char*)&size, sizeof(size)))
+   {
+      return false;
+   }
+   if(size > buffer->size)
+   {
+      buffer->size = size;
+      buffer->data = SecureRealloc(buffer->data, buffer->size);
+   }
+   buffer->len = size;
+   return pm_read_exact(fd, buffer->data, size);
+}
 
 
-/*---------------------------------------------------------------------*/
-/*                         Internal Functions                          */
-/*---------------------------------------------------------------------*/
+/*-----------------------------------------------------------------------
+//
+// Function: pm_reply_complete()
+//
+//   Return true if buffer contains a complete message.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool pm_reply_complete(PMBuffer_p buffer)
+{
+   size_t size;
+
+   if(buffer->len < PM_HEADER_SIZE)
+   {
+      return false;
+   }
+   memcpy(&size, buffer->data+sizeof(char), sizeof(size));
+   return buffer->len >= PM_HEADER_SIZE+size;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_read_replies()
+//
+//   Read one reply from each worker into its reply buffer, with the
+//   read position at the start of the payload. Return false on error
+//   or if a worker is gone.
+//
+// Global Variables: pm_workers, pm_worker_count
+//
+// Side Effects    : IO, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool pm_read_replies(void)
+{
+   struct pollfd pfds[PM_MAX_WORKERS];
+   char    chunk[4096];
+   int     open = pm_worker_count, i;
+   ssize_t res;
+
+   for(i=0; i<pm_worker_count; i++)
+   {
+      pm_workers[i].reply.len = 0;
+      pm_workers[i].reply.pos = 0;
+      pfds[i].fd     = pm_workers[i].fd;
+      pfds[i].events = POLLIN;
+   }
+   while(open)
+   {
+      if(poll(pfds, pm_worker_count, -1) == -1)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         return false;
+      }
+      for(i=0; i<pm_worker_count; i++)
+      {
+         if(pfds[i].fd == -1 || !pfds[i].revents)
+         {
+            continue;
+         }
+         res = read(pfds[i].fd, chunk, sizeof(chunk));
+         if(res > 0)
+         {
+            pm_buffer_put(&(pm_workers[i].reply), chunk, res);
+            if(pm_reply_complete(&(pm_workers[i].reply)))
+            {
+               pfds[i].fd = -1;
+               open--;
+            }
+         }
+         else if(res == 0 || errno != EINTR)
+         {
+            return false;
+         }
+      }
+   }
+   for(i=0; i<pm_worker_count; i++)
+   {
+      if(pm_workers[i].reply.data[0] != PM_CMD_RESULT)
+      {
+         return false;
+      }
+      pm_workers[i].reply.pos = PM_HEADER_SIZE;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_workers_send()
+//
+//   Send the message in buffer to all workers. Return false on
+//   error.
+//
+// Global Variables: pm_workers, pm_worker_count
+//
+// Side Effects    : IO
+//
+/----------------------------------------------------------------------*/
+
+static bool pm_workers_send(PMBuffer_p buffer)
+{
+   int i;
+
+   for(i=0; i<pm_worker_count; i++)
+   {
+      if(!pm_send_all(pm_workers[i].fd, buffer))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_workers_stop()
+//
+//   Terminate all workers (by closing their sockets) and wait for
+//   them. They will be restarted on demand.
+//
+// Global Variables: pm_workers, pm_worker_count, pm_worker_indices
+//
+// Side Effects    : IO, processes
+//
+/----------------------------------------------------------------------*/
+
+static void pm_workers_stop(void)
+{
+   int   i, status;
+   pid_t res;
+
+   for(i=0; i<pm_worker_count; i++)
+   {
+      close(pm_workers[i].fd);
+   }
+   for(i=0; i<pm_worker_count; i++)
+   {
+      do
+      {
+         res = waitpid(pm_workers[i].pid, &status, 0);
+      }while((res == -1) && (errno == EINTR));
+      if(pm_workers[i].reply.data)
+      {
+         FREE(pm_workers[i].reply.data);
+      }
+   }
+   pm_worker_count = 0;
+   if(pm_worker_indices)
+   {
+      pm_worker_indices->change_hook = NULL;
+      pm_worker_indices = NULL;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_workers_fail()
+//
+//   Stop the workers for good after an error.
+//
+// Global Variables: pm_workers_failed
+//
+// Side Effects    : IO, processes
+//
+/----------------------------------------------------------------------*/
+
+static void pm_workers_fail(void)
+{
+   pm_workers_stop();
+   if(!pm_workers_failed)
+   {
+      Warning("Paramodulation workers failed, continuing without them");
+      pm_workers_failed = true;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_index_changed()
+//
+//   Change hook for the indices mirrored by the workers: Send inserted
+//   and deleted clauses to the workers, stop them if the indices are
+//   freed.
+//
+// Global Variables: pm_request
+//
+// Side Effects    : IO
+//
+/----------------------------------------------------------------------*/
+
+static void pm_index_changed(Clause_p clause, bool insert)
+{
+   if(!clause)
+   {
+      pm_workers_stop();
+      return;
+   }
+   pm_message_begin(&pm_request, insert?PM_CMD_INSERT:PM_CMD_DELETE);
+   PMBufferPut(&pm_request, clause);
+   if(insert)
+   {
+      PMBufferPut(&pm_request, clause->ident);
+      pm_buffer_put_clause(&pm_request, clause);
+   }
+   pm_message_end(&pm_request);
+   if(!pm_workers_send(&pm_request))
+   {
+      pm_workers_fail();
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_worker_index()
+//
+//   Insert clause into or delete it from the paramodulation indices
+//   in indices.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes indices
+//
+/----------------------------------------------------------------------*/
+
+static void pm_worker_index(GlobalIndices_p indices, Clause_p clause,
+                            bool insert)
+{
+   if(insert)
+   {
+      OverlapIndexInsertIntoClause2(indices->pm_into_index,
+                                    indices->pm_negp_index,
+                                    clause);
+      if(indices->pm_from_index)
+      {
+         OverlapIndexInsertFromClause(indices->pm_from_index, clause);
+      }
+   }
+   else
+   {
+      OverlapIndexDeleteIntoClause2(indices->pm_into_index,
+                                    indices->pm_negp_index,
+                                    clause);
+      if(indices->pm_from_index)
+      {
+         OverlapIndexDeleteFromClause(indices->pm_from_index, clause);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_worker_loop()
+//
+//   Main loop of a worker: Keep the (copy-on-write) copy of the
+//   indices up to date with the changes sent by the prover, and answer
+//   requests to compute paramodulants for the own partition. Clauses
+//   inserted after the fork are rebuilt in bank, copies maps the
+//   prover's clauses to them, origs the other way round. Returns when
+//   the prover closes the socket.
+//
+// Global Variables: pm_part_log
+//
+// Side Effects    : IO, memory operations, changes indices
+//
+/----------------------------------------------------------------------*/
+
+static void pm_worker_loop(int fd, TB_p bank, OCB_p ocb,
+                           VarBank_p freshvars, GlobalIndices_p indices)
+{
+   PMBufferCell       request = {NULL, 0, 0, 0}, reply = {NULL, 0, 0, 0};
+   NumTree_p          copies = NULL, origs = NULL, cell;
+   IntOrP             val1, val2;
+   Clause_p           orig, copy, clause, given;
+   ClauseSet_p        store;
+   ParamodulationType pm_type;
+   long               ident, nodes;
+   char               cmd;
+
+   val2.p_val  = NULL;
+   pm_part_log = PStackAlloc();
+   while(pm_recv(fd, &request, &cmd))
+   {
+      PMBufferGet(&request, orig);
+      switch(cmd)
+      {
+      case PM_CMD_INSERT:
+            PMBufferGet(&request, ident);
+            copy = pm_buffer_get_clause(&request, bank);
+            copy->ident = ident;
+            pm_worker_index(indices, copy, true);
+            val1.p_val = copy;
+            NumTreeStore(&copies, (long)orig, val1, val2);
+            val1.p_val = orig;
+            NumTreeStore(&origs, (long)copy, val1, val2);
+            break;
+      case PM_CMD_DELETE:
+            cell = NumTreeExtractEntry(&copies, (long)orig);
+            if(cell)
+            {
+               copy = cell->val1.p_val;
+               NumTreeCellFree(cell);
+               NumTreeDeleteEntry(&origs, (long)copy);
+               pm_worker_index(indices, copy, false);
+               ClauseFree(copy);
+            }
+            else
+            {
+               pm_worker_index(indices, orig, false);
+            }
+            break;
+      case PM_CMD_GENERATE:
+            PMBufferGet(&request, pm_type);
+            PMBufferGet(&request, ident);
+            clause = pm_buffer_get_clause(&request, bank);
+            clause->ident = ident;
+            cell  = NumTreeFind(&copies, (long)orig);
+            given = cell? cell->val1.p_val : orig;
+            store = ClauseSetAlloc();
+            ComputeAllParamodulantsIndexed(bank, ocb, freshvars,
+                                           clause, given,
+                                           indices->pm_into_index,
+                                           indices->pm_negp_index,
+                                           indices->pm_from_index,
+                                           store, pm_type);
+            pm_message_begin(&reply, PM_CMD_RESULT);
+            pm_buffer_put_log(&reply, pm_part_log, &origs);
+            nodes = TBNonVarTermNodes(bank);
+            PMBufferPut(&reply, nodes);
+            pm_message_end(&reply);
+            ClauseSetFree(store);
+            ClauseFree(clause);
+            if(!pm_send_all(fd, &reply))
+            {
+               return;
+            }
+            break;
+      default:
+            return;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pm_workers_start()
+//
+//   Fork workers processes, each with a copy of the current proof
+//   state, and install the change hook that keeps their indices up to
+//   date. Each worker may use the CPU time the prover has left at this
+//   point. Return true on success.
+//
+// Global Variables: pm_workers, pm_worker_count, pm_worker_indices,
+//                   pm_worker_f_count, pm_part_count, pm_part_no,
+//                   OutputLevel
+//
+// Side Effects    : Creates processes
+//
+/----------------------------------------------------------------------*/
+
+static bool pm_workers_start(TB_p bank, OCB_p ocb, VarBank_p freshvars,
+                             GlobalIndices_p indices, int workers)
+{
+   rlim_t        used = (rlim_t)GetTotalCPUTime();
+   struct rlimit rlim;
+   int           sv[2], i, j;
+   pid_t         pid;
+#ifdef SO_NOSIGPIPE
+   int           one = 1;
+#endif
+
+   fflush(GlobalOut);
+   fflush(stdout);
+   fflush(stderr);
+   for(i=0; i<workers; i++)
+   {
+      if(socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == -1)
+      {
+         pm_workers_fail();
+         return false;
+      }
+      pid = fork();
+      if(pid == -1)
+      {
+         close(sv[0]);
+         close(sv[1]);
+         pm_workers_fail();
+         return false;
+      }
+      if(pid == 0)
+      {
+         /* Worker */
+         for(j=0; j<pm_worker_count; j++)
+         {
+            close(pm_workers[j].fd);
+         }
+         close(sv[0]);
+         pm_worker_count      = 0;
+         indices->change_hook = NULL;
+         OutputLevel          = 0;
+         pm_part_count        = workers;
+         pm_part_no           = i;
+         signal(SIGXCPU, SIG_DFL);
+         if((getrlimit(RLIMIT_CPU, &rlim) == 0) &&
+            (rlim.rlim_cur != RLIM_INFINITY))
+         {
+            SetSoftRlimit(RLIMIT_CPU,
+                          (rlim.rlim_cur > used)? rlim.rlim_cur-used : 1);
+         }
+         pm_worker_loop(sv[1], bank, ocb, freshvars, indices);
+         _exit(0);
+      }
+      close(sv[1]);
+#ifdef SO_NOSIGPIPE
+      setsockopt(sv[0], SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+      pm_workers[i].pid = pid;
+      pm_workers[i].fd  = sv[0];
+      memset(&(pm_workers[i].reply), 0, sizeof(PMBufferCell));
+      pm_worker_count++;
+   }
+   pm_worker_indices    = indices;
+   pm_worker_f_count    = bank->sig->f_count;
+   indices->change_hook = pm_index_changed;
+
+   return true;
+}
 
 
 /*-----------------------------------------------------------------------
@@ -254,6 +1361,12 @@ static long compute_into_pm_pos_clause(ParamodInfo_p pminfo,
                                      pminfo->new_orig);
             ClausePushDerivation(clause,  pm_type==ParamodPlain?DCParamod:DCSimParamod,
                                  pminfo->into, pminfo->new_orig);
+            pm_log_child(clause,
+                         pm_type==ParamodPlain?inf_paramod:inf_sim_paramod,
+                         pm_type==ParamodPlain?DCParamod:DCSimParamod,
+                         pminfo->into, pminfo->new_orig,
+                         pminfo->into, pminfo->into_cpos,
+                         pminfo->from_cpos);
          }
       }
       ClausePosFree(pminfo->into_pos);
@@ -392,8 +1505,11 @@ static long compute_pos_into_pm(ParamodInfo_p pminfo,
    while(!PStackEmpty(candidates))
    {
       termtree = PStackPopP(candidates);
-      res += compute_pos_into_pm_termtree(pminfo, type,
-                                          olterm, termtree, store);
+      if(pm_unit_is_mine())
+      {
+         res += compute_pos_into_pm_termtree(pminfo, type,
+                                             olterm, termtree, store);
+      }
    }
 
    PStackFree(candidates);
@@ -471,6 +1587,12 @@ static long compute_from_pm_pos_clause(ParamodInfo_p pminfo,
                                      pminfo->from);
             ClausePushDerivation(clause,  pm_type?DCSimParamod:DCParamod,
                                     pminfo->new_orig, pminfo->from);
+            pm_log_child(clause,
+                         pm_type?inf_sim_paramod:inf_paramod,
+                         pm_type?DCSimParamod:DCParamod,
+                         pminfo->new_orig, pminfo->from,
+                         pminfo->from, pminfo->from_cpos,
+                         pminfo->into_cpos);
          }
       }
       ClausePosFree(pminfo->from_pos);
@@ -618,8 +1740,11 @@ static long compute_pos_from_pm(ParamodInfo_p pminfo,
    while(!PStackEmpty(candidates))
    {
       termtree = PStackPopP(candidates);
-      res += compute_pos_from_pm_termtree(pminfo, type,
-                                           olterm, termtree, store);
+      if(pm_unit_is_mine())
+      {
+         res += compute_pos_from_pm_termtree(pminfo, type,
+                                             olterm, termtree, store);
+      }
    }
 
    PStackFree(candidates);
@@ -983,6 +2108,7 @@ long ComputeAllParamodulantsIndexed(TB_p bank, OCB_p ocb,
    pminfo.freshvars = freshvars;
    pminfo.ocb       = ocb;
    pminfo.new_orig  = parent_alias;
+   pm_unit_count    = 0;
 
    res += ComputeIntoParamodulants(&pminfo,
                                    pm_type,
@@ -1001,6 +2127,121 @@ long ComputeAllParamodulantsIndexed(TB_p bank, OCB_p ocb,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ComputeAllParamodulantsIndexedPar()
+//
+//   As ComputeAllParamodulantsIndexed(), but distribute the overlap
+//   candidates over workers forked processes. The workers are started
+//   on first use and persist across given clauses: The change hook of
+//   indices sends them every clause inserted into or deleted from the
+//   indices, so that their copies of the paramodulation indices stay
+//   the same as the prover's. Each worker generates the paramodulants
+//   for its share of the candidates and sends them back. The prover
+//   rebuilds them in bank and inserts them into store ordered by
+//   candidate, and within a candidate by partner clause and
+//   positions.
+//
+//   The set of generated clauses is the same as for the sequential
+//   version, and so is their order for any number of workers, but it
+//   may differ from the order of the sequential version, which
+//   depends on term addresses. Workers are restarted when the
+//   signature grows, and when their term banks (which are never
+//   garbage collected) have grown too large. Falls back to the
+//   sequential version for non-first-order problems, if there are fewer
+//   than PM_PAR_MIN_CLAUSES clauses in the indices, and (for the rest
+//   of the run) if anything goes wrong with the workers.
+//
+// Global Variables: pm_workers, pm_worker_count, pm_workers_failed,
+//                   pm_worker_f_count, pm_request
+//
+// Side Effects    : Memory operations, creates processes, IO
+//
+/----------------------------------------------------------------------*/
+
+long ComputeAllParamodulantsIndexedPar(TB_p bank, OCB_p ocb,
+                                       VarBank_p freshvars,
+                                       Clause_p clause,
+                                       Clause_p parent_alias,
+                                       GlobalIndices_p indices,
+                                       ClauseSet_p store,
+                                       ParamodulationType pm_type,
+                                       int workers)
+{
+   long res = 0, unit, best, nodes, max_nodes;
+   int  i, j;
+
+   if(pm_worker_count && (bank->sig->f_count != pm_worker_f_count))
+   {
+      pm_workers_stop();
+   }
+   if((workers < 2) || pm_workers_failed ||
+      (problemType != PROBLEM_FO) ||
+      (indices->clause_count < PM_PAR_MIN_CLAUSES) ||
+      (!pm_worker_count &&
+       !pm_workers_start(bank, ocb, freshvars, indices, workers)))
+   {
+      return ComputeAllParamodulantsIndexed(bank, ocb, freshvars,
+                                            clause, parent_alias,
+                                            indices->pm_into_index,
+                                            indices->pm_negp_index,
+                                            indices->pm_from_index,
+                                            store, pm_type);
+   }
+   pm_message_begin(&pm_request, PM_CMD_GENERATE);
+   PMBufferPut(&pm_request, parent_alias);
+   PMBufferPut(&pm_request, pm_type);
+   PMBufferPut(&pm_request, clause->ident);
+   pm_buffer_put_clause(&pm_request, clause);
+   pm_message_end(&pm_request);
+
+   if(!pm_workers_send(&pm_request) || !pm_read_replies())
+   {
+      pm_workers_fail();
+      return ComputeAllParamodulantsIndexed(bank, ocb, freshvars,
+                                            clause, parent_alias,
+                                            indices->pm_into_index,
+                                            indices->pm_negp_index,
+                                            indices->pm_from_index,
+                                            store, pm_type);
+   }
+   while(true)
+   {
+      j    = -1;
+      best = LONG_MAX;
+      for(i=0; i<pm_worker_count; i++)
+      {
+         unit = pm_buffer_peek_unit(&(pm_workers[i].reply));
+         if((unit != -1) && (unit < best))
+         {
+            best = unit;
+            j    = i;
+         }
+      }
+      if(j == -1)
+      {
+         break;
+      }
+      while(pm_buffer_peek_unit(&(pm_workers[j].reply)) == best)
+      {
+         pm_buffer_get_child(&(pm_workers[j].reply), bank, store);
+         res++;
+      }
+   }
+   max_nodes = PM_WORKER_BANK_FACTOR*TBNonVarTermNodes(bank);
+   for(i=0; i<pm_worker_count; i++)
+   {
+      PMBufferGet(&(pm_workers[i].reply), unit);
+      PMBufferGet(&(pm_workers[i].reply), nodes);
+      if(nodes > max_nodes)
+      {
+         pm_workers_stop();
+         break;
+      }
+   }
+   return res;
+}
+
 
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
@@ -15,6 +15,7 @@
   Run "eprover -h" for contact information.
 
   Created: Sat Jul  5 02:28:25 MET DST 1997
+  Sat Oct 17 2026: Persistent paramodulation workers.
 
   -----------------------------------------------------------------------*/
 
@@ -24,6 +25,7 @@
 
 #include <cte_idx_fp.h>
 #include <ccl_paramod.h>
+#include <ccl_global_indices.h>
 #include <che_proofcontrol.h>
 
 
@@ -31,13 +33,28 @@
 /*                    Data type declarations                           */
 /*---------------------------------------------------------------------*/
 
+/* ComputeAllParamodulantsIndexedPar() only distributes the work if
+   there are at least this many clauses in the indices. This is a
+   cheap estimate of the work for a given clause, the real number of
+   overlap candidates is only known after the index queries. */
 
+#define PM_PAR_MIN_CLAUSES 512
+
+/* Maximal number of workers */
+
+#define PM_MAX_WORKERS 256
+
+/* Workers are restarted when their term bank has grown beyond this
+   factor times the size of the prover's term bank. */
+
+#define PM_WORKER_BANK_FACTOR 4
 
 
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
+extern int ParamodWorkers;
 
 long ComputeClauseClauseParamodulants(TB_p bank, OCB_p ocb, Clause_p
                                       clause, Clause_p parent_alias,
@@ -81,6 +98,15 @@ long ComputeAllParamodulantsIndexed(TB_p bank, OCB_p ocb,
                                     ClauseSet_p store,
                                     ParamodulationType pm_type);
 
+long ComputeAllParamodulantsIndexedPar(TB_p bank, OCB_p ocb,
+                                       VarBank_p freshvars,
+                                       Clause_p clause,
+                                       Clause_p parent_alias,
+                                       GlobalIndices_p indices,
+                                       ClauseSet_p store,
+                                       ParamodulationType pm_type,
+                                       int workers);
+
 #endif
 
 /*---------------------------------------------------------------------*/
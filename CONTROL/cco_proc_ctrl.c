@@ -18,6 +18,10 @@ Changes
 
 <1> Wed Jul 14 15:54:29 BST 2010
     New
+<2> Fri Oct 16 2026
+    ECtrlCreateForked()
+<3> Sat Oct 17 2026
+    ECtrlCreateForked() can leave the standard outputs alone.
 
 -----------------------------------------------------------------------*/
 
@@ -73,6 +77,7 @@ EPCtrl_p EPCtrlAlloc(char *name)
    EPCtrl_p ctrl = EPCtrlCellAlloc();
 
    ctrl->pid        = 0;
+   ctrl->forked     = false;
    ctrl->pipe       = NULL;
    ctrl->input_file = 0;
    ctrl->name       = SecureStrdup(name);
@@ -129,6 +134,27 @@ void EPCtrlFree(EPCtrl_p junk)
 
 void EPCtrlCleanup(EPCtrl_p ctrl, bool delete_file)
 {
+   if(ctrl->forked)
+   {
+      if(ctrl->pid)
+      {
+         /* Also kill strategies forked by the prover */
+         kill(-ctrl->pid, SIGTERM);
+      }
+      if(ctrl->pipe)
+      {
+         fclose(ctrl->pipe);
+         ctrl->pipe = NULL;
+      }
+      if(ctrl->pid)
+      {
+         while((waitpid(ctrl->pid, NULL, 0) == -1) && (errno == EINTR))
+         {
+            /* Try again */
+         }
+         ctrl->pid = 0;
+      }
+   }
    if(ctrl->pid)
    {
       kill(ctrl->pid, SIGTERM);
@@ -249,6 +275,100 @@ EPCtrl_p ECtrlCreateGeneric(char* prover, char* name,
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ECtrlCreateForked()
+//
+//   Fork a child process that will run a prover in-process (on data
+//   structures inherited from the parent) with time limit cpu_limit.
+//   In the parent, return an EPCtrl block for the child (which reads
+//   the output of the child via a pipe). In the child, return NULL
+//   with the CPU limit set and, if child_out is NULL, stdout and
+//   GlobalOut redirected into the pipe. Otherwise, *child_out is set
+//   to a stream writing into the pipe, and the standard outputs are
+//   unchanged. The child becomes the leader of a new process group,
+//   so that processes it forks itself are also terminated by
+//   EPCtrlCleanup().
+//
+// Global Variables: GlobalOut, GlobalOutFD
+//
+// Side Effects    : Forks, in the child redirects output
+//
+/----------------------------------------------------------------------*/
+
+EPCtrl_p ECtrlCreateForked(char* name, char* options, long cpu_limit,
+                           FILE** child_out)
+{
+   EPCtrl_p res;
+   pid_t    pid;
+   int      pipefd[2];
+   DStr_p   procname = DStrAlloc();
+
+   if(pipe(pipefd) == -1)
+   {
+      TmpErrno = errno;
+      SysError("Cannot create pipe for prover process", SYS_ERROR);
+   }
+   fflush(GlobalOut);
+   fflush(stdout);
+   pid = fork();
+   if(pid == -1)
+   {
+      TmpErrno = errno;
+      SysError("Cannot fork prover process", SYS_ERROR);
+   }
+   if(pid == 0)
+   {
+      /* Child */
+      DStrFree(procname);
+      setpgid(0, 0);
+      close(pipefd[0]);
+      if(child_out)
+      {
+         *child_out = fdopen(pipefd[1], "w");
+         if(!*child_out)
+         {
+            TmpErrno = errno;
+            SysError("Cannot write to parent process", SYS_ERROR);
+         }
+      }
+      else
+      {
+         dup2(pipefd[1], STDOUT_FILENO);
+         if(GlobalOutFD != STDOUT_FILENO)
+         {
+            dup2(pipefd[1], GlobalOutFD);
+         }
+         close(pipefd[1]);
+      }
+      SetSoftRlimit(RLIMIT_CPU, cpu_limit);
+      return NULL;
+   }
+   /* Parent */
+   setpgid(pid, pid);
+   close(pipefd[1]);
+
+   DStrAppendStr(procname, name);
+   DStrAppendStr(procname, " => ");
+   DStrAppendStr(procname, options);
+   res = EPCtrlAlloc(DStrView(procname));
+   DStrFree(procname);
+
+   res->pid        = pid;
+   res->forked     = true;
+   res->prob_time  = cpu_limit;
+   res->start_time = GetSecTime();
+   res->fileno     = pipefd[0];
+   res->pipe       = fdopen(pipefd[0], "r");
+   if(!res->pipe)
+   {
+      TmpErrno = errno;
+      SysError("Cannot read from prover process", SYS_ERROR);
+   }
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: EPCtrlGetResult()
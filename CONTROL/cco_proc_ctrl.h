@@ -20,6 +20,10 @@ Changes
 
 <1> Wed Jul 14 11:45:55 BST 2010
     New
+<2> Fri Oct 16 2026
+    Added in-process (forked) provers.
+<3> Sat Oct 17 2026
+    Optional separate output stream for forked processes.
 
 -----------------------------------------------------------------------*/
 
@@ -28,6 +32,7 @@ Changes
 #define CCO_PROC_CTRL
 
 #include <sys/select.h>
+#include <sys/wait.h>
 #include <signal.h>
 #include <clb_numtrees.h>
 #include <clb_simple_stuff.h>
@@ -42,6 +47,9 @@ Changes
 typedef struct e_pctrl_cell
 {
    pid_t        pid;
+   bool         forked;     /* Forked from this process (pid is
+                               then a process group), not started
+                               via popen() */
    int          fileno;
    FILE*        pipe;
    char*        input_file;
@@ -94,6 +102,8 @@ EPCtrl_p ECtrlCreate(char* prover, char* name,
 EPCtrl_p ECtrlCreateGeneric(char* prover, char* name,
                             char* options, char* extra_options,
                             long cpu_limit, char* file);
+EPCtrl_p ECtrlCreateForked(char* name, char* options, long cpu_limit,
+                           FILE** child_out);
 void     EPCtrlCleanup(EPCtrl_p ctrl, bool delete_file1);
 
 bool EPCtrlGetResult(EPCtrl_p ctrl,
@@ -18,6 +18,21 @@ Changes
 
 <1> Mon Jun  8 11:47:44 MET DST 1998
     New
+<2> Fri Oct 16 2026
+    Optional parallel backward subsumption.
+<3> Sat Oct 17 2026
+    Reset the arena-backed temporary term bank after each given
+    clause.
+<4> Sat Oct 17 2026
+    Incremental SAT checking.
+<5> Sat Oct 17 2026
+    Optional batches of given clauses.
+<6> Sat Oct 17 2026
+    BWSubsumptionWorkersFree()
+<7> Sat Oct 17 2026
+    Per-step statistics for batches of given clauses.
+<8> Sat Oct 17 2026
+    Parallel forward subsumption of batches of given clauses.
 
 -----------------------------------------------------------------------*/
 
@@ -33,6 +48,16 @@ Changes
 PERF_CTR_DEFINE(ParamodTimer);
 PERF_CTR_DEFINE(BWRWTimer);
 
+/* Number of workers for backward subsumption. The context (threads
+   and private banks) is created on first use. */
+int BWSubsumptionThreads = 1;
+static ParSubsume_p bw_subsumption_par = NULL;
+
+/* Number of workers for the forward subsumption of batches of given
+   clauses, context as above. */
+int GivenBatchThreads = 1;
+static ParSubsume_p given_batch_par = NULL;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -111,7 +136,7 @@ static void check_ac_status(ProofState_p state, ProofControl_p
 //   Remove all clauses subsumed by subsumer from set, kill their
 //   children. Return number of removed clauses.
 //
-// Global Variables: -
+// Global Variables: BWSubsumptionThreads
 //
 // Side Effects    : Changes set, memory operations.
 //
@@ -126,7 +151,21 @@ static long remove_subsumed(GlobalIndices_p indices,
    long     res;
    PStack_p stack = PStackAlloc();
 
-   res = ClauseSetFindFVSubsumedClauses(set, subsumer, stack);
+   if(BWSubsumptionThreads > 1 && !ClauseIsEmpty(subsumer->clause))
+   {
+      if(!bw_subsumption_par)
+      {
+         bw_subsumption_par =
+            ParSubsumeAlloc(subsumer->clause->literals->bank->sig,
+                            BWSubsumptionThreads);
+      }
+      res = ClauseSetFindFVSubsumedClausesPar(set, subsumer, stack,
+                                              bw_subsumption_par);
+   }
+   else
+   {
+      res = ClauseSetFindFVSubsumedClauses(set, subsumer, stack);
+   }
 
    while(!PStackEmpty(stack))
    {
@@ -530,7 +569,20 @@ static void generate_new_clauses(ProofState_p state, ProofControl_p
       ||!ClauseIsNegative(clause))
    { /* Sometime we want to disable paramodulation for negative units */
       PERF_CTR_ENTRY(ParamodTimer);
-      if(state->gindices.pm_into_index)
+      if(state->gindices.pm_into_index && ParamodWorkers > 1)
+      {
+         state->paramod_count+=
+            ComputeAllParamodulantsIndexedPar(state->terms,
+                                              control->ocb,
+                                              state->freshvars,
+                                              tmp_copy,
+                                              clause,
+                                              &(state->gindices),
+                                              state->tmp_store,
+                                              control->heuristic_parms.pm_type,
+                                              ParamodWorkers);
+      }
+      else if(state->gindices.pm_into_index)
       {
          state->paramod_count+=
             ComputeAllParamodulantsIndexed(state->terms,
@@ -596,16 +648,10 @@ static void generate_new_clauses(ProofState_p state, ProofControl_p
 
 void eval_clause_set(ProofState_p state, ProofControl_p control)
 {
-   Clause_p handle;
    assert(state);
    assert(control);
 
-   for(handle = state->eval_store->anchor->succ;
-       handle != state->eval_store->anchor;
-       handle = handle->succ)
-   {
-      HCBClauseEvaluate(control->hcb, handle);
-   }
+   HCBClauseSetEvaluate(control->hcb, state->eval_store);
 }
 
 
@@ -887,6 +933,8 @@ static Clause_p cleanup_unprocessed_clauses(ProofState_p state,
 //
 //   Create ground (or pseudo-ground) instances of the clause set,
 //   hand them to a SAT solver, and check then for unsatisfiability.
+//   In incremental mode, the solver state is kept in control and
+//   only updated with the changes since the last check.
 //
 // Global Variables:
 //
@@ -915,7 +963,44 @@ Clause_p SATCheck(ProofState_p state, ProofControl_p control)
       // printf("# ForwardContraction done\n");
       preproc_time = (GetTotalCPUTime()-base_time);
    }
-   if(!empty)
+   if(!empty && control->heuristic_parms.sat_check_incremental)
+   {
+      if(!control->sat_state)
+      {
+         control->sat_state = SatIncStateAlloc(state->gc_terms);
+      }
+      base_time = GetTotalCPUTime();
+      SatIncStateUpdate(control->sat_state, state,
+                        control->heuristic_parms.sat_check_grounding,
+                        control->heuristic_parms.sat_check_normconst);
+      enc_time = (GetTotalCPUTime()-base_time);
+
+      base_time = GetTotalCPUTime();
+      res = SatIncStateCheckUnsat(control->sat_state, &empty,
+                                  control->heuristic_parms.sat_check_decision_limit);
+      solver_time = (GetTotalCPUTime()-base_time);
+      state->satcheck_count++;
+
+      state->satcheck_preproc_time  += preproc_time;
+      state->satcheck_encoding_time += enc_time;
+      state->satcheck_solver_time   += solver_time;
+      if(res == PRUnsatisfiable)
+      {
+         state->satcheck_success++;
+         state->satcheck_full_size = SatIncStateLiveClauses(control->sat_state);
+         state->satcheck_actual_size = SatIncStateLiveClauses(control->sat_state);
+         state->satcheck_core_size = SatIncStateCoreSize(control->sat_state);
+
+         state->satcheck_preproc_stime  += preproc_time;
+         state->satcheck_encoding_stime += enc_time;
+         state->satcheck_solver_stime   += solver_time;
+      }
+      else if(res == PRSatisfiable)
+      {
+         state->satcheck_satisfiable++;
+      }
+   }
+   else if(!empty)
    {
       SatClauseSet_p set = SatClauseSetAlloc();
 
@@ -1032,6 +1117,372 @@ void print_rw_state(ProofState_p state)
 #endif
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: select_given_clause()
+//
+//   Select the next given clause, remove it from state->unprocessed
+//   and mark it as processed. Return NULL if no clause is available.
+//   If proof objects need it, an archive copy is made and returned in
+//   *arch_copy (otherwise *arch_copy is NULL).
+//
+// Global Variables: ProofObjectRecordsGCSelection, OutputLevel
+//
+// Side Effects    : Changes state->unprocessed
+//
+/----------------------------------------------------------------------*/
+
+static Clause_p select_given_clause(ProofState_p state, ProofControl_p control,
+                                    Clause_p *arch_copy)
+{
+   Clause_p clause;
+
+   *arch_copy = NULL;
+   clause = control->hcb->hcb_select(control->hcb,
+                                     state->unprocessed);
+   if(!clause)
+   {
+      return NULL;
+   }
+   //EvalListPrintComment(GlobalOut, clause->evaluations); printf("\n");
+   if(OutputLevel==1)
+   {
+      putc('#', GlobalOut);
+   }
+   assert(clause);
+
+   ClauseSetExtractEntry(clause);
+   ClauseRemoveEvaluations(clause);
+   // Orphans have been excluded during selection now
+
+   ClauseSetProp(clause, CPIsProcessed);
+   state->processed_count++;
+
+   assert(!ClauseQueryProp(clause, CPIsIRVictim));
+
+   if(ProofObjectRecordsGCSelection)
+   {
+      *arch_copy = ClauseArchiveCopy(state->archive, clause);
+   }
+   return clause;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: contract_given_clause()
+//
+//   Forward-contract a given clause with the processed clauses. If it
+//   becomes redundant, free it (and remove its archive copy, if any)
+//   and return NULL. Otherwise return the packed clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes clause, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static FVPackedClause_p contract_given_clause(ProofState_p state,
+                                              ProofControl_p control,
+                                              Clause_p clause,
+                                              Clause_p arch_copy)
+{
+   FVPackedClause_p pclause;
+
+   pclause = ForwardContractClause(state, control,
+                                   clause, true,
+                                   control->heuristic_parms.forward_context_sr,
+                                   control->heuristic_parms.condensing,
+                                   FullRewrite);
+   if(!pclause && arch_copy)
+   {
+      ClauseSetDeleteEntry(arch_copy);
+   }
+   return pclause;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: integrate_given_clause()
+//
+//   Process a forward-contracted given clause: Check for answers and
+//   the empty clause, apply replacing inferences, use it for backward
+//   simplification, insert it into the processed clause sets and
+//   perform the generating inferences with it. Return true if the
+//   clause has been integrated, in which case the IR victims and the
+//   newly generated clauses are in state->tmp_store. Otherwise,
+//   *res is the empty clause (or the answer clause) if one has been
+//   found, NULL if the clause has been replaced.
+//
+// Global Variables: -
+//
+// Side Effects    : Everything ;-)
+//
+/----------------------------------------------------------------------*/
+
+static bool integrate_given_clause(ProofState_p state, ProofControl_p control,
+                                   FVPackedClause_p pclause,
+                                   long answer_limit, Clause_p *res)
+{
+   Clause_p clause, resclause, tmp_copy;
+   SysDate  clausedate;
+
+   *res = NULL;
+   if(ClauseIsSemFalse(pclause->clause))
+   {
+      state->answer_count ++;
+      ClausePrintAnswer(GlobalOut, pclause->clause, state);
+      PStackPushP(state->extract_roots, pclause->clause);
+      if(ClauseIsEmpty(pclause->clause)||
+         state->answer_count>=answer_limit)
+      {
+         clause = FVUnpackClause(pclause);
+         ClauseEvaluateAnswerLits(clause);
+         *res = clause;
+         return false;
+      }
+   }
+   assert(ClauseIsSubsumeOrdered(pclause->clause));
+   check_ac_status(state, control, pclause->clause);
+
+   document_processing(pclause->clause);
+   state->proc_non_trivial_count++;
+
+   resclause = replacing_inferences(state, control, pclause);
+   if(!resclause || ClauseIsEmpty(resclause))
+   {
+      if(resclause)
+      {
+         PStackPushP(state->extract_roots, resclause);
+      }
+      *res = resclause;
+      return false;
+   }
+
+   check_watchlist(&(state->wlindices), state->watchlist,
+                      pclause->clause, state->archive,
+                      control->heuristic_parms.watchlist_is_static);
+
+   /* Now on to backward simplification. */
+   clausedate = ClauseSetListGetMaxDate(state->demods, FullRewrite);
+
+   eliminate_backward_rewritten_clauses(state, control, pclause->clause, &clausedate);
+   eliminate_backward_subsumed_clauses(state, pclause);
+   eliminate_unit_simplified_clauses(state, pclause->clause);
+   eliminate_context_sr_clauses(state, control, pclause->clause);
+   ClauseSetSetProp(state->tmp_store, CPIsIRVictim);
+
+   clause = pclause->clause;
+
+   ClauseNormalizeVars(clause, state->freshvars);
+   tmp_copy = ClauseCopyDisjoint(clause);
+   tmp_copy->ident = clause->ident;
+
+   clause->date = clausedate;
+   ClauseSetProp(clause, CPLimitedRW);
+
+   if(ClauseIsDemodulator(clause))
+   {
+      assert(clause->neg_lit_no == 0);
+      if(EqnIsOriented(clause->literals))
+      {
+         TermCellSetProp(clause->literals->lterm, TPIsRewritable);
+         state->processed_pos_rules->date = clausedate;
+         ClauseSetIndexedInsert(state->processed_pos_rules, pclause);
+      }
+      else
+      {
+         state->processed_pos_eqns->date = clausedate;
+         ClauseSetIndexedInsert(state->processed_pos_eqns, pclause);
+      }
+   }
+   else if(ClauseLiteralNumber(clause) == 1)
+   {
+      assert(clause->neg_lit_no == 1);
+      ClauseSetIndexedInsert(state->processed_neg_units, pclause);
+   }
+   else
+   {
+      ClauseSetIndexedInsert(state->processed_non_units, pclause);
+   }
+   GlobalIndicesInsertClause(&(state->gindices), clause);
+
+   FVUnpackClause(pclause);
+   ENSURE_NULL(pclause);
+   if(state->watchlist && control->heuristic_parms.watchlist_simplify)
+   {
+      simplify_watchlist(state, control, clause);
+   }
+   if(control->heuristic_parms.selection_strategy != SelectNoGeneration)
+   {
+      generate_new_clauses(state, control, clause, tmp_copy);
+   }
+   ClauseFree(tmp_copy);
+   /* Temporary terms never survive a given-clause iteration */
+   TBArenaReset(state->tmp_terms);
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_clause_batch()
+//
+//   Select up to max_size given clauses and process them as one
+//   step. All of them are first forward-contracted against the
+//   processed clauses as they are before the batch (this is the part
+//   that does not depend on the order) by
+//   ForwardContractClauseBatch(), which distributes the non-unit
+//   subsumption tests over GivenBatchThreads threads. The result does
+//   not depend on the number of threads. They are then integrated one
+//   after the other in order of selection. Since an earlier member
+//   may simplify or subsume a later one, a member is contracted again
+//   if any earlier member has entered the processed set. Each member
+//   performs its generating inferences right after it has been
+//   inserted, so every pair of clauses is considered exactly once, as
+//   in the classical loop. The IR victims and new clauses of all
+//   members are collected and inserted into state->unprocessed
+//   together at the end. All other steps run in the calling
+//   thread. The time spent in each step, the largest batch and the
+//   numbers of integrated members and new clauses are added to the
+//   statistics in state, and with Verbose >= 2 a summary of each
+//   batch is printed to stderr. Return the empty clause if it has
+//   been derived, NULL otherwise.
+//
+// Global Variables: GivenBatchThreads, given_batch_par
+//
+// Side Effects    : Everything ;-)
+//
+/----------------------------------------------------------------------*/
+
+static Clause_p process_clause_batch(ProofState_p state,
+                                     ProofControl_p control,
+                                     long max_size, long answer_limit)
+{
+   PStack_p         batch = PStackAlloc(),
+                    arch_copies = PStackAlloc();
+   ClauseSet_p      store = ClauseSetAlloc();
+   Clause_p         clause, arch_copy, res = NULL;
+   FVPackedClause_p pclause;
+   PStackPointer    i, size;
+   bool             recheck = false;
+   long             discarded = state->given_batch_discarded,
+                    integrated = 0, new_clauses;
+   double           base_time = GetTotalCPUTime(), contract_time,
+                    integrate_time;
+
+   while(PStackGetSP(batch) < max_size &&
+         (clause = select_given_clause(state, control, &arch_copy)))
+   {
+      PStackPushP(batch, clause);
+      PStackPushP(arch_copies, arch_copy);
+   }
+   if(GivenBatchThreads > 1 && !given_batch_par)
+   {
+      given_batch_par = ParSubsumeAlloc(state->signature,
+                                        GivenBatchThreads);
+   }
+   ForwardContractClauseBatch(state, control, batch,
+                              control->heuristic_parms.forward_context_sr,
+                              control->heuristic_parms.condensing,
+                              FullRewrite, given_batch_par);
+   size = PStackGetSP(batch);
+   for(i=0; i<size; i++)
+   {
+      arch_copy = PStackElementP(arch_copies, i);
+      if(!PStackElementP(batch, i))
+      {
+         state->given_batch_discarded++;
+         if(arch_copy)
+         {
+            ClauseSetDeleteEntry(arch_copy);
+         }
+      }
+   }
+   state->given_batch_count++;
+   state->given_batch_clauses += size;
+   state->given_batch_max_size = MAX(state->given_batch_max_size,
+                                     (unsigned long)size);
+   contract_time = GetTotalCPUTime()-base_time;
+   base_time = GetTotalCPUTime();
+
+   for(i=0; i<size; i++)
+   {
+      pclause   = PStackElementP(batch, i);
+      arch_copy = PStackElementP(arch_copies, i);
+      if(!pclause)
+      {
+         continue;
+      }
+      if(res)
+      {
+         ClauseFree(FVUnpackClause(pclause));
+         continue;
+      }
+      if(recheck)
+      {
+         pclause = contract_given_clause(state, control,
+                                         FVUnpackClause(pclause),
+                                         arch_copy);
+         if(!pclause)
+         {
+            state->given_batch_discarded++;
+            state->given_batch_recheck_discarded++;
+            continue;
+         }
+      }
+      if(integrate_given_clause(state, control, pclause,
+                                answer_limit, &res))
+      {
+         integrated++;
+         recheck = true;
+         ClauseSetInsertSet(store, state->tmp_store);
+      }
+   }
+   PStackFree(arch_copies);
+   PStackFree(batch);
+
+   ClauseSetInsertSet(state->tmp_store, store);
+   ClauseSetFree(store);
+   integrate_time = GetTotalCPUTime()-base_time;
+   new_clauses = ClauseSetCardinality(state->tmp_store);
+
+   state->given_batch_integrated     += integrated;
+   state->given_batch_contract_time  += contract_time;
+   state->given_batch_integrate_time += integrate_time;
+   VERBOSE2(fprintf(stderr, "%s: Batch %ld: %ld selected, %ld discarded, "
+                    "%ld integrated, %ld new clauses, %.3f/%.3f s\n",
+                    ProgName, state->given_batch_count, (long)size,
+                    (long)state->given_batch_discarded-discarded,
+                    integrated, new_clauses, contract_time,
+                    integrate_time););
+   if(res)
+   {
+      return res;
+   }
+   state->given_batch_new_clauses += new_clauses;
+   base_time = GetTotalCPUTime();
+#ifdef PRINT_SHARING
+   print_sharing_factor(state);
+#endif
+#ifdef PRINT_RW_STATE
+   print_rw_state(state);
+#endif
+   if(control->heuristic_parms.detsort_tmpset)
+   {
+      ClauseSetSort(state->tmp_store, ClauseCmpByStructWeight);
+   }
+   res = insert_new_clauses(state, control);
+   state->given_batch_insert_time += GetTotalCPUTime()-base_time;
+   if(res)
+   {
+      PStackPushP(state->extract_roots, res);
+   }
+   return res;
+}
+
+
 
 
 
@@ -1073,6 +1524,10 @@ void ProofControlInit(ProofState_p state, ProofControl_p control,
 
    control->ocb = TOSelectOrdering(state, params,
                                    &(control->problem_specs));
+   if(TOCmpCacheSize)
+   {
+      control->ocb->cmp_cache = CmpCacheAlloc(TOCmpCacheSize);
+   }
 
    in = CreateScanner(StreamTypeInternalString,
                       DefaultWeightFunctions,
@@ -1190,6 +1645,52 @@ void ProofStateResetProcessed(ProofState_p state, ProofControl_p control)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: BWSubsumptionWorkersFree()
+//
+//   Stop the worker threads for backward subsumption (if any) and
+//   free their data.
+//
+// Global Variables: bw_subsumption_par
+//
+// Side Effects    : Memory operations, stops threads
+//
+/----------------------------------------------------------------------*/
+
+void BWSubsumptionWorkersFree(void)
+{
+   if(bw_subsumption_par)
+   {
+      ParSubsumeFree(bw_subsumption_par);
+      bw_subsumption_par = NULL;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GivenBatchWorkersFree()
+//
+//   Stop the worker threads for the forward subsumption of batches
+//   of given clauses (if any) and free their data.
+//
+// Global Variables: given_batch_par
+//
+// Side Effects    : Memory operations, stops threads
+//
+/----------------------------------------------------------------------*/
+
+void GivenBatchWorkersFree(void)
+{
+   if(given_batch_par)
+   {
+      ParSubsumeFree(given_batch_par);
+      given_batch_par = NULL;
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: fvi_param_init()
@@ -1291,8 +1792,16 @@ void fvi_param_init(ProofState_p state, ProofControl_p control)
                             control->fvi_parms.eliminate_uninformative);
    if(control->fvi_parms.cspec.features != FVINoFeatures)
    {
-      state->processed_non_units->fvindex =
-         FVIAnchorAlloc(cspec, PermVectorCopy(perm));
+      if(control->fvi_parms.use_columns)
+      {
+         state->processed_non_units->fvindex =
+            FVIAnchorAllocColumns(cspec, PermVectorCopy(perm));
+      }
+      else
+      {
+         state->processed_non_units->fvindex =
+            FVIAnchorAlloc(cspec, PermVectorCopy(perm));
+      }
       state->processed_pos_rules->fvindex =
          FVIAnchorAlloc(cspec, PermVectorCopy(perm));
       state->processed_pos_eqns->fvindex =
@@ -1364,9 +1873,9 @@ void ProofStateInit(ProofState_p state, ProofControl_p control)
    ClauseSetReweight(tmphcb, state->axioms);
 
    traverse =
-      EvalTreeTraverseInit(PDArrayElementP(state->axioms->eval_indices,0),0);
+      EvalHeapTraverseInit(PDArrayElementP(state->axioms->eval_indices,0),0);
 
-   while((cell = EvalTreeTraverseNext(traverse, 0)))
+   while((cell = EvalHeapTraverseNext(traverse)))
    {
       handle = cell->object;
       new = ClauseCopy(handle, state->terms);
@@ -1389,8 +1898,8 @@ void ProofStateInit(ProofState_p state, ProofControl_p control)
       ClauseSetInsert(state->unprocessed, new);
    }
    ClauseSetMarkSOS(state->unprocessed, control->heuristic_parms.use_tptp_sos);
-   // printf("Before EvalTreeTraverseExit\n");
-   EvalTreeTraverseExit(traverse);
+   // printf("Before EvalHeapTraverseExit\n");
+   EvalHeapTraverseExit(traverse);
 
    if(control->heuristic_parms.ac_handling!=NoACHandling)
    {
@@ -1436,141 +1945,21 @@ void ProofStateInit(ProofState_p state, ProofControl_p control)
 Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
                        long answer_limit)
 {
-   Clause_p         clause, resclause, tmp_copy, empty, arch_copy = NULL;
+   Clause_p         clause, arch_copy, res;
    FVPackedClause_p pclause;
-   SysDate          clausedate;
 
-   clause = control->hcb->hcb_select(control->hcb,
-                                     state->unprocessed);
+   clause = select_given_clause(state, control, &arch_copy);
    if(!clause)
    {
       return NULL;
    }
-   //EvalListPrintComment(GlobalOut, clause->evaluations); printf("\n");
-   if(OutputLevel==1)
-   {
-      putc('#', GlobalOut);
-   }
-   assert(clause);
-
-   ClauseSetExtractEntry(clause);
-   ClauseRemoveEvaluations(clause);
-   // Orphans have been excluded during selection now
-
-   ClauseSetProp(clause, CPIsProcessed);
-   state->processed_count++;
-
-   assert(!ClauseQueryProp(clause, CPIsIRVictim));
-
-   if(ProofObjectRecordsGCSelection)
-   {
-      arch_copy = ClauseArchiveCopy(state->archive, clause);
-   }
-
-   if(!(pclause = ForwardContractClause(state, control,
-                                        clause, true,
-                                        control->heuristic_parms.forward_context_sr,
-                                        control->heuristic_parms.condensing,
-                                        FullRewrite)))
+   if(!(pclause = contract_given_clause(state, control, clause, arch_copy)))
    {
-      if(arch_copy)
-      {
-         ClauseSetDeleteEntry(arch_copy);
-      }
       return NULL;
    }
-
-   if(ClauseIsSemFalse(pclause->clause))
+   if(!integrate_given_clause(state, control, pclause, answer_limit, &res))
    {
-      state->answer_count ++;
-      ClausePrintAnswer(GlobalOut, pclause->clause, state);
-      PStackPushP(state->extract_roots, pclause->clause);
-      if(ClauseIsEmpty(pclause->clause)||
-         state->answer_count>=answer_limit)
-      {
-         clause = FVUnpackClause(pclause);
-         ClauseEvaluateAnswerLits(clause);
-         return clause;
-      }
-   }
-   assert(ClauseIsSubsumeOrdered(pclause->clause));
-   check_ac_status(state, control, pclause->clause);
-
-   document_processing(pclause->clause);
-   state->proc_non_trivial_count++;
-
-   resclause = replacing_inferences(state, control, pclause);
-   if(!resclause || ClauseIsEmpty(resclause))
-   {
-      if(resclause)
-      {
-         PStackPushP(state->extract_roots, resclause);
-      }
-      return resclause;
-   }
-
-   check_watchlist(&(state->wlindices), state->watchlist,
-                      pclause->clause, state->archive,
-                      control->heuristic_parms.watchlist_is_static);
-
-   /* Now on to backward simplification. */
-   clausedate = ClauseSetListGetMaxDate(state->demods, FullRewrite);
-
-   eliminate_backward_rewritten_clauses(state, control, pclause->clause, &clausedate);
-   eliminate_backward_subsumed_clauses(state, pclause);
-   eliminate_unit_simplified_clauses(state, pclause->clause);
-   eliminate_context_sr_clauses(state, control, pclause->clause);
-   ClauseSetSetProp(state->tmp_store, CPIsIRVictim);
-
-   clause = pclause->clause;
-
-   ClauseNormalizeVars(clause, state->freshvars);
-   tmp_copy = ClauseCopyDisjoint(clause);
-   tmp_copy->ident = clause->ident;
-
-   clause->date = clausedate;
-   ClauseSetProp(clause, CPLimitedRW);
-
-   if(ClauseIsDemodulator(clause))
-   {
-      assert(clause->neg_lit_no == 0);
-      if(EqnIsOriented(clause->literals))
-      {
-         TermCellSetProp(clause->literals->lterm, TPIsRewritable);
-         state->processed_pos_rules->date = clausedate;
-         ClauseSetIndexedInsert(state->processed_pos_rules, pclause);
-      }
-      else
-      {
-         state->processed_pos_eqns->date = clausedate;
-         ClauseSetIndexedInsert(state->processed_pos_eqns, pclause);
-      }
-   }
-   else if(ClauseLiteralNumber(clause) == 1)
-   {
-      assert(clause->neg_lit_no == 1);
-      ClauseSetIndexedInsert(state->processed_neg_units, pclause);
-   }
-   else
-   {
-      ClauseSetIndexedInsert(state->processed_non_units, pclause);
-   }
-   GlobalIndicesInsertClause(&(state->gindices), clause);
-
-   FVUnpackClause(pclause);
-   ENSURE_NULL(pclause);
-   if(state->watchlist && control->heuristic_parms.watchlist_simplify)
-   {
-      simplify_watchlist(state, control, clause);
-   }
-   if(control->heuristic_parms.selection_strategy != SelectNoGeneration)
-   {
-      generate_new_clauses(state, control, clause, tmp_copy);
-   }
-   ClauseFree(tmp_copy);
-   if(TermCellStoreNodes(&(state->tmp_terms->term_store))>TMPBANK_GC_LIMIT)
-   {
-      TBGCSweep(state->tmp_terms);
+      return res;
    }
 #ifdef PRINT_SHARING
    print_sharing_factor(state);
@@ -1582,12 +1971,11 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    {
       ClauseSetSort(state->tmp_store, ClauseCmpByStructWeight);
    }
-   if((empty = insert_new_clauses(state, control)))
+   if((res = insert_new_clauses(state, control)))
    {
-      PStackPushP(state->extract_roots, empty);
-      return empty;
+      PStackPushP(state->extract_roots, res);
    }
-   return NULL;
+   return res;
 }
 
 
@@ -1611,6 +1999,7 @@ Clause_p Saturate(ProofState_p state, ProofControl_p control, long
                   long answer_limit)
 {
    Clause_p unsatisfiable = NULL;
+   unsigned long selected;
    long
       count = 0,
       sat_check_size_limit = control->heuristic_parms.sat_check_size_limit,
@@ -1629,8 +2018,20 @@ Clause_p Saturate(ProofState_p state, ProofControl_p control, long
          tb_insert_limit > state->terms->insertions &&
          (!state->watchlist||!ClauseSetEmpty(state->watchlist)))
    {
-      count++;
-      unsatisfiable = ProcessClause(state, control, answer_limit);
+      if(control->heuristic_parms.given_batch_size > 1)
+      {
+         selected = state->processed_count;
+         unsatisfiable = process_clause_batch(state, control,
+                                              MIN(control->heuristic_parms.given_batch_size,
+                                                  step_limit-count),
+                                              answer_limit);
+         count += MAX(state->processed_count-selected, 1);
+      }
+      else
+      {
+         count++;
+         unsatisfiable = ProcessClause(state, control, answer_limit);
+      }
       if(unsatisfiable)
       {
          break;
@@ -18,6 +18,8 @@ Changes
 
 <1> Mon Jun  8 04:19:50 MET DST 1998
     New
+<2> Sat Oct 17 2026
+    Removed TMPBANK_GC_LIMIT (the temporary bank is reset instead)
 
 -----------------------------------------------------------------------*/
 
@@ -50,12 +52,9 @@ Changes
 PERF_CTR_DECL(ParamodTimer);
 PERF_CTR_DECL(BWRWTimer);
 
+extern int BWSubsumptionThreads;
+extern int GivenBatchThreads;
 
-/* Collect term cells from temporary clause copies if their number
-   reaches this. 10000 is big enough that it nearly never happens, 500
-   is big enough that it rarely happens, but that the bank remains
-   small enough. */
-#define TMPBANK_GC_LIMIT 256
 
 void     ProofControlInit(ProofState_p state, ProofControl_p control,
            HeuristicParms_p params,
@@ -68,6 +67,8 @@ void     ProofStateResetProcessedSet(ProofState_p state,
                                      ClauseSet_p set);
 void     ProofStateResetProcessed(ProofState_p state,
                                   ProofControl_p control);
+void     BWSubsumptionWorkersFree(void);
+void     GivenBatchWorkersFree(void);
 Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
                        long answer_limit);
 Clause_p Saturate(ProofState_p state, ProofControl_p control, long
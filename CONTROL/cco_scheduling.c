@@ -16,6 +16,8 @@ Contents
 Changes
 
 <1>     New
+<2> Fri Oct 16 2026
+    Parallel portfolio mode (ExecuteScheduleMultiCore()).
 
 -----------------------------------------------------------------------*/
 
@@ -52,30 +54,23 @@ ScheduleCell StratSchedule[] =
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
-
-
-/*---------------------------------------------------------------------*/
-/*                         Exported Functions                          */
-/*---------------------------------------------------------------------*/
-
 /*-----------------------------------------------------------------------
 //
-// Function: ScheduleTimesInit()
+// Function: schedule_time_limit()
 //
+//   Return the CPU time (in seconds) still available for the whole
+//   schedule.
 //
+// Global Variables: ScheduleTimeLimit
 //
-// Global Variables:
-//
-// Side Effects    :
+// Side Effects    : -
 //
 /----------------------------------------------------------------------*/
 
-void ScheduleTimesInit(ScheduleCell sched[], double time_used)
+static rlim_t schedule_time_limit(double time_used)
 {
-   int i;
-   rlim_t sum = 0, tmp, limit;
+   rlim_t limit = 0;
 
-   limit = 0;
    if(ScheduleTimeLimit)
    {
       if(ScheduleTimeLimit>time_used)
@@ -90,6 +85,236 @@ void ScheduleTimesInit(ScheduleCell sched[], double time_used)
          limit = DEFAULT_SCHED_TIME_LIMIT-time_used;
       }
    }
+   return limit;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: schedule_report_failure()
+//
+//   Print the TSTP status for a schedule where no strategy has
+//   succeeded and terminate with the given status.
+//
+//   The following is ugly: Because the individual strategies can
+//   fail, but the whole schedule can succeed, we cannot let the
+//   strategies report failure to standard out (that might confuse
+//   badly-written meta-tools (and there are such ;-)). Hence, the
+//   TSPT status in the failure case is suppressed and needs to be
+//   added here. This is ony partially possible - we take the exit
+//   status of the last strategy of the schedule.
+//
+// Global Variables: GlobalOut, GlobalOutFD
+//
+// Side Effects    : Output, terminates the process.
+//
+/----------------------------------------------------------------------*/
+
+static void schedule_report_failure(int status)
+{
+   switch(status)
+   {
+   case PROOF_FOUND:
+   case SATISFIABLE:
+         /* Nothing to do, success reported by the child */
+         break;
+   case OUT_OF_MEMORY:
+    TSTPOUT(stdout, "ResourceOut");
+         break;
+   case SYNTAX_ERROR:
+         /* Should never be possible here */
+         TSTPOUT(stdout, "SyntaxError");
+         break;
+   case USAGE_ERROR:
+         /* Should never be possible here */
+         TSTPOUT(stdout, "UsageError");
+         break;
+   case FILE_ERROR:
+         /* Should never be possible here */
+         TSTPOUT(stdout, "OSError");
+         break;
+   case SYS_ERROR:
+         TSTPOUT(stdout, "OSError");
+         break;
+   case CPU_LIMIT_ERROR:
+         WriteStr(GlobalOutFD, "\n# Failure: Resource limit exceeded (time)\n");
+         TSTPOUTFD(GlobalOutFD, "ResourceOut");
+         Error("CPU time limit exceeded, terminating", CPU_LIMIT_ERROR);
+         break;
+   case RESOURCE_OUT:
+    TSTPOUT(stdout, "ResourceOut");
+         break;
+   case INCOMPLETE_PROOFSTATE:
+         TSTPOUT(GlobalOut, "GaveUp");
+         break;
+   case OTHER_ERROR:
+         TSTPOUT(stdout, "Error");
+         break;
+   case INPUT_SEMANTIC_ERROR:
+         TSTPOUT(stdout, "SemanticError");
+         break;
+   default:
+         break;
+   }
+   exit(status);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: schedule_start_proc()
+//
+//   Fork a child for strategy strats[index] with its output going
+//   into a fresh pipe. In the child, close the read ends of all
+//   other running strategies, redirect the output, set the time
+//   limit and return 0. In the parent, record the new process in
+//   proc and return its pid.
+//
+// Global Variables: GlobalOut, GlobalOutFD, SilentTimeOut
+//
+// Side Effects    : Forks, output, sets heuristic parameters.
+//
+/----------------------------------------------------------------------*/
+
+static pid_t schedule_start_proc(ScheduleCell strats[], int index,
+                                 HeuristicParms_p h_parms,
+                                 ScheduleProcCell procs[], int running)
+{
+   int   pipefd[2], i;
+   pid_t pid;
+
+   h_parms->heuristic_name         = strats[index].heu_name;
+   h_parms->order_params.ordertype = strats[index].ordering;
+   fprintf(GlobalOut, "# Starting %s with %ld s\n",
+           strats[index].heu_name,
+           (long)strats[index].time_absolute);
+   fflush(GlobalOut);
+
+   if(pipe(pipefd) == -1)
+   {
+      TmpErrno = errno;
+      SysError("Cannot create pipe for schedule child", SYS_ERROR);
+   }
+   pid = fork();
+   if(pid == -1)
+   {
+      TmpErrno = errno;
+      SysError("Cannot fork schedule child", SYS_ERROR);
+   }
+   if(pid == 0)
+   {
+      /* Child */
+      for(i=0; i<running; i++)
+      {
+         close(procs[i].fd);
+      }
+      close(pipefd[0]);
+      dup2(pipefd[1], GlobalOutFD);
+      close(pipefd[1]);
+      SilentTimeOut = true;
+      if(strats[index].time_absolute!=RLIM_INFINITY)
+      {
+         SetSoftRlimit(RLIMIT_CPU, strats[index].time_absolute);
+      }
+      return pid;
+   }
+   /* Parent */
+   close(pipefd[1]);
+   procs[running].pid    = pid;
+   procs[running].fd     = pipefd[0];
+   procs[running].index  = index;
+   procs[running].output = DStrAlloc();
+
+   return pid;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: schedule_pass_on_time()
+//
+//   Give the unused CPU time of a failed strategy to the first
+//   strategy after next_strat that has a finite time limit (but never
+//   more than limit).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the time limits in strats.
+//
+/----------------------------------------------------------------------*/
+
+static void schedule_pass_on_time(ScheduleCell strats[], int next_strat,
+                                  rlim_t leftover, rlim_t limit)
+{
+   int i;
+
+   for(i=next_strat; strats[i].heu_name; i++)
+   {
+      if(strats[i].time_absolute != RLIM_INFINITY)
+      {
+         strats[i].time_absolute = MIN(strats[i].time_absolute+leftover,
+                                       limit);
+         break;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: schedule_kill_procs()
+//
+//   Kill and reap all running strategies and free their output.
+//
+// Global Variables: -
+//
+// Side Effects    : Kills processes
+//
+/----------------------------------------------------------------------*/
+
+static void schedule_kill_procs(ScheduleProcCell procs[], int running)
+{
+   int i;
+
+   for(i=0; i<running; i++)
+   {
+      kill(procs[i].pid, SIGKILL);
+   }
+   for(i=0; i<running; i++)
+   {
+      while((waitpid(procs[i].pid, NULL, 0) == -1) && (errno == EINTR))
+      {
+         /* Try again */
+      }
+      close(procs[i].fd);
+      DStrFree(procs[i].output);
+   }
+}
+
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: ScheduleTimesInit()
+//
+//
+//
+// Global Variables:
+//
+// Side Effects    :
+//
+/----------------------------------------------------------------------*/
+
+void ScheduleTimesInit(ScheduleCell sched[], double time_used)
+{
+   int i;
+   rlim_t sum = 0, tmp, limit;
+
+   limit = schedule_time_limit(time_used);
 
    for(i=0; sched[i+1].heu_name; i++)
    {
@@ -187,58 +412,166 @@ pid_t ExecuteSchedule(ScheduleCell strats[],
    {
       PrintRusage(GlobalOut);
    }
-   /* The following is ugly: Because the individual strategies can
-      fail, but the whole schedule can succeed, we cannot let the
-      strategies report failure to standard out (that might confuse
-      badly-written meta-tools (and there are such ;-)). Hence, the
-      TSPT status in the failure case is suppressed and needs to be
-      added here. This is ony partially possible - we take the exit
-      status of the last strategy of the schedule. */
-   switch(status)
+   schedule_report_failure(status);
+   return pid;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ExecuteScheduleMultiCore()
+//
+//   Execute the schedule as a portfolio, running up to cores
+//   strategies in parallel. Each strategy gets cores times its
+//   sequential share of the time (capped at the total time), and the
+//   unused time of strategies that fail early is passed on to the
+//   ones not yet started. The output of each child is collected via
+//   a pipe, and only the output of a successful strategy is printed.
+//   As soon as one strategy finds a proof or saturation, all others
+//   are killed.
+//
+// Global Variables: SilentTimeOut, GlobalOut, GlobalOutFD
+//
+// Side Effects    : Forks, the children run the proof search, re-set
+//                   time limits, set heuristic parameters. The
+//                   parent never returns.
+//
+/----------------------------------------------------------------------*/
+
+pid_t ExecuteScheduleMultiCore(ScheduleCell strats[],
+                               HeuristicParms_p  h_parms,
+                               bool print_rusage,
+                               int cores)
+{
+   int              raw_status, status = OTHER_ERROR, i, maxfd,
+                    next_strat = 0, running = 0;
+   pid_t            pid = 0;
+   double           run_time = GetTotalCPUTime();
+   rlim_t           limit, used, share;
+   fd_set           readfds;
+   ssize_t          len;
+   struct rusage    usage;
+   ScheduleProcCell procs[SCHED_MAX_CORES];
+   char             buffer[SCHED_BUFSIZE];
+
+   cores = MIN(cores, SCHED_MAX_CORES);
+   if(cores <= 1)
    {
-   case PROOF_FOUND:
-   case SATISFIABLE:
-         /* Nothing to do, success reported by the child */
-         break;
-   case OUT_OF_MEMORY:
-    TSTPOUT(stdout, "ResourceOut");
-         break;
-   case SYNTAX_ERROR:
-         /* Should never be possible here */
-         TSTPOUT(stdout, "SyntaxError");
-         break;
-   case USAGE_ERROR:
-         /* Should never be possible here */
-         TSTPOUT(stdout, "UsageError");
-         break;
-   case FILE_ERROR:
-         /* Should never be possible here */
-         TSTPOUT(stdout, "OSError");
-         break;
-   case SYS_ERROR:
-         TSTPOUT(stdout, "OSError");
-         break;
-   case CPU_LIMIT_ERROR:
-         WriteStr(GlobalOutFD, "\n# Failure: Resource limit exceeded (time)\n");
-         TSTPOUTFD(GlobalOutFD, "ResourceOut");
-         Error("CPU time limit exceeded, terminating", CPU_LIMIT_ERROR);
-         break;
-   case RESOURCE_OUT:
-    TSTPOUT(stdout, "ResourceOut");
-         break;
-   case INCOMPLETE_PROOFSTATE:
-         TSTPOUT(GlobalOut, "GaveUp");
-         break;
-   case OTHER_ERROR:
-         TSTPOUT(stdout, "Error");
-         break;
-   case INPUT_SEMANTIC_ERROR:
-         TSTPOUT(stdout, "SemanticError");
-         break;
-   default:
-         break;
+      return ExecuteSchedule(strats, h_parms, print_rusage);
    }
-   exit(status);
+   ScheduleTimesInit(strats, run_time);
+   limit = schedule_time_limit(run_time);
+   for(i=0; strats[i].heu_name; i++)
+   {
+      if(strats[i].time_absolute != RLIM_INFINITY)
+      {
+         share = strats[i+1].heu_name?
+            strats[i].time_fraction*limit*cores:
+            strats[i].time_absolute*cores;
+         strats[i].time_absolute = MAX(MIN(share, limit), 1);
+      }
+   }
+
+   while(strats[next_strat].heu_name || running)
+   {
+      while(strats[next_strat].heu_name && (running < cores))
+      {
+         pid = schedule_start_proc(strats, next_strat, h_parms,
+                                   procs, running);
+         if(pid == 0)
+         {
+            return pid;
+         }
+         next_strat++;
+         running++;
+      }
+
+      FD_ZERO(&readfds);
+      maxfd = 0;
+      for(i=0; i<running; i++)
+      {
+         FD_SET(procs[i].fd, &readfds);
+         maxfd = MAX(maxfd, procs[i].fd);
+      }
+      if(select(maxfd+1, &readfds, NULL, NULL, NULL) == -1)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         TmpErrno = errno;
+         SysError("select() failed while running schedule", SYS_ERROR);
+      }
+      for(i=0; i<running; i++)
+      {
+         if(!FD_ISSET(procs[i].fd, &readfds))
+         {
+            continue;
+         }
+         len = read(procs[i].fd, buffer, SCHED_BUFSIZE);
+         if(len > 0)
+         {
+            DStrAppendBuffer(procs[i].output, buffer, len);
+            continue;
+         }
+         if((len == -1) && (errno == EINTR))
+         {
+            continue;
+         }
+         /* End of output - the child has terminated */
+         while((wait4(procs[i].pid, &raw_status, 0, &usage) == -1)
+               && (errno == EINTR))
+         {
+            /* Try again */
+         }
+         close(procs[i].fd);
+         if(WIFEXITED(raw_status))
+         {
+            status = WEXITSTATUS(raw_status);
+            if((status == SATISFIABLE) || (status == PROOF_FOUND))
+            {
+               fputs(DStrView(procs[i].output), GlobalOut);
+               fprintf(GlobalOut, "# Success with %s\n",
+                       strats[procs[i].index].heu_name);
+               fflush(GlobalOut);
+               DStrFree(procs[i].output);
+               procs[i] = procs[--running];
+               schedule_kill_procs(procs, running);
+               if(print_rusage)
+               {
+                  PrintRusage(GlobalOut);
+               }
+               exit(status);
+            }
+            fprintf(GlobalOut, "# No success with %s\n",
+                    strats[procs[i].index].heu_name);
+         }
+         else
+         {
+            fprintf(GlobalOut, "# Abnormal termination for %s\n",
+                    strats[procs[i].index].heu_name);
+         }
+         fflush(GlobalOut);
+         if(strats[procs[i].index].time_absolute != RLIM_INFINITY)
+         {
+            used = usage.ru_utime.tv_sec+usage.ru_stime.tv_sec;
+            if(used < strats[procs[i].index].time_absolute)
+            {
+               schedule_pass_on_time(strats, next_strat,
+                                     strats[procs[i].index].time_absolute-used,
+                                     limit);
+            }
+         }
+         DStrFree(procs[i].output);
+         procs[i] = procs[--running];
+         i--;
+      }
+   }
+   if(print_rusage)
+   {
+      PrintRusage(GlobalOut);
+   }
+   schedule_report_failure(status);
    return pid;
 }
 
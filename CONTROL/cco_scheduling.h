@@ -18,6 +18,8 @@ Changes
 
 <1> Wed May 22 22:33:40 CEST 2013
     New
+<2> Fri Oct 16 2026
+    Added parallel portfolio execution of schedules.
 
 -----------------------------------------------------------------------*/
 
@@ -27,6 +29,9 @@ Changes
 
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <sys/resource.h>
+#include <sys/select.h>
+#include <signal.h>
 #include <cio_signals.h>
 #include <che_hcb.h>
 
@@ -44,11 +49,26 @@ typedef struct schedule_cell
 }ScheduleCell, *Schedule_p;
 
 
+/* A running strategy in portfolio mode - the child process, the
+   read end of the pipe its output goes to, and the output collected
+   so far. */
+
+typedef struct schedule_proc_cell
+{
+   pid_t  pid;
+   int    fd;
+   int    index;
+   DStr_p output;
+}ScheduleProcCell, *ScheduleProc_p;
+
+
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
 #define DEFAULT_SCHED_TIME_LIMIT 300
+#define SCHED_MAX_CORES          256
+#define SCHED_BUFSIZE            4096
 
 extern ScheduleCell StratSchedule[];
 
@@ -56,6 +76,10 @@ void ScheduleTimesInit(ScheduleCell sched[], double time_used);
 pid_t ExecuteSchedule(ScheduleCell strats[],
                       HeuristicParms_p  h_parms,
                       bool print_rusage);
+pid_t ExecuteScheduleMultiCore(ScheduleCell strats[],
+                               HeuristicParms_p  h_parms,
+                               bool print_rusage,
+                               int cores);
 
 
 #endif
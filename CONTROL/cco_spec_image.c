@@ -0,0 +1,1329 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_spec_image.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Writing and (memory-mapped) reading of binary axiom set images.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sat Oct 17 2026
+    New
+<2> Sat Oct 17 2026
+    Store size and modification time of the source files, checksum
+    images and reject damaged ones without terminating.
+<3> Sat Oct 17 2026
+    SpecImageLoadMapped()
+
+-----------------------------------------------------------------------*/
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "cco_spec_image.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Bookkeeping while writing an image: Types, variables and terms are
+   numbered in the order they are written, the maps store number+1
+   (0 means "not yet seen"). */
+
+typedef struct image_writer_cell
+{
+   FILE*     out;
+   uint64_t  checksum;   /* Of all words written so far */
+   PDArray_p type_idx;   /* type_uid -> number+1 */
+   PStack_p  types;
+   PDArray_p var_idx;    /* -f_code -> number+1 */
+   PStack_p  vars;
+   PDArray_p term_idx;   /* entry_no -> number+1 */
+   PStack_p  term_list;
+   PStack_p  encoded;    /* Formula encodings of the clauses */
+}ImageWriterCell, *ImageWriter_p;
+
+#define IMAGE_WORD_ALIGN(bytes) \
+   ((((bytes)+sizeof(ImageWord)-1)/sizeof(ImageWord))*sizeof(ImageWord))
+
+/* FNV-1a, applied to whole words */
+#define IMAGE_CHECKSUM_INIT 0xcbf29ce484222325ULL
+#define IMAGE_CHECKSUM_STEP(sum, word) \
+   (((sum)^(uint64_t)(word))*0x100000001b3ULL)
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_put()
+//
+//   Write a single word.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void img_put(ImageWriter_p writer, ImageWord word)
+{
+   fwrite(&word, sizeof(ImageWord), 1, writer->out);
+   writer->checksum = IMAGE_CHECKSUM_STEP(writer->checksum, word);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_put_string()
+//
+//   Write a string (length, characters, NUL, padding), or -1 for
+//   NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void img_put_string(ImageWriter_p writer, char* str)
+{
+   size_t    len, i;
+   ImageWord word;
+
+   if(!str)
+   {
+      img_put(writer, -1);
+      return;
+   }
+   len = strlen(str);
+   img_put(writer, len);
+   for(i=0; i<IMAGE_WORD_ALIGN(len+1); i+=sizeof(ImageWord))
+   {
+      word = 0;
+      memcpy(&word, str+i, MIN(sizeof(ImageWord), len-MIN(i,len)));
+      img_put(writer, word);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_file_stamp()
+//
+//   Find the file name (absolute, relative to default_dir, or
+//   relative to the TPTP directory, as the scanner does for include
+//   files) and return its size and modification time (-1 for both
+//   if it does not exist).
+//
+// Global Variables: TPTP_dir
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void img_file_stamp(char* name, char* default_dir,
+                           ImageWord *size, ImageWord *mtime)
+{
+   DStr_p      full_name = DStrAlloc();
+   struct stat stat_buf;
+   int         res;
+
+   if(!FileNameIsAbsolute(name) && default_dir)
+   {
+      DStrAppendStr(full_name, default_dir);
+   }
+   DStrAppendStr(full_name, name);
+   res = stat(DStrView(full_name), &stat_buf);
+   if(res == -1 && !FileNameIsAbsolute(name) && TPTP_dir)
+   {
+      DStrSet(full_name, TPTP_dir);
+      DStrAppendStr(full_name, name);
+      res = stat(DStrView(full_name), &stat_buf);
+   }
+   *size  = (res==-1)?-1:(ImageWord)stat_buf.st_size;
+   *mtime = (res==-1)?-1:(ImageWord)stat_buf.st_mtime;
+   DStrFree(full_name);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_put_file()
+//
+//   Write a file name with its size and modification time.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void img_put_file(ImageWriter_p writer, char* name, char* default_dir)
+{
+   ImageWord size, mtime;
+
+   img_file_stamp(name, default_dir, &size, &mtime);
+   img_put_string(writer, name);
+   img_put(writer, size);
+   img_put(writer, mtime);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_collect_type()
+//
+//   Number type (and its argument types, first) if it is not yet
+//   numbered. Return the number.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes writer
+//
+/----------------------------------------------------------------------*/
+
+static long img_collect_type(ImageWriter_p writer, Type_p type)
+{
+   long idx = PDArrayElementInt(writer->type_idx, type->type_uid);
+   int  i;
+
+   if(!idx)
+   {
+      for(i=0; i<type->arity; i++)
+      {
+         img_collect_type(writer, type->args[i]);
+      }
+      PStackPushP(writer->types, type);
+      idx = PStackGetSP(writer->types);
+      PDArrayAssignInt(writer->type_idx, type->type_uid, idx);
+   }
+   return idx-1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_collect_term()
+//
+//   Number the shared term and all its subterms (subterms first) and
+//   its variables, if not yet done.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes writer
+//
+/----------------------------------------------------------------------*/
+
+static void img_collect_term(ImageWriter_p writer, Term_p term)
+{
+   int i;
+
+   if(TermIsVar(term))
+   {
+      if(!PDArrayElementInt(writer->var_idx, -term->f_code))
+      {
+         img_collect_type(writer, term->type);
+         PStackPushP(writer->vars, term);
+         PDArrayAssignInt(writer->var_idx, -term->f_code,
+                          PStackGetSP(writer->vars));
+      }
+      return;
+   }
+   assert(TermIsShared(term));
+   if(PDArrayElementInt(writer->term_idx, term->entry_no))
+   {
+      return;
+   }
+   for(i=0; i<term->arity; i++)
+   {
+      img_collect_term(writer, term->args[i]);
+   }
+   img_collect_type(writer, term->type);
+   PStackPushP(writer->term_list, term);
+   PDArrayAssignInt(writer->term_idx, term->entry_no,
+                    PStackGetSP(writer->term_list));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_term_number()
+//
+//   Return the number of a collected term in the image (variables
+//   first, then proper terms).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long img_term_number(ImageWriter_p writer, Term_p term)
+{
+   if(TermIsVar(term))
+   {
+      return PDArrayElementInt(writer->var_idx, -term->f_code)-1;
+   }
+   return PStackGetSP(writer->vars)+
+      PDArrayElementInt(writer->term_idx, term->entry_no)-1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_put_element()
+//
+//   Write a single clause or formula (given by its formula term).
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void img_put_element(ImageWriter_p writer, FormulaProperties props,
+                            bool is_clause, Term_p form, ClauseInfo_p info)
+{
+   img_put(writer, props);
+   img_put(writer, is_clause);
+   img_put(writer, img_term_number(writer, form));
+   img_put(writer, info!=NULL);
+   if(info)
+   {
+      img_put_string(writer, info->name);
+      img_put_string(writer, info->source);
+      img_put(writer, info->line);
+      img_put(writer, info->column);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_corrupt()
+//
+//   Terminate with an error about a damaged image. As the checksum
+//   is checked when the image is opened, this only happens for
+//   images written by an inconsistent writer.
+//
+// Global Variables: -
+//
+// Side Effects    : Terminates program
+//
+/----------------------------------------------------------------------*/
+
+static void img_corrupt(SpecImage_p image)
+{
+   Error("%s: Axiom image is corrupted or truncated",
+         INPUT_SEMANTIC_ERROR, image->name);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_get()
+//
+//   Read the next word of the image.
+//
+// Global Variables: -
+//
+// Side Effects    : Moves read position
+//
+/----------------------------------------------------------------------*/
+
+static ImageWord img_get(SpecImage_p image)
+{
+   ImageWord res;
+
+   if(image->pos+sizeof(ImageWord) > image->size)
+   {
+      img_corrupt(image);
+   }
+   res = *(ImageWord*)(image->mem+image->pos);
+   image->pos += sizeof(ImageWord);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_get_index()
+//
+//   Read a word and check that it is in [0, limit).
+//
+// Global Variables: -
+//
+// Side Effects    : Moves read position
+//
+/----------------------------------------------------------------------*/
+
+static long img_get_index(SpecImage_p image, long limit)
+{
+   ImageWord res = img_get(image);
+
+   if(res < 0 || res >= limit)
+   {
+      img_corrupt(image);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_get_count()
+//
+//   Read a number of elements (each of which needs at least one
+//   more word).
+//
+// Global Variables: -
+//
+// Side Effects    : Moves read position
+//
+/----------------------------------------------------------------------*/
+
+static long img_get_count(SpecImage_p image)
+{
+   return img_get_index(image,
+                        (image->size-image->pos)/sizeof(ImageWord));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_get_string()
+//
+//   Read a string and return a pointer to it in the mapped image (or
+//   NULL).
+//
+// Global Variables: -
+//
+// Side Effects    : Moves read position
+//
+/----------------------------------------------------------------------*/
+
+static char* img_get_string(SpecImage_p image)
+{
+   ImageWord len = img_get(image);
+   char      *res;
+
+   if(len == -1)
+   {
+      return NULL;
+   }
+   if(len < 0 || (size_t)len >= image->size-image->pos)
+   {
+      img_corrupt(image);
+   }
+   res = image->mem+image->pos;
+   if(res[len])
+   {
+      img_corrupt(image);
+   }
+   image->pos += IMAGE_WORD_ALIGN(len+1);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_get_element()
+//
+//   Read a clause or formula, return it as a formula.
+//
+// Global Variables: -
+//
+// Side Effects    : Moves read position, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static WFormula_p img_get_element(SpecImage_p image, TB_p terms,
+                                  IntOrP *term_map, long term_no)
+{
+   FormulaProperties props;
+   bool              is_clause;
+   WFormula_p        handle;
+   char              *name, *source;
+   long              line;
+
+   props     = img_get(image);
+   is_clause = img_get(image);
+   handle    = WTFormulaAlloc(terms,
+                              term_map[img_get_index(image, term_no)].p_val);
+   handle->is_clause  = is_clause;
+   handle->properties = props;
+   if(img_get(image))
+   {
+      name   = img_get_string(image);
+      source = img_get_string(image);
+      line   = img_get(image);
+      handle->info = ClauseInfoAlloc(name, source, line, img_get(image));
+   }
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_get_files()
+//
+//   Read a list of file names onto names and their sizes and
+//   modification times onto stamps.
+//
+// Global Variables: -
+//
+// Side Effects    : Moves read position
+//
+/----------------------------------------------------------------------*/
+
+static void img_get_files(SpecImage_p image, PStack_p names,
+                          PStack_p stamps)
+{
+   long i, n = img_get_count(image);
+   char *name;
+
+   for(i=0; i<n; i++)
+   {
+      name = img_get_string(image);
+      if(!name)
+      {
+         img_corrupt(image);
+      }
+      PStackPushP(names, name);
+      PStackPushInt(stamps, img_get(image));
+      PStackPushInt(stamps, img_get(image));
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_files_unchanged()
+//
+//   Return true if all files in names still have the sizes and
+//   modification times in stamps.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool img_files_unchanged(PStack_p names, PStack_p stamps,
+                                char* default_dir)
+{
+   PStackPointer i;
+   ImageWord     size, mtime;
+
+   for(i=0; i<PStackGetSP(names); i++)
+   {
+      img_file_stamp(PStackElementP(names, i), default_dir, &size, &mtime);
+      if(size  != PStackElementInt(stamps, 2*i) ||
+         mtime != PStackElementInt(stamps, 2*i+1))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: img_header_ok()
+//
+//   Return true if mem starts with a header for the current image
+//   version on this architecture.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool img_header_ok(char* mem, size_t size)
+{
+   ImageWord *words = (ImageWord*)mem;
+
+   return size >= 3*sizeof(ImageWord) &&
+      memcmp(mem, SPEC_IMAGE_MAGIC, sizeof(ImageWord)) == 0 &&
+      words[1] == SPEC_IMAGE_VERSION &&
+      words[2] == SPEC_IMAGE_BYTE_ORDER;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: image_load()
+//
+//   Load the image as described for SpecImageLoad(). If fresh_from
+//   is non-zero, symbols of the image with an f_code above it that
+//   are Skolem symbols or definition predicates are not mapped by
+//   name, but replaced by new symbols of the same kind (in f_code
+//   order), and the Skolem and definition counters of the image are
+//   ignored. If var_map is non-NULL, it is asked for the variable
+//   to use for each variable of the image first (and may return
+//   NULL to have it mapped by f_code).
+//
+// Global Variables: problemType
+//
+// Side Effects    : Memory operations, changes signature and term
+//                   bank.
+//
+/----------------------------------------------------------------------*/
+
+static long image_load(SpecImage_p image, TB_p terms, PStack_p clause_sets,
+                       PStack_p formula_sets, StrTree_p *includes,
+                       FunCode fresh_from, ImageVarMapFun var_map,
+                       void* var_data)
+{
+   Sig_p         sig = terms->sig;
+   TypeBank_p    tbank = sig->type_bank;
+   VarBank_p     vars = terms->vars;
+   IntOrP        *tc_map, *type_map, *f_map, *term_map, dummy = {0};
+   long          tc_no, type_no, f_no, var_no, term_no, set_no;
+   long          i, j, k, count, arity, res = 0;
+   PStackPointer sp;
+   char          *name;
+   Type_p        *args, type;
+   Term_p        term, var;
+   FunCode       f, f_code;
+   ClauseSet_p   cset;
+   FormulaSet_p  fset;
+   WFormula_p    form;
+
+   if(image->problem_type != PROBLEM_NOT_INIT)
+   {
+      SetProblemType(image->problem_type);
+   }
+   if(!fresh_from)
+   {
+      sig->skolem_count  = MAX(sig->skolem_count, image->skolem_count);
+      sig->newpred_count = MAX(sig->newpred_count, image->newpred_count);
+   }
+   for(sp=0; includes && sp<PStackGetSP(image->includes); sp++)
+   {
+      name = PStackElementP(image->includes, sp);
+      if(!StrTreeFind(includes, name))
+      {
+         StrTreeStore(includes, name, dummy, dummy);
+      }
+   }
+   image->pos = image->body;
+
+   /* Types */
+   tc_no  = img_get_count(image);
+   tc_map = SecureMalloc((tc_no+1)*sizeof(IntOrP));
+   for(i=0; i<tc_no; i++)
+   {
+      name = img_get_string(image);
+      arity = img_get_index(image, LONG_MAX);
+      if(!name)
+      {
+         img_corrupt(image);
+      }
+      tc_map[i].i_val = TypeBankDefineTypeConstructor(tbank, name, arity);
+   }
+   type_no  = img_get_count(image);
+   type_map = SecureMalloc((type_no+1)*sizeof(IntOrP));
+   for(i=0; i<type_no; i++)
+   {
+      f_code = tc_map[img_get_index(image, tc_no)].i_val;
+      arity  = img_get_index(image, INT_MAX);
+      args   = TypeArgArrayAlloc(arity);
+      for(j=0; j<arity; j++)
+      {
+         args[j] = type_map[img_get_index(image, i)].p_val;
+      }
+      type_map[i].p_val = TypeBankInsertTypeShared(tbank,
+                                                   TypeAlloc(f_code, arity, args));
+   }
+
+   /* Signature */
+   f_no  = img_get_count(image);
+   f_map = SecureMalloc((f_no+1)*sizeof(IntOrP));
+   f_map[0].i_val = 0;
+   for(f=1; f<=f_no; f++)
+   {
+      name  = img_get_string(image);
+      arity = img_get_index(image, INT_MAX);
+      k     = img_get(image);
+      j     = img_get(image);
+      if(!name || j < -1 || j >= type_no)
+      {
+         img_corrupt(image);
+      }
+      if(fresh_from && f > fresh_from && (k&FPSkolemSymbol))
+      {
+         f_code = SigGetNewSkolemCode(sig, arity);
+      }
+      else if(fresh_from && f > fresh_from && (k&FPDefPred))
+      {
+         f_code = SigGetNewPredicateCode(sig, arity);
+      }
+      else
+      {
+         f_code = SigInsertId(sig, name, arity, k&FPSpecial);
+      }
+      if(!f_code)
+      {
+         Error("%s: Symbol %s/%ld conflicts with a symbol of different arity",
+               INPUT_SEMANTIC_ERROR, image->name, name, arity);
+      }
+      SigSetFuncProp(sig, f_code, (FunctionProperties)k&~FPOpFlag);
+      type = (j==-1)?NULL:type_map[j].p_val;
+      if(type && SigGetType(sig, f_code) != type)
+      {
+         SigDeclareType(sig, f_code, type);
+      }
+      f_map[f].i_val = f_code;
+   }
+
+   /* Variables and terms. Variables that already exist with a
+      different type are replaced by unused ones. */
+   var_no   = img_get_count(image);
+   term_map = SecureMalloc((var_no+1)*sizeof(IntOrP));
+   for(i=0; i<var_no; i++)
+   {
+      f_code = img_get(image);
+      type   = type_map[img_get_index(image, type_no)].p_val;
+      if(f_code >= 0)
+      {
+         img_corrupt(image);
+      }
+      if(var_map && (var = var_map(var_data, f_code, type)))
+      {
+         term_map[i].p_val = var;
+         continue;
+      }
+      var = PDArrayElementP(vars->variables, -f_code);
+      if(var && var->type != type)
+      {
+         do
+         {
+            vars->fresh_count += 2;
+         }while(PDArrayElementP(vars->variables, vars->fresh_count));
+         f_code = -vars->fresh_count;
+      }
+      term_map[i].p_val = VarBankVarAssertAlloc(vars, f_code, type);
+      /* Keep VarBankGetFreshVar() from handing out loaded variables */
+      if(-f_code > vars->fresh_count)
+      {
+         vars->fresh_count = -f_code + ((-f_code)%2);
+         if(vars->shadow)
+         {
+            vars->shadow->fresh_count = vars->fresh_count;
+         }
+      }
+   }
+   term_no  = img_get_count(image)+var_no;
+   term_map = SecureRealloc(term_map, (term_no+1)*sizeof(IntOrP));
+   for(i=var_no; i<term_no; i++)
+   {
+      f_code = f_map[img_get_index(image, f_no+1)].i_val;
+      type   = type_map[img_get_index(image, type_no)].p_val;
+      k      = img_get(image);
+      arity  = img_get_index(image, INT_MAX);
+      term   = TermTopAlloc(f_code, arity);
+      term->type       = type;
+      term->properties = (TermProperties)k&TPPredPos;
+      for(j=0; j<arity; j++)
+      {
+         term->args[j] = term_map[img_get_index(image, i)].p_val;
+      }
+      term_map[i].p_val = TBTermTopInsert(terms, term);
+   }
+
+   /* Clause and formula sets */
+   set_no = img_get_count(image);
+   for(i=0; i<set_no; i++)
+   {
+      cset = ClauseSetAlloc();
+      name = img_get_string(image);
+      DStrAppendStr(cset->identifier, name?name:"");
+      count = img_get_count(image);
+      for(j=0; j<count; j++)
+      {
+         form = img_get_element(image, terms, term_map, term_no);
+         ClauseSetInsert(cset, WFormClauseToClause(form));
+         WFormulaFree(form);
+      }
+      res += count;
+      fset = FormulaSetAlloc();
+      name = img_get_string(image);
+      DStrAppendStr(fset->identifier, name?name:"");
+      count = img_get_count(image);
+      for(j=0; j<count; j++)
+      {
+         FormulaSetInsert(fset, img_get_element(image, terms,
+                                                term_map, term_no));
+      }
+      res += count;
+      PStackPushP(clause_sets, cset);
+      PStackPushP(formula_sets, fset);
+   }
+   if(img_get(image) != SPEC_IMAGE_END_MARK)
+   {
+      img_corrupt(image);
+   }
+
+   FREE(term_map);
+   FREE(f_map);
+   FREE(type_map);
+   FREE(tc_map);
+
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: SpecImageSave()
+//
+//   Write an image of the given (pairwise corresponding) clause and
+//   formula sets in terms to the file name. sources are the file
+//   names the sets were created from, includes all include files
+//   parsed for them (may be NULL). Size and modification time of
+//   all these files (found relative to default_dir, see
+//   img_file_stamp()) are stored with the names, so that images of
+//   changed files are recognized. The file is written under a
+//   temporary name and renamed when complete, so that readers never
+//   see a partial image.
+//
+// Global Variables: problemType
+//
+// Side Effects    : Output, clauses are encoded as formula terms in
+//                   terms.
+//
+/----------------------------------------------------------------------*/
+
+void SpecImageSave(char* name, TB_p terms, PStack_p clause_sets,
+                   PStack_p formula_sets, PStack_p sources,
+                   StrTree_p includes, char* default_dir)
+{
+   ImageWriterCell writer;
+   Sig_p           sig = terms->sig;
+   TypeBank_p      tbank = sig->type_bank;
+   DStr_p          tmp_name = DStrAlloc();
+   PStackPointer   i, j;
+   ClauseSet_p     cset;
+   FormulaSet_p    fset;
+   Clause_p        clause;
+   WFormula_p      form;
+   Type_p          type;
+   Term_p          term;
+   PStack_p        trav;
+   StrTree_p       cell;
+   FunCode         f;
+   long            count;
+   ImageWord       word;
+
+   assert(PStackGetSP(clause_sets) == PStackGetSP(formula_sets));
+
+   writer.type_idx  = PDArrayAlloc(64, 0);
+   writer.types     = PStackAlloc();
+   writer.var_idx   = PDArrayAlloc(64, 0);
+   writer.vars      = PStackAlloc();
+   writer.term_idx  = PDArrayAlloc(terms->in_count+1, 0);
+   writer.term_list = PStackAlloc();
+   writer.encoded   = PStackAlloc();
+
+   /* Collect everything that needs to be written */
+   for(f=1; f<=sig->f_count; f++)
+   {
+      if(SigGetType(sig, f))
+      {
+         img_collect_type(&writer, SigGetType(sig, f));
+      }
+   }
+   for(i=0; i<PStackGetSP(clause_sets); i++)
+   {
+      cset = PStackElementP(clause_sets, i);
+      for(clause = cset->anchor->succ; clause!=cset->anchor;
+          clause = clause->succ)
+      {
+         term = TFormulaClauseEncode(terms, clause);
+         PStackPushP(writer.encoded, term);
+         img_collect_term(&writer, term);
+      }
+      fset = PStackElementP(formula_sets, i);
+      for(form = fset->anchor->succ; form!=fset->anchor; form = form->succ)
+      {
+         img_collect_term(&writer, form->tformula);
+      }
+   }
+
+   DStrAppendStr(tmp_name, name);
+   DStrAppendStr(tmp_name, ".tmp");
+   writer.out = SecureFOpen(DStrView(tmp_name), "w");
+
+   writer.checksum = IMAGE_CHECKSUM_INIT;
+
+   /* Header */
+   memcpy(&word, SPEC_IMAGE_MAGIC, sizeof(ImageWord));
+   img_put(&writer, word);
+   img_put(&writer, SPEC_IMAGE_VERSION);
+   img_put(&writer, SPEC_IMAGE_BYTE_ORDER);
+   img_put(&writer, problemType);
+   img_put(&writer, sig->skolem_count);
+   img_put(&writer, sig->newpred_count);
+
+   /* Sources and includes */
+   img_put(&writer, sources?PStackGetSP(sources):0);
+   for(i=0; sources && i<PStackGetSP(sources); i++)
+   {
+      img_put_file(&writer, PStackElementP(sources, i), default_dir);
+   }
+   count = 0;
+   trav = StrTreeTraverseInit(includes);
+   while((cell = StrTreeTraverseNext(trav)))
+   {
+      count++;
+   }
+   StrTreeTraverseExit(trav);
+   img_put(&writer, count);
+   trav = StrTreeTraverseInit(includes);
+   while((cell = StrTreeTraverseNext(trav)))
+   {
+      img_put_file(&writer, cell->key, default_dir);
+   }
+   StrTreeTraverseExit(trav);
+
+   /* Types */
+   img_put(&writer, tbank->names_count);
+   for(i=0; i<tbank->names_count; i++)
+   {
+      img_put_string(&writer, (char*)TypeBankFindTCName(tbank, i));
+      img_put(&writer, TypeBankFindTCArity(tbank, i));
+   }
+   img_put(&writer, PStackGetSP(writer.types));
+   for(i=0; i<PStackGetSP(writer.types); i++)
+   {
+      type = PStackElementP(writer.types, i);
+      img_put(&writer, type->f_code);
+      img_put(&writer, type->arity);
+      for(j=0; j<type->arity; j++)
+      {
+         img_put(&writer,
+                 PDArrayElementInt(writer.type_idx, type->args[j]->type_uid)-1);
+      }
+   }
+
+   /* Signature */
+   img_put(&writer, sig->f_count);
+   for(f=1; f<=sig->f_count; f++)
+   {
+      img_put_string(&writer, SigFindName(sig, f));
+      img_put(&writer, SigFindArity(sig, f));
+      img_put(&writer, sig->f_info[f].properties);
+      type = SigGetType(sig, f);
+      img_put(&writer,
+              type?PDArrayElementInt(writer.type_idx, type->type_uid)-1:-1);
+   }
+
+   /* Variables and terms */
+   img_put(&writer, PStackGetSP(writer.vars));
+   for(i=0; i<PStackGetSP(writer.vars); i++)
+   {
+      term = PStackElementP(writer.vars, i);
+      img_put(&writer, term->f_code);
+      img_put(&writer, PDArrayElementInt(writer.type_idx,
+                                            term->type->type_uid)-1);
+   }
+   img_put(&writer, PStackGetSP(writer.term_list));
+   for(i=0; i<PStackGetSP(writer.term_list); i++)
+   {
+      term = PStackElementP(writer.term_list, i);
+      img_put(&writer, term->f_code);
+      img_put(&writer, PDArrayElementInt(writer.type_idx,
+                                            term->type->type_uid)-1);
+      img_put(&writer, TermCellQueryProp(term, TPPredPos)?TPPredPos:0);
+      img_put(&writer, term->arity);
+      for(j=0; j<term->arity; j++)
+      {
+         img_put(&writer, img_term_number(&writer, term->args[j]));
+      }
+   }
+
+   /* Clause and formula sets */
+   img_put(&writer, PStackGetSP(clause_sets));
+   count = 0;
+   for(i=0; i<PStackGetSP(clause_sets); i++)
+   {
+      cset = PStackElementP(clause_sets, i);
+      img_put_string(&writer, DStrView(cset->identifier));
+      img_put(&writer, ClauseSetCardinality(cset));
+      for(clause = cset->anchor->succ; clause!=cset->anchor;
+          clause = clause->succ)
+      {
+         img_put_element(&writer, clause->properties, true,
+                         PStackElementP(writer.encoded, count++),
+                         clause->info);
+      }
+      fset = PStackElementP(formula_sets, i);
+      img_put_string(&writer, DStrView(fset->identifier));
+      img_put(&writer, FormulaSetCardinality(fset));
+      for(form = fset->anchor->succ; form!=fset->anchor; form = form->succ)
+      {
+         img_put_element(&writer, form->properties, form->is_clause,
+                         form->tformula, form->info);
+      }
+   }
+   img_put(&writer, SPEC_IMAGE_END_MARK);
+   fwrite(&writer.checksum, sizeof(ImageWord), 1, writer.out);
+
+   if(ferror(writer.out))
+   {
+      SysError("Cannot write axiom image %s", FILE_ERROR,
+               DStrView(tmp_name));
+   }
+   SecureFClose(writer.out);
+   if(rename(DStrView(tmp_name), name) == -1)
+   {
+      SysError("Cannot rename %s to %s", FILE_ERROR,
+               DStrView(tmp_name), name);
+   }
+
+   DStrFree(tmp_name);
+   PStackFree(writer.encoded);
+   PStackFree(writer.term_list);
+   PDArrayFree(writer.term_idx);
+   PStackFree(writer.vars);
+   PDArrayFree(writer.var_idx);
+   PStackFree(writer.types);
+   PDArrayFree(writer.type_idx);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SpecImageFileIsImage()
+//
+//   Return true if the file name exists and is an image of the
+//   current format version for this architecture.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O
+//
+/----------------------------------------------------------------------*/
+
+bool SpecImageFileIsImage(char* name)
+{
+   char   header[3*sizeof(ImageWord)];
+   FILE*  in;
+   size_t read;
+
+   in = fopen(name, "r");
+   if(!in)
+   {
+      return false;
+   }
+   read = fread(header, 1, sizeof(header), in);
+   fclose(in);
+
+   return img_header_ok(header, read);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SpecImageOpen()
+//
+//   Map the image file name into memory, check it, and read the
+//   header and the file lists. If the file cannot be read, is not an
+//   image of the current version, or is truncated or damaged (wrong
+//   checksum), print a warning and return NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O, memory operations
+//
+/----------------------------------------------------------------------*/
+
+SpecImage_p SpecImageOpen(char* name)
+{
+   SpecImage_p handle;
+   struct stat stat_buf;
+   int         fd;
+   void        *mem;
+   ImageWord   *words;
+   size_t      i, word_no;
+   uint64_t    checksum = IMAGE_CHECKSUM_INIT;
+
+   fd = open(name, O_RDONLY);
+   if(fd == -1 || fstat(fd, &stat_buf) == -1)
+   {
+      SysWarning("Cannot open axiom image %s", name);
+      if(fd != -1)
+      {
+         close(fd);
+      }
+      return NULL;
+   }
+   mem = mmap(NULL, MAX(stat_buf.st_size, 1), PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if(mem == MAP_FAILED)
+   {
+      SysWarning("Cannot map axiom image %s", name);
+      return NULL;
+   }
+   if(!img_header_ok(mem, stat_buf.st_size))
+   {
+      Warning("%s: Not an axiom image of version %d for this architecture",
+              name, SPEC_IMAGE_VERSION);
+      munmap(mem, MAX(stat_buf.st_size, 1));
+      return NULL;
+   }
+   words   = mem;
+   word_no = stat_buf.st_size/sizeof(ImageWord);
+   for(i=0; i+1<word_no; i++)
+   {
+      checksum = IMAGE_CHECKSUM_STEP(checksum, words[i]);
+   }
+   if(stat_buf.st_size%sizeof(ImageWord) ||
+      words[word_no-2] != SPEC_IMAGE_END_MARK ||
+      (uint64_t)words[word_no-1] != checksum)
+   {
+      Warning("%s: Axiom image is corrupted or truncated", name);
+      munmap(mem, MAX(stat_buf.st_size, 1));
+      return NULL;
+   }
+
+   handle = SpecImageCellAlloc();
+   handle->name     = SecureStrdup(name);
+   handle->mem      = mem;
+   handle->size     = stat_buf.st_size-sizeof(ImageWord);
+   handle->sources  = PStackAlloc();
+   handle->source_stamps  = PStackAlloc();
+   handle->includes = PStackAlloc();
+   handle->include_stamps = PStackAlloc();
+
+   handle->pos           = 3*sizeof(ImageWord);
+   handle->problem_type  = img_get(handle);
+   handle->skolem_count  = img_get(handle);
+   handle->newpred_count = img_get(handle);
+   img_get_files(handle, handle->sources, handle->source_stamps);
+   img_get_files(handle, handle->includes, handle->include_stamps);
+   handle->body = handle->pos;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SpecImageClose()
+//
+//   Unmap and free an image. Data loaded from it is independent of
+//   the image.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SpecImageClose(SpecImage_p image)
+{
+   munmap(image->mem, image->size+sizeof(ImageWord));
+   PStackFree(image->sources);
+   PStackFree(image->source_stamps);
+   PStackFree(image->includes);
+   PStackFree(image->include_stamps);
+   FREE(image->name);
+   SpecImageCellFree(image);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SpecImageMatchesSources()
+//
+//   Return true if the image was created from exactly the files in
+//   sources (in any order), and none of these files and of the
+//   include files parsed for the image has changed since (size or
+//   modification time, with names resolved relative to default_dir
+//   as when the image was written).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool SpecImageMatchesSources(SpecImage_p image, PStack_p sources,
+                             char* default_dir)
+{
+   PStackPointer i, j;
+
+   if(PStackGetSP(image->sources) != PStackGetSP(sources))
+   {
+      return false;
+   }
+   for(i=0; i<PStackGetSP(sources); i++)
+   {
+      for(j=0; j<PStackGetSP(image->sources); j++)
+      {
+         if(strcmp(PStackElementP(sources, i),
+                   PStackElementP(image->sources, j)) == 0)
+         {
+            break;
+         }
+      }
+      if(j == PStackGetSP(image->sources))
+      {
+         return false;
+      }
+   }
+   return img_files_unchanged(image->sources, image->source_stamps,
+                              default_dir) &&
+      img_files_unchanged(image->includes, image->include_stamps,
+                          default_dir);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SpecImageLoad()
+//
+//   Insert the contents of the image into terms (and its signature)
+//   and push the clause and formula sets onto the two stacks. Add
+//   the names of the parsed include files to includes (if
+//   non-NULL). Return the number of clauses and formulas loaded.
+//
+// Global Variables: problemType
+//
+// Side Effects    : Memory operations, changes signature and term
+//                   bank.
+//
+/----------------------------------------------------------------------*/
+
+long SpecImageLoad(SpecImage_p image, TB_p terms, PStack_p clause_sets,
+                   PStack_p formula_sets, StrTree_p *includes)
+{
+   return image_load(image, terms, clause_sets, formula_sets, includes, 0,
+                     NULL, NULL);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SpecImageLoadMapped()
+//
+//   As SpecImageLoad(), for an image written by a process forked
+//   from this one when the signature of terms had fresh_from symbols
+//   (or 0, if all symbols are to be mapped by name): Skolem symbols
+//   and definition predicates the process introduced are renamed to
+//   new symbols of terms, so that images of several such processes
+//   can be loaded one after the other. Variables are mapped by
+//   var_map (called with var_data, the f_code and the type of each
+//   variable of the image), or, where it returns NULL (or is NULL),
+//   by f_code.
+//
+// Global Variables: problemType
+//
+// Side Effects    : Memory operations, changes signature and term
+//                   bank.
+//
+/----------------------------------------------------------------------*/
+
+long SpecImageLoadMapped(SpecImage_p image, TB_p terms,
+                         PStack_p clause_sets, PStack_p formula_sets,
+                         StrTree_p *includes, FunCode fresh_from,
+                         ImageVarMapFun var_map, void* var_data)
+{
+   return image_load(image, terms, clause_sets, formula_sets, includes,
+                     fresh_from, var_map, var_data);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StructFOFSpecSaveImage()
+//
+//   Write an image of the shared axioms of ctrl (the sets below
+//   ctrl->shared_ax_sp), created from the files in sources (relative
+//   to default_dir), to the file name.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void StructFOFSpecSaveImage(StructFOFSpec_p ctrl, char* name,
+                            PStack_p sources, char* default_dir)
+{
+   PStack_p      csets = PStackAlloc(), fsets = PStackAlloc();
+   PStackPointer i;
+
+   for(i=0; i<ctrl->shared_ax_sp; i++)
+   {
+      PStackPushP(csets, PStackElementP(ctrl->clause_sets, i));
+      PStackPushP(fsets, PStackElementP(ctrl->formula_sets, i));
+   }
+   SpecImageSave(name, ctrl->terms, csets, fsets, sources,
+                 ctrl->parsed_includes, default_dir);
+   PStackFree(fsets);
+   PStackFree(csets);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StructFOFSpecLoadImage()
+//
+//   Add the axiom sets of an image to ctrl as shared axioms (include
+//   files covered by the image will not be parsed again). Return the
+//   number of clauses and formulas loaded.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes ctrl
+//
+/----------------------------------------------------------------------*/
+
+long StructFOFSpecLoadImage(StructFOFSpec_p ctrl, SpecImage_p image)
+{
+   long res;
+
+   assert(ctrl->shared_ax_sp == PStackGetSP(ctrl->clause_sets));
+
+   res = SpecImageLoad(image, ctrl->terms, ctrl->clause_sets,
+                       ctrl->formula_sets, &(ctrl->parsed_includes));
+   ctrl->shared_ax_sp = PStackGetSP(ctrl->clause_sets);
+
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,130 @@
+/*-----------------------------------------------------------------------
+
+File  : cco_spec_image.h
+
+Author: agent (agent@local)
+
+Contents
+
+  Persistent binary images of parsed axiom sets (in particular of
+  the shared part of a StructFOFSpec), so that large axiom libraries
+  need not be scanned and parsed again on every start.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Sat Oct 17 2026
+    New
+<2> Sat Oct 17 2026
+    Version 2: File sizes and modification times, checksum
+<3> Sat Oct 17 2026
+    SpecImageLoadMapped()
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCO_SPEC_IMAGE
+
+#define CCO_SPEC_IMAGE
+
+#include <cco_sine.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* An image is a flat sequence of 64 bit words in host byte order
+   (images are not portable between architectures, but this is
+   detected). All strings are stored NUL-terminated and padded to
+   full words, so that they can be used in place in the mapped
+   file. Sections, in this order:
+
+   - Header: Magic, version, byte order mark, problem type, Skolem
+     and definition counters of the signature
+   - Names of the source files the image was created from, each
+     with file size and modification time (-1 if not found)
+   - Names of all include files parsed for it, with size and time
+   - Type constructors (name, arity)
+   - Types (constructor, arity, argument types), arguments first
+   - Signature (name, arity, properties, type) for all f_codes
+   - Variables (f_code, type)
+   - Shared terms (f_code, type, properties, arity, arguments),
+     subterms first. Terms are numbered after the variables.
+   - Clause and formula sets (identifier and elements). Each element
+     is stored as a formula term (clauses in their formula encoding)
+     with properties and ClauseInfo.
+   - End mark
+   - Checksum of all preceding words
+
+   On loading, all symbols, types and variables are mapped into the
+   target signature and term bank by name, so that an image can be
+   loaded into a bank that already contains other terms. */
+
+#define SPEC_IMAGE_MAGIC      "EIMAGE\0\0"
+#define SPEC_IMAGE_VERSION    2
+#define SPEC_IMAGE_BYTE_ORDER 0x0102030405060708LL
+#define SPEC_IMAGE_END_MARK   0x454e44454e44454eLL
+
+typedef int64_t ImageWord;
+
+typedef struct spec_image_cell
+{
+   char      *name;      /* File name */
+   char      *mem;       /* Mapped file */
+   size_t    size;       /* Without the checksum */
+   size_t    pos;        /* Read position, in bytes */
+   size_t    body;       /* Start of the type section */
+   long      problem_type;
+   long      skolem_count;
+   long      newpred_count;
+   PStack_p  sources;    /* char*, pointing into mem */
+   PStack_p  source_stamps;  /* Size and mtime of each source */
+   PStack_p  includes;   /* char*, pointing into mem */
+   PStack_p  include_stamps; /* Size and mtime of each include */
+}SpecImageCell, *SpecImage_p;
+
+/* Used to map the variables of an image when loading it (see
+   SpecImageLoadMapped()) */
+
+typedef Term_p (*ImageVarMapFun)(void* data, FunCode f_code, Type_p type);
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define SpecImageCellAlloc()    (SpecImageCell*)SizeMalloc(sizeof(SpecImageCell))
+#define SpecImageCellFree(junk) SizeFree(junk, sizeof(SpecImageCell))
+
+void        SpecImageSave(char* name, TB_p terms, PStack_p clause_sets,
+                          PStack_p formula_sets, PStack_p sources,
+                          StrTree_p includes, char* default_dir);
+
+bool        SpecImageFileIsImage(char* name);
+SpecImage_p SpecImageOpen(char* name);
+void        SpecImageClose(SpecImage_p image);
+bool        SpecImageMatchesSources(SpecImage_p image, PStack_p sources,
+                                    char* default_dir);
+long        SpecImageLoad(SpecImage_p image, TB_p terms,
+                          PStack_p clause_sets, PStack_p formula_sets,
+                          StrTree_p *includes);
+long        SpecImageLoadMapped(SpecImage_p image, TB_p terms,
+                                PStack_p clause_sets,
+                                PStack_p formula_sets,
+                                StrTree_p *includes, FunCode fresh_from,
+                                ImageVarMapFun var_map, void* var_data);
+
+void        StructFOFSpecSaveImage(StructFOFSpec_p ctrl, char* name,
+                                   PStack_p sources, char* default_dir);
+long        StructFOFSpecLoadImage(StructFOFSpec_p ctrl, SpecImage_p image);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
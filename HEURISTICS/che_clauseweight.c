@@ -18,6 +18,8 @@ Changes
 
 <1> Fri Jun  5 22:51:52 MET DST 1998
     New
+<2> Sat Oct 17 2026
+    Batch evaluation for ClauseWeight
 
 -----------------------------------------------------------------------*/
 
@@ -113,14 +115,18 @@ WFCB_p ClauseWeightInit(ClausePrioFun prio_fun, int fweight, int
          vweight, double pos_multiplier, double app_var_mult)
 {
    WeightParam_p data = WeightParamCellAlloc();
+   WFCB_p        res;
 
    data->fweight                = fweight;
    data->vweight                = vweight;
    data->pos_multiplier         = pos_multiplier;
    data->app_var_mult           = app_var_mult;
 
-   return WFCBAlloc(ClauseWeightCompute, prio_fun,
-          ClauseWeightExit, data);
+   res = WFCBAlloc(ClauseWeightCompute, prio_fun,
+                   ClauseWeightExit, data);
+
+   res->wfcb_batch_eval = ClauseWeightBatchCompute;
+   return res;
 }
 
 
@@ -185,6 +191,31 @@ double ClauseWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseWeightBatchCompute()
+//
+//   Compute evaluations for all clauses in batch.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void ClauseWeightBatchCompute(void* data, ClauseEvalBatch_p batch)
+{
+   WeightParam_p local = data;
+
+   ClauseEvalBatchWeight(batch, 1, 1,
+                         local->pos_multiplier,
+                         local->vweight,
+                         local->fweight,
+                         local->app_var_mult,
+                         false);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: LMaxWeightInit()
@@ -60,6 +60,7 @@ WFCB_p ClauseWeightInit(ClausePrioFun prio_fun, int fweight, int
 WFCB_p ClauseWeightParse(Scanner_p in, OCB_p ocb, ProofState_p state);
 
 double ClauseWeightCompute(void* data, Clause_p clause);
+void   ClauseWeightBatchCompute(void* data, ClauseEvalBatch_p batch);
 
 WFCB_p LMaxWeightInit(ClausePrioFun prio_fun, int fweight, int
              vweight, double pos_multiplier, double app_var_mult);
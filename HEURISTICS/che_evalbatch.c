@@ -0,0 +1,394 @@
+/*-----------------------------------------------------------------------
+
+  File  : che_evalbatch.c
+
+  Author: agent (agent@local)
+
+  Contents
+
+  Batches of clauses to be evaluated together.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Changes
+
+  <1> Sat Oct 17 2026
+      New
+
+  -----------------------------------------------------------------------*/
+
+#include "che_evalbatch.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+#define EVAL_BATCH_INIT_CLAUSES  64
+#define EVAL_BATCH_INIT_LITS    256
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: batch_grow_clauses()
+//
+//   Make room for at least one more clause in the batch.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void batch_grow_clauses(ClauseEvalBatch_p batch)
+{
+   long size = batch->clause_size*2;
+
+   batch->clauses   = SecureRealloc(batch->clauses, size*sizeof(Clause_p));
+   batch->empty     = SecureRealloc(batch->empty, size*sizeof(bool));
+   batch->oriented  = SecureRealloc(batch->oriented, size*sizeof(bool));
+   batch->lit_start = SecureRealloc(batch->lit_start, (size+1)*sizeof(long));
+   batch->res       = SecureRealloc(batch->res, size*sizeof(double));
+   batch->clause_size = size;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: batch_grow_lits()
+//
+//   Make room for at least lits more literals in the batch.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void batch_grow_lits(ClauseEvalBatch_p batch, long lits)
+{
+   long size = batch->lit_size;
+
+   while(batch->lit_no+lits > size)
+   {
+      size *= 2;
+   }
+   batch->lterm_vars = SecureRealloc(batch->lterm_vars, size*sizeof(long));
+   batch->lterm_funs = SecureRealloc(batch->lterm_funs, size*sizeof(long));
+   batch->rterm_vars = SecureRealloc(batch->rterm_vars, size*sizeof(long));
+   batch->rterm_funs = SecureRealloc(batch->rterm_funs, size*sizeof(long));
+   batch->lit_props  = SecureRealloc(batch->lit_props, size);
+   batch->lit_size   = size;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lit_props()
+//
+//   Return the batch properties of a literal.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static unsigned char lit_props(Eqn_p lit)
+{
+   unsigned char res = EBNoProps;
+
+   if(EqnIsEquLit(lit))
+   {
+      res |= EBEquLit;
+   }
+   if(EqnIsOriented(lit))
+   {
+      res |= EBOriented;
+   }
+   if(EqnIsMaximal(lit))
+   {
+      res |= EBMaximal;
+   }
+   if(EqnIsPositive(lit))
+   {
+      res |= EBPositive;
+   }
+   if(TermIsAppliedVar(lit->lterm))
+   {
+      res |= EBLAppVar;
+   }
+   if(TermIsAppliedVar(lit->rterm))
+   {
+      res |= EBRAppVar;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: batch_sync_props()
+//
+//   Recompute the literal properties of all clauses in the batch
+//   whose maximal terms have been marked (by any weight function)
+//   since the properties were taken. Marking is the only operation
+//   that changes the properties during evaluation.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void batch_sync_props(ClauseEvalBatch_p batch)
+{
+   long  i, l;
+   Eqn_p lit;
+
+   for(i=0; i<batch->clause_no; i++)
+   {
+      if(!batch->oriented[i] &&
+         ClauseQueryProp(batch->clauses[i], CPIsOriented))
+      {
+         l = batch->lit_start[i];
+         for(lit = batch->clauses[i]->literals; lit; lit = lit->next)
+         {
+            batch->lit_props[l++] = lit_props(lit);
+         }
+         batch->oriented[i] = true;
+      }
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseEvalBatchAlloc()
+//
+//   Return an empty batch.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+ClauseEvalBatch_p ClauseEvalBatchAlloc(void)
+{
+   ClauseEvalBatch_p handle = ClauseEvalBatchCellAlloc();
+   long c = EVAL_BATCH_INIT_CLAUSES, l = EVAL_BATCH_INIT_LITS;
+
+   handle->clause_size = c;
+   handle->clauses     = SecureMalloc(c*sizeof(Clause_p));
+   handle->empty       = SecureMalloc(c*sizeof(bool));
+   handle->oriented    = SecureMalloc(c*sizeof(bool));
+   handle->lit_start   = SecureMalloc((c+1)*sizeof(long));
+   handle->res         = SecureMalloc(c*sizeof(double));
+   handle->lit_size    = l;
+   handle->lterm_vars  = SecureMalloc(l*sizeof(long));
+   handle->lterm_funs  = SecureMalloc(l*sizeof(long));
+   handle->rterm_vars  = SecureMalloc(l*sizeof(long));
+   handle->rterm_funs  = SecureMalloc(l*sizeof(long));
+   handle->lit_props   = SecureMalloc(l);
+   ClauseEvalBatchReset(handle);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseEvalBatchFree()
+//
+//   Free a batch (but not the clauses in it).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseEvalBatchFree(ClauseEvalBatch_p junk)
+{
+   FREE(junk->clauses);
+   FREE(junk->empty);
+   FREE(junk->oriented);
+   FREE(junk->lit_start);
+   FREE(junk->res);
+   FREE(junk->lterm_vars);
+   FREE(junk->lterm_funs);
+   FREE(junk->rterm_vars);
+   FREE(junk->rterm_funs);
+   FREE(junk->lit_props);
+   ClauseEvalBatchCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseEvalBatchAddClause()
+//
+//   Append a clause to the batch and extract its features.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ClauseEvalBatchAddClause(ClauseEvalBatch_p batch, Clause_p clause)
+{
+   long  i = batch->clause_no, l;
+   Eqn_p lit;
+
+   if(i == batch->clause_size)
+   {
+      batch_grow_clauses(batch);
+   }
+   if(batch->lit_no+ClauseLiteralNumber(clause) > batch->lit_size)
+   {
+      batch_grow_lits(batch, ClauseLiteralNumber(clause));
+   }
+   batch->clauses[i] = clause;
+   batch->empty[i]   = ClauseIsSemFalse(clause);
+   batch->oriented[i] = ClauseQueryProp(clause, CPIsOriented);
+
+   l = batch->lit_no;
+   for(lit = clause->literals; lit; lit = lit->next)
+   {
+      batch->lterm_vars[l] = TermWeight(lit->lterm, 1, 0);
+      batch->lterm_funs[l] = TermWeight(lit->lterm, 0, 1);
+      batch->rterm_vars[l] = TermWeight(lit->rterm, 1, 0);
+      batch->rterm_funs[l] = TermWeight(lit->rterm, 0, 1);
+      batch->lit_props[l]  = lit_props(lit);
+      l++;
+   }
+   batch->lit_no = l;
+   batch->clause_no++;
+   batch->lit_start[batch->clause_no] = l;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseEvalBatchMarkMaximalTerms()
+//
+//   Mark the maximal terms and literals of all clauses in the batch
+//   that are not yet marked (as ClauseCondMarkMaximalTerms()).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the clauses
+//
+/----------------------------------------------------------------------*/
+
+void ClauseEvalBatchMarkMaximalTerms(ClauseEvalBatch_p batch, OCB_p ocb)
+{
+   long i;
+
+   for(i=0; i<batch->clause_no; i++)
+   {
+      ClauseCondMarkMaximalTerms(ocb, batch->clauses[i]);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseEvalBatchWeight()
+//
+//   Compute ClauseWeight() with the given parameters for all clauses
+//   in the batch and store the results in batch->res. The arithmetic
+//   is the same as in LiteralWeight(), so that the results are
+//   identical.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void ClauseEvalBatchWeight(ClauseEvalBatch_p batch,
+                           double max_term_multiplier,
+                           double max_literal_multiplier,
+                           double pos_multiplier,
+                           long vweight, long fweight,
+                           double app_var_mult,
+                           bool count_eq_encoding)
+{
+   long          i, l, end;
+   unsigned char props;
+   double        res, lit_res, lweight, rweight;
+
+   batch_sync_props(batch);
+   for(i=0; i<batch->clause_no; i++)
+   {
+      res = 0;
+      end = batch->lit_start[i+1];
+      for(l=batch->lit_start[i]; l<end; l++)
+      {
+         props   = batch->lit_props[l];
+         lweight = (double)(batch->lterm_vars[l]*vweight+
+                            batch->lterm_funs[l]*fweight);
+         rweight = (double)(batch->rterm_vars[l]*vweight+
+                            batch->rterm_funs[l]*fweight);
+         if(count_eq_encoding || (props & EBEquLit))
+         {
+            lit_res = (props & EBOriented)?
+               rweight:rweight*max_term_multiplier;
+            if(!count_eq_encoding)
+            {
+               lit_res += fweight; /* Count the equal-predicate */
+            }
+            if(props & EBRAppVar)
+            {
+               lit_res = lit_res*app_var_mult;
+            }
+         }
+         else
+         {
+            lit_res = 0;
+         }
+         lweight = lweight*max_term_multiplier;
+         if(props & EBLAppVar)
+         {
+            lweight = lweight*app_var_mult;
+         }
+         lit_res += lweight;
+         if(props & EBMaximal)
+         {
+            lit_res = lit_res*max_literal_multiplier;
+         }
+         if(props & EBPositive)
+         {
+            lit_res = lit_res*pos_multiplier;
+         }
+         res += lit_res;
+      }
+      batch->res[i] = res;
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,109 @@
+/*-----------------------------------------------------------------------
+
+  File  : che_evalbatch.h
+
+  Author: agent (agent@local)
+
+  Contents
+
+  Batches of clauses to be evaluated together. The features most
+  weight functions need (term sizes and literal properties) are
+  extracted once per clause into flat per-literal arrays, so that
+  weight functions that support batches can evaluate all clauses
+  with a simple loop, without chasing literal and term pointers
+  again for every weight function.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+  Changes
+
+  <1> Sat Oct 17 2026
+      New
+
+  -----------------------------------------------------------------------*/
+
+#ifndef CHE_EVALBATCH
+
+#define CHE_EVALBATCH
+
+#include <ccl_clauses.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Literal properties stored in the batch */
+
+typedef enum
+{
+   EBNoProps   =  0,
+   EBEquLit    =  1, /* EqnIsEquLit() */
+   EBOriented  =  2, /* EqnIsOriented() */
+   EBMaximal   =  4, /* EqnIsMaximal() */
+   EBPositive  =  8, /* EqnIsPositive() */
+   EBLAppVar   = 16, /* lterm is an applied variable */
+   EBRAppVar   = 32  /* rterm is an applied variable */
+}EvalBatchLitProps;
+
+
+/* Clauses and their features, stored as parallel arrays. The
+   literals of clause i are lit_start[i]...lit_start[i+1]-1. Term
+   sizes are numbers of variables and of (non-variable) function
+   symbols, so that TermWeight(t, vweight, fweight) is
+   vars*vweight+funs*fweight. */
+
+typedef struct clause_eval_batch_cell
+{
+   long          clause_no;
+   long          clause_size;  /* Allocated size of per-clause arrays */
+   Clause_p      *clauses;
+   bool          *empty;       /* ClauseIsSemFalse() */
+   bool          *oriented;    /* CPIsOriented when props were taken */
+   long          *lit_start;
+   double        *res;         /* Results of a weight function */
+   long          lit_no;
+   long          lit_size;     /* Allocated size of per-literal arrays */
+   long          *lterm_vars;
+   long          *lterm_funs;
+   long          *rterm_vars;
+   long          *rterm_funs;
+   unsigned char *lit_props;
+}ClauseEvalBatchCell, *ClauseEvalBatch_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define ClauseEvalBatchCellAlloc() \
+   (ClauseEvalBatchCell*)SizeMalloc(sizeof(ClauseEvalBatchCell))
+#define ClauseEvalBatchCellFree(junk) \
+   SizeFree(junk, sizeof(ClauseEvalBatchCell))
+
+#define ClauseEvalBatchReset(batch) \
+   ((batch)->clause_no = 0, (batch)->lit_no = 0, (batch)->lit_start[0] = 0)
+
+ClauseEvalBatch_p ClauseEvalBatchAlloc(void);
+void              ClauseEvalBatchFree(ClauseEvalBatch_p junk);
+
+void ClauseEvalBatchAddClause(ClauseEvalBatch_p batch, Clause_p clause);
+void ClauseEvalBatchMarkMaximalTerms(ClauseEvalBatch_p batch, OCB_p ocb);
+
+void ClauseEvalBatchWeight(ClauseEvalBatch_p batch,
+                           double max_term_multiplier,
+                           double max_literal_multiplier,
+                           double pos_multiplier,
+                           long vweight, long fweight,
+                           double app_var_mult,
+                           bool count_eq_encoding);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
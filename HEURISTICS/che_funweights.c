@@ -19,6 +19,8 @@ Changes
 
 <1> Sat May  7 21:22:32 CEST 2005
     New
+<2> Sat Oct 17 2026
+    Memoize term weights in the term bank
 
 -----------------------------------------------------------------------*/
 
@@ -481,6 +483,7 @@ FunWeightParam_p FunWeightParamAlloc(void)
    res->f_occur      = NULL;
    res->app_var_mult = 0;
    res->type_freqs   = NULL;
+   res->cache_id     = TBWeightCacheNewId();
 
    return res;
 }
@@ -1460,7 +1463,8 @@ double GenericFunWeightCompute(void* data, Clause_p clause)
                           local->fweights,
                           local->fweight,
                           local->app_var_mult,
-                          local->type_freqs);
+                          local->type_freqs,
+                          local->cache_id);
 }
 
 
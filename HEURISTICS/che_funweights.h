@@ -19,6 +19,8 @@ Changes
 
 <1> Sat May  7 20:57:21 CEST 2005
     New
+<2> Sat Oct 17 2026
+    Memoize term weights in the term bank
 
 -----------------------------------------------------------------------*/
 
@@ -81,6 +83,10 @@ typedef struct funweightparamcell
    /* array storing frequencies of types for certain symbols */
    long   *type_freqs;
 
+   /* Id for memoizing term weights in the term bank (the weights
+      above never change once initialized) */
+   long   cache_id;
+
    /* Temporary store for function symbol counts, put here to avoid
     * multiple  (expensive for large signatures) initializations. */
    PDArray_p f_occur;
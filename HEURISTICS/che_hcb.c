@@ -15,6 +15,10 @@
   Run "eprover -h" for contact information.
 
   Created: Fri Oct 16 14:52:53 MET DST 1998
+  Sat Oct 17 2026: HCBClauseSetEvaluate()
+  Sat Oct 17 2026: sat_check_incremental
+  Sat Oct 17 2026: given_batch_size
+  Sat Oct 17 2026: filter_ground_entailed
 
   -----------------------------------------------------------------------*/
 
@@ -42,7 +46,7 @@ PERF_CTR_DEFINE(ClauseEvalTimer);
 //
 // Function: get_next_clause()
 //
-//   Return the next clause from the selected EvalTreeTraverse-Stack,
+//   Return the next clause from the selected EvalHeapTraverse-Stack,
 //   or NULL if the stack is empty.
 //
 // Global Variables: -
@@ -55,7 +59,7 @@ static Clause_p get_next_clause(PStack_p *stacks, int pos)
 {
    Eval_p current;
 
-   current = EvalTreeTraverseNext(stacks[pos], pos);
+   current = EvalHeapTraverseNext(stacks[pos]);
    if(current)
    {
       return current->object;
@@ -88,6 +92,7 @@ void default_exit_fun(void* data)
 void HeuristicParmsInitialize(HeuristicParms_p handle)
 {
    handle->no_preproc                    = false;
+   handle->filter_ground_entailed        = false;
    handle->eqdef_maxclauses              = DEFAULT_EQDEF_MAXCLAUSES;
    handle->eqdef_incrlimit               = DEFAULT_EQDEF_INCRLIMIT;
 
@@ -113,6 +118,7 @@ void HeuristicParmsInitialize(HeuristicParms_p handle)
    handle->enable_eq_factoring           = true;
    handle->enable_neg_unit_paramod       = true;
    handle->enable_given_forward_simpl    = true;
+   handle->given_batch_size              = 1;
    handle->pm_type                       = ParamodPlain;
 
    handle->ac_handling                   = ACDiscardAll;
@@ -147,6 +153,7 @@ void HeuristicParmsInitialize(HeuristicParms_p handle)
    handle->sat_check_ttinsert_limit      = LONG_MAX;
    handle->sat_check_normconst           = false;
    handle->sat_check_normalize           = false;
+   handle->sat_check_incremental         = false;
    handle->sat_check_decision_limit      = 10000;
    handle->filter_orphans_limit          = DEFAULT_FILTER_ORPHANS_LIMIT;
    handle->forward_contract_limit        = DEFAULT_FORWARD_CONTRACT_LIMIT;
@@ -227,6 +234,8 @@ void HeuristicParmsPrint(FILE* out, HeuristicParms_p handle)
    fprintf(out, "{\n");
 
    fprintf(out, "   no_preproc:                    %s\n", BOOL2STR(handle->no_preproc));
+   fprintf(out, "   filter_ground_entailed:        %s\n",
+           BOOL2STR(handle->filter_ground_entailed));
    fprintf(out, "   eqdef_maxclauses:              %ld\n", handle->eqdef_maxclauses);
    fprintf(out, "   eqdef_incrlimit:               %ld\n", handle->eqdef_incrlimit);
 
@@ -264,6 +273,8 @@ void HeuristicParmsPrint(FILE* out, HeuristicParms_p handle)
            BOOL2STR(handle->enable_neg_unit_paramod));
    fprintf(out, "   enable_given_forward_simpl:    %s\n",
            BOOL2STR(handle->enable_given_forward_simpl));
+   fprintf(out, "   given_batch_size:              %ld\n",
+           handle->given_batch_size);
 
    fprintf(out, "   pm_type:                       %s\n", ParamodStr(handle->pm_type));
 
@@ -314,6 +325,8 @@ void HeuristicParmsPrint(FILE* out, HeuristicParms_p handle)
            BOOL2STR(handle->sat_check_normconst));
    fprintf(out, "   sat_check_normalize:           %s\n",
            BOOL2STR(handle->sat_check_normalize));
+   fprintf(out, "   sat_check_incremental:         %s\n",
+           BOOL2STR(handle->sat_check_incremental));
    fprintf(out, "   sat_check_decision_limit:      %d\n",
            handle->sat_check_decision_limit);
 
@@ -373,6 +386,7 @@ bool HeuristicParmsParseInto(Scanner_p in,
    AcceptInpTok(in, OpenCurly);
 
    PARSE_BOOL(no_preproc);
+   PARSE_BOOL(filter_ground_entailed);
    PARSE_INT(eqdef_maxclauses);
    PARSE_INT(eqdef_incrlimit);
    PARSE_IDENTIFIER(heuristic_name);
@@ -422,6 +436,7 @@ bool HeuristicParmsParseInto(Scanner_p in,
    PARSE_BOOL(enable_eq_factoring);
    PARSE_BOOL(enable_neg_unit_paramod);
    PARSE_BOOL(enable_given_forward_simpl);
+   PARSE_INT(given_batch_size);
 
    if(TestInpId(in, "pm_type"))
    {
@@ -470,6 +485,7 @@ bool HeuristicParmsParseInto(Scanner_p in,
    PARSE_INT(sat_check_ttinsert_limit);
    PARSE_BOOL(sat_check_normconst);
    PARSE_BOOL(sat_check_normalize);
+   PARSE_BOOL(sat_check_incremental);
    PARSE_INT(sat_check_decision_limit);
 
    PARSE_INT(filter_orphans_limit);
@@ -534,6 +550,7 @@ HCB_p HCBAlloc(void)
    handle->hcb_select    = HCBStandardClauseSelect;
    handle->hcb_exit      = default_exit_fun;
    handle->data          = NULL;
+   handle->eval_batch    = NULL;
 
    return handle;
 }
@@ -562,6 +579,10 @@ void HCBFree(HCB_p junk)
    {
       junk->hcb_exit(junk->data);
    }
+   if(junk->eval_batch)
+   {
+      ClauseEvalBatchFree(junk->eval_batch);
+   }
    HCBCellFree(junk);
 }
 
@@ -630,6 +651,77 @@ void HCBClauseEvaluate(HCB_p hcb, Clause_p clause)
    PERF_CTR_EXIT(ClauseEvalTimer);
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: HCBClauseSetEvaluate()
+//
+//   Add evaluations to all clauses in set. Weight functions that
+//   support batch evaluation compute the evaluations for all clauses
+//   at once, the others are called for each clause. The results are
+//   the same as with HCBClauseEvaluate() for each clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory, adds evaluations, by eval functions
+//
+/----------------------------------------------------------------------*/
+
+void HCBClauseSetEvaluate(HCB_p hcb, ClauseSet_p set)
+{
+   long     i, j;
+   bool     batch = false;
+   WFCB_p   wfcb;
+   Clause_p handle;
+
+   PERF_CTR_ENTRY(ClauseEvalTimer);
+   for(i=0; i< hcb->wfcb_no; i++)
+   {
+      wfcb = PDArrayElementP(hcb->wfcb_list, i);
+      batch = batch || wfcb->wfcb_batch_eval;
+   }
+   if(!batch)
+   {
+      PERF_CTR_EXIT(ClauseEvalTimer);
+      for(handle = set->anchor->succ; handle != set->anchor;
+          handle = handle->succ)
+      {
+         HCBClauseEvaluate(hcb, handle);
+      }
+      return;
+   }
+   if(!hcb->eval_batch)
+   {
+      hcb->eval_batch = ClauseEvalBatchAlloc();
+   }
+   ClauseEvalBatchReset(hcb->eval_batch);
+   for(handle = set->anchor->succ; handle != set->anchor;
+       handle = handle->succ)
+   {
+      assert(handle->evaluations == NULL);
+      ClauseAddEvalCell(handle, EvalsAlloc(hcb->wfcb_no));
+      ClauseEvalBatchAddClause(hcb->eval_batch, handle);
+   }
+   for(i=0; i< hcb->wfcb_no; i++)
+   {
+      wfcb = PDArrayElementP(hcb->wfcb_list, i);
+      if(wfcb->wfcb_batch_eval)
+      {
+         ClauseAddBatchEvaluations(wfcb, hcb->eval_batch, i);
+      }
+      else
+      {
+         for(j=0; j<hcb->eval_batch->clause_no; j++)
+         {
+            ClauseAddEvaluation(wfcb, hcb->eval_batch->clauses[j], i,
+                                hcb->eval_batch->empty[j]);
+         }
+      }
+   }
+   PERF_CTR_EXIT(ClauseEvalTimer);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: HCBStandardClauseSelect()
@@ -723,7 +815,7 @@ long HCBClauseSetDelProp(HCB_p hcb, ClauseSet_p set, long number,
    for(i=0; i< hcb->wfcb_no; i++)
    {
       stacks[i]=
-         EvalTreeTraverseInit(PDArrayElementP(set->eval_indices, i),i);
+         EvalHeapTraverseInit(PDArrayElementP(set->eval_indices, i),i);
    }
    while(number)
    {
@@ -756,7 +848,7 @@ long HCBClauseSetDelProp(HCB_p hcb, ClauseSet_p set, long number,
    }
    for(i=0; i< hcb->wfcb_no; i++)
    {
-      EvalTreeTraverseExit(stacks[i]);
+      EvalHeapTraverseExit(stacks[i]);
    }
    SizeFree(stacks, hcb->wfcb_no*sizeof(PStack_p));
 
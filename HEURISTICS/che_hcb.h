@@ -16,6 +16,8 @@
   Run "eprover -h" for contact information.
 
   Created: Fri Jun  5 22:25:02 MET DST 1998
+  Sat Oct 17 2026: Batch evaluation of clause sets
+  Sat Oct 17 2026: Incremental SAT checking
 
   -----------------------------------------------------------------------*/
 
@@ -60,6 +62,7 @@ typedef struct heuristic_parms_cell
 {
    /* Preprocessing */
    bool                no_preproc;
+   bool                filter_ground_entailed;
    long                eqdef_maxclauses;
    long                eqdef_incrlimit;
 
@@ -89,6 +92,8 @@ typedef struct heuristic_parms_cell
    bool                enable_eq_factoring; /* Default is on! */
    bool                enable_neg_unit_paramod; /* Default is on */
    bool                enable_given_forward_simpl; /* On */
+   long                given_batch_size; /* Given clauses per main loop
+                                            step, 1 is the classic loop */
 
    ParamodulationType  pm_type;  /* Default is ParamodPlain */
 
@@ -126,6 +131,7 @@ typedef struct heuristic_parms_cell
    long                sat_check_ttinsert_limit;
    bool                sat_check_normconst;
    bool                sat_check_normalize;
+   bool                sat_check_incremental;
    int                 sat_check_decision_limit;
 
    /* Various things */
@@ -181,6 +187,10 @@ typedef struct hcb_cell
       only called if data != NULL. */
    GenericExitFun  hcb_exit;
    void*           data;
+
+   /* Reused buffer for HCBClauseSetEvaluate(), allocated on first
+      use if any WFCB supports batch evaluation. */
+   ClauseEvalBatch_p eval_batch;
 }HCBCell, *HCB_p;
 
 #define HCB_DEFAULT_HEURISTIC "Default"
@@ -224,6 +234,7 @@ HCB_p    HCBAlloc(void);
 void     HCBFree(HCB_p junk);
 long     HCBAddWFCB(HCB_p hcb, WFCB_p wfcb, long steps);
 void     HCBClauseEvaluate(HCB_p hcb, Clause_p clause);
+void     HCBClauseSetEvaluate(HCB_p hcb, ClauseSet_p set);
 Clause_p HCBStandardClauseSelect(HCB_p hcb, ClauseSet_p set);
 Clause_p HCBSingleWeightClauseSelect(HCB_p hcb, ClauseSet_p set);
 
@@ -20,6 +20,8 @@ Changes
     Salvaged from cco_proofstate.h, forked control and state.
 <2> Wed Dec 16 18:45:14 MET 1998
     Moved from cco to che
+<3> Sat Oct 17 2026
+    Free incremental SAT state
 
 -----------------------------------------------------------------------*/
 
@@ -210,6 +212,7 @@ ProofControl_p ProofControlAlloc(void)
    HeuristicParmsInitialize(&handle->heuristic_parms);
 
    sat_solver_init(handle);
+   handle->sat_state = NULL;
 
    return handle;
 }
@@ -242,6 +245,10 @@ void ProofControlFree(ProofControl_p junk)
    {
       picosat_reset(junk->solver);
    }
+   if(junk->sat_state)
+   {
+      SatIncStateFree(junk->sat_state);
+   }
    ProofControlCellFree(junk);
 }
 
@@ -19,6 +19,8 @@ Changes
 
 <1> Fri Oct 16 14:52:53 MET DST 1998
     New
+<2> Sat Oct 17 2026
+    Added sat_state
 
 -----------------------------------------------------------------------*/
 
@@ -49,6 +51,8 @@ typedef struct proofcontrolcell
    SpecFeatureCell     problem_specs;
    /* Sat solver object. */
    SatSolver_p         solver;
+   /* Persistent state for incremental SAT checking (or NULL) */
+   SatIncState_p       sat_state;
 }ProofControlCell, *ProofControl_p;
 
 #define HCBARGUMENTS ProofState_p state, ProofControl_p control, \
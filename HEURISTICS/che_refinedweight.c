@@ -18,6 +18,8 @@ Changes
 
 <1> Wed Jun 17 00:11:03 MET DST 1998
     New
+<2> Sat Oct 17 2026
+    Batch evaluation
 
 -----------------------------------------------------------------------*/
 
@@ -63,6 +65,7 @@ WFCB_p ClauseRefinedWeightInit(ClausePrioFun prio_fun, int fweight,
                 pos_multiplier, double app_var_mult)
 {
    RefinedWeightParam_p data = RefinedWeightParamCellAlloc();
+   WFCB_p               res;
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -72,8 +75,11 @@ WFCB_p ClauseRefinedWeightInit(ClausePrioFun prio_fun, int fweight,
    data->ocb                    = ocb;
    data->app_var_mult           = app_var_mult;
 
-   return WFCBAlloc(ClauseRefinedWeightCompute, prio_fun,
-          ClauseRefinedWeightExit, data);
+   res = WFCBAlloc(ClauseRefinedWeightCompute, prio_fun,
+                   ClauseRefinedWeightExit, data);
+   res->wfcb_batch_eval = ClauseRefinedWeightBatchCompute;
+
+   return res;
 }
 
 
@@ -151,6 +157,34 @@ double ClauseRefinedWeightCompute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseRefinedWeightBatchCompute()
+//
+//   Compute evaluations for all clauses in batch.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks maximal terms in the clauses
+//
+/----------------------------------------------------------------------*/
+
+void ClauseRefinedWeightBatchCompute(void* data, ClauseEvalBatch_p batch)
+{
+   RefinedWeightParam_p local = data;
+
+   ClauseEvalBatchMarkMaximalTerms(batch, local->ocb);
+   ClauseEvalBatchWeight(batch,
+                         local->max_term_multiplier,
+                         local->max_literal_multiplier,
+                         local->pos_multiplier,
+                         local->vweight,
+                         local->fweight,
+                         local->app_var_mult,
+                         false);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseRefinedWeight2Parse()
@@ -170,6 +204,7 @@ WFCB_p ClauseRefinedWeight2Parse(Scanner_p in, OCB_p ocb, ProofState_p
 
    tmp = ClauseRefinedWeightParse(in, ocb, state);
    tmp->wfcb_eval = ClauseRefinedWeight2Compute;
+   tmp->wfcb_batch_eval = ClauseRefinedWeight2BatchCompute;
 
    return tmp;
 }
@@ -202,6 +237,34 @@ double ClauseRefinedWeight2Compute(void* data, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseRefinedWeight2BatchCompute()
+//
+//   Compute evaluations for all clauses in batch.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks maximal terms in the clauses
+//
+/----------------------------------------------------------------------*/
+
+void ClauseRefinedWeight2BatchCompute(void* data, ClauseEvalBatch_p batch)
+{
+   RefinedWeightParam_p local = data;
+
+   ClauseEvalBatchMarkMaximalTerms(batch, local->ocb);
+   ClauseEvalBatchWeight(batch,
+                         local->max_term_multiplier,
+                         local->max_literal_multiplier,
+                         local->pos_multiplier,
+                         local->vweight,
+                         local->fweight,
+                         local->app_var_mult,
+                         true);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseRefinedWeightExit()
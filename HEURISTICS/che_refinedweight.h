@@ -66,11 +66,13 @@ WFCB_p ClauseRefinedWeightParse(Scanner_p in, OCB_p ocb, ProofState_p
             state);
 
 double ClauseRefinedWeightCompute(void* data, Clause_p clause);
+void   ClauseRefinedWeightBatchCompute(void* data, ClauseEvalBatch_p batch);
 
 WFCB_p ClauseRefinedWeight2Parse(Scanner_p in, OCB_p ocb, ProofState_p
             state);
 
 double ClauseRefinedWeight2Compute(void* data, Clause_p clause);
+void   ClauseRefinedWeight2BatchCompute(void* data, ClauseEvalBatch_p batch);
 
 void   ClauseRefinedWeightExit(void* data);
 
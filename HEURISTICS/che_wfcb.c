@@ -15,6 +15,7 @@
   Run "eprover -h" for contact information.
 
   Created: Fri Jun  5 22:05:39 MET DST 1998
+  Sat Oct 17 2026: ClauseAddBatchEvaluations()
 
   -----------------------------------------------------------------------*/
 
@@ -60,6 +61,7 @@ WFCB_p WFCBAlloc(ClauseEvalFun wfcb_eval, ClausePrioFun prio_fun,
    WFCB_p handle = WFCBCellAlloc();
 
    handle->wfcb_eval = wfcb_eval;
+   handle->wfcb_batch_eval = NULL;
    handle->wfcb_priority = prio_fun;
    handle->wfcb_exit = wfcb_exit;
    handle->data = data;
@@ -117,6 +119,45 @@ void ClauseAddEvaluation(WFCB_p wfcb, Clause_p clause, int pos, bool empty)
    }
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseAddBatchEvaluations()
+//
+//   Given a batch of clauses (with evaluation cells) and a wfcb with
+//   a batch evaluation function, add evaluation pos to all clauses.
+//
+// Global Variables: -
+//
+// Side Effects    : Adds evaluations, by calling
+//                   wfcb->wfcb_batch_eval()
+//
+/----------------------------------------------------------------------*/
+
+void ClauseAddBatchEvaluations(WFCB_p wfcb, ClauseEvalBatch_p batch,
+                               int pos)
+{
+   long     i;
+   Clause_p clause;
+
+   assert(wfcb->wfcb_batch_eval);
+   wfcb->wfcb_batch_eval(wfcb->data, batch);
+   for(i=0; i<batch->clause_no; i++)
+   {
+      clause = batch->clauses[i];
+      assert(clause->evaluations);
+      clause->evaluations->evals[pos].heuristic = batch->res[i];
+      if(batch->empty[i])
+      {
+         clause->evaluations->evals[pos].priority = PrioBest;
+      }
+      else
+      {
+         clause->evaluations->evals[pos].priority = wfcb->wfcb_priority(clause);
+      }
+   }
+}
+
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
@@ -37,6 +37,12 @@
   This function is responsible for freeing data, before the WFCB is
   deleted.
 
+  void <eval>BatchCompute(void *data, ClauseEvalBatch_p batch)
+
+  Optional. Compute the evaluations of all clauses in batch into
+  batch->res (with the same results as <eval>Compute). Set
+  wfcb_batch_eval in the Init function if it exists.
+
   Copyright 1998-2018 by the authors (see DOC/CONTRIBUTORS).
   This code is released under the GNU General Public Licence and
   the GNU Lesser General Public License.
@@ -46,6 +52,7 @@
   Changes
 
   Created: Fri Jun  5 21:39:40 MET DST 1998
+  Sat Oct 17 2026: Optional batch evaluation functions.
 
   -----------------------------------------------------------------------*/
 
@@ -57,6 +64,7 @@
 #include <cio_output.h>
 #include <ccl_proofstate.h>
 #include <che_prio_funs.h>
+#include <che_evalbatch.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -68,9 +76,13 @@
 typedef double (*ClauseEvalFun)(void* data, Clause_p
                                 clause);
 
+typedef void (*ClauseBatchEvalFun)(void* data, ClauseEvalBatch_p batch);
+
 typedef struct wfcb_cell
 {
    ClauseEvalFun     wfcb_eval;     /* Compute a clauses evaluation */
+   ClauseBatchEvalFun wfcb_batch_eval; /* Evaluate a batch of clauses,
+                                          may be NULL */
    GenericExitFun    wfcb_exit;     /* Clean up - in particular, free
                                        data */
    ClausePrioFun     wfcb_priority; /* Compute the priority */
@@ -95,6 +107,8 @@ WFCB_p WFCBAlloc(ClauseEvalFun wfcb_eval, ClausePrioFun prio_fun,
 void   WFCBFree(WFCB_p junk);
 
 void   ClauseAddEvaluation(WFCB_p wfcb, Clause_p clause, int pos, bool empty);
+void   ClauseAddBatchEvaluations(WFCB_p wfcb, ClauseEvalBatch_p batch,
+                                 int pos);
 
 #endif
 
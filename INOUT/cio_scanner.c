@@ -15,6 +15,10 @@
   Run "eprover -h" for contact information.
 
   Created: Sun Aug 31 13:31:42 MET DST 1997
+  Sat Oct 17 2026: Scan white space, identifiers, numbers and line
+  comments as contiguous spans of the stream buffer.
+  Sat Oct 17 2026: Restrict scanning to a range of a buffered
+  stream (for parsing parts of a file in parallel).
 
   -----------------------------------------------------------------------*/
 
@@ -83,6 +87,71 @@ static TokenRepCell token_print_rep[] =
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: scan_span()
+//
+//   Append the longest sequence of characters of the current input
+//   that satisfy test (or, if test is NULL, that are not newlines) to
+//   the literal of the current token and skip it. Return the number
+//   of characters.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, changes the scanner state, memory
+//                   operations.
+//
+/----------------------------------------------------------------------*/
+
+static long scan_span(Scanner_p in, int (*test)(int))
+{
+   Stream_p stream = in->source;
+   long     res = 0, avail, len;
+   char     *span, *nl;
+
+   do
+   {
+      span  = StreamCurrPtr(stream);
+      avail = StreamAvailable(stream);
+      if(test)
+      {
+         for(len=0; len<avail && test((unsigned char)span[len]); len++)
+         {
+            /* Nothing */
+         }
+      }
+      else
+      {
+         nl  = memchr(span, '\n', avail);
+         len = nl?(nl-span):avail;
+      }
+      DStrAppendBuffer(AktToken(in)->literal, span, len);
+      StreamSkipChars(stream, len);
+      res += len;
+   }while(len && len == avail);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: is_id_char()
+//
+//   Function version of isidchar() for scan_span().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int is_id_char(int ch)
+{
+   return isidchar(ch);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: scan_white()
@@ -92,18 +161,14 @@ static TokenRepCell token_print_rep[] =
 // Global Variables: -
 //
 // Side Effects    : Reads input, changes the scanner state, may cause
-//                   memory operations by by calling DStrAppendChar().
+//                   memory operations by by calling DStrAppendBuffer().
 //
 /----------------------------------------------------------------------*/
 
 static void scan_white(Scanner_p in)
 {
    AktToken(in)->tok = WhiteSpace;
-   while(isspace(CurrChar(in)))
-   {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
-   }
+   scan_span(in, isspace);
 }
 
 
@@ -122,27 +187,24 @@ static void scan_white(Scanner_p in)
 
 static void scan_ident(Scanner_p in)
 {
-   long numstart = 0,
-      i;
+   long start = DStrLen(AktToken(in)->literal),
+      numstart,
+      len;
+   char *ident;
 
-   for(i=0; isidchar(CurrChar(in)); i++)
+   len   = scan_span(in, is_id_char);
+   ident = DStrView(AktToken(in)->literal)+start;
+
+   /* An identifier is an Idnum if it ends in digits (that are not
+      all of it) */
+   for(numstart = len; numstart && isdigit(ident[numstart-1]); numstart--)
    {
-      if(!numstart && isdigit(CurrChar(in)))
-      {
-         numstart = i;
-      }
-      else if(!isdigit(CurrChar(in)))
-      {
-         numstart = 0;
-      }
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
+      /* Nothing */
    }
-   if(numstart)
+   if(numstart && numstart < len)
    {
       AktToken(in)->tok = Idnum;
-      AktToken(in)->numval =
-         strtol(DStrView(AktToken(in)->literal)+numstart, NULL, 10);
+      AktToken(in)->numval = strtol(ident+numstart, NULL, 10);
       /* Errors are intentionally ignored to allow arbitrary
          identifiers */
    }
@@ -173,11 +235,7 @@ static void scan_int(Scanner_p in)
 {
    AktToken(in)->tok = PosInt;
 
-   while(isdigit(CurrChar(in)))
-   {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
-   }
+   scan_span(in, isdigit);
    errno = 0;
    AktToken(in)->numval =
       strtoumax(DStrView(AktToken(in)->literal), NULL, 10);
@@ -209,11 +267,7 @@ static void scan_line_comment(Scanner_p in)
 {
    AktToken(in)->tok = Comment;
 
-   while((CurrChar(in)) != '\n' && (CurrChar(in)!=EOF))
-   {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
-   }
+   scan_span(in, NULL);
    DStrAppendChar(AktToken(in)->literal, '\n');
    NextChar(in); /* Should be harmless even at EOF */
 }
@@ -986,6 +1040,37 @@ void ScannerSetFormat(Scanner_p scanner, IOFormat fmt)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ScannerSetRange()
+//
+//   Restrict the (completely buffered, not stacked) input of the
+//   scanner to the given character range (see StreamSetRange()) and
+//   rescan the lookahead tokens from its start. Return false if this
+//   is not possible.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the input position, reads input
+//
+/----------------------------------------------------------------------*/
+
+bool ScannerSetRange(Scanner_p in, long start, long end)
+{
+   if(in->source->next || !StreamSetRange(in->source, start, end))
+   {
+      return false;
+   }
+   for(in->current = 0; in->current < MAXTOKENLOOKAHEAD; in->current++)
+   {
+      scan_real_token(in);
+   }
+   in->current = 0;
+
+   return true;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: TestTok()
@@ -189,6 +189,7 @@ Scanner_p CreateScanner(StreamType type, char *name, bool
 void      DestroyScanner(Scanner_p  junk);
 
 void      ScannerSetFormat(Scanner_p scanner, IOFormat fmt);
+bool      ScannerSetRange(Scanner_p in, long start, long end);
 
 
 #define TOKENREALPOS(pos) ((pos) % MAXTOKENLOOKAHEAD)
@@ -17,9 +17,13 @@
   Changes
 
   Created: Sat Jul  5 02:28:25 MET DST 1997
+  Sat Oct 17 2026: Buffer the whole input (mmap() or block reads)
+  instead of reading single characters with getc().
 
   -----------------------------------------------------------------------*/
 
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "cio_streams.h"
 
 
@@ -53,50 +57,79 @@ const StreamType StreamTypeOptionString =
 
 /*-----------------------------------------------------------------------
 //
-// Function: read_char()
+// Function: stream_fill()
 //
-//   Read a character and return it. Return an infinite sequence of
-//   EOFs after the end of file.
+//   Move the unread part of a block buffer to its start and read as
+//   much of the file as fits behind it.
 //
 // Global Variables: -
 //
-// Side Effects    : May read a character
+// Side Effects    : Reads input
 //
 /----------------------------------------------------------------------*/
 
-static int read_char(Stream_p stream)
+static void stream_fill(Stream_p stream)
 {
-   int ch;
+   size_t got;
+
+   assert(!stream->mapped);
+   assert(stream->stream_type == StreamTypeFile);
 
    if(stream->eof_seen)
    {
-      ch = EOF;
+      return;
    }
-   else
+   stream->end -= stream->pos;
+   memmove(stream->buffer, stream->buffer+stream->pos, stream->end);
+   stream->pos = 0;
+   got = fread(stream->buffer+stream->end, 1,
+               stream->size-stream->end, stream->file);
+   stream->end += got;
+   if(stream->end < stream->size)
    {
-      if(stream->stream_type!=StreamTypeFile)
-      {
-         ch = (int)DStrView(stream->source)[stream->string_pos];
-         if(ch)
-         {
-            stream->string_pos++;
-         }
-         else
-         {
-            ch = EOF;
-            stream->eof_seen = true;
-         }
-      }
-      else
-      {
-         ch = getc(stream->file);
-         if(ch == EOF)
-         {
-            stream->eof_seen = true;
-         }
-      }
+      stream->eof_seen = true;
    }
-   return ch;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: stream_map_file()
+//
+//   Try to map the (regular, non-empty, unread) file of the stream
+//   into memory. Return true on success.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool stream_map_file(Stream_p stream)
+{
+   struct stat stat_buf;
+   void        *mem;
+
+   if(fstat(fileno(stream->file), &stat_buf)!=0 ||
+      !S_ISREG(stat_buf.st_mode) ||
+      stat_buf.st_size == 0 ||
+      ftell(stream->file) != 0)
+   {
+      return false;
+   }
+   mem = mmap(NULL, stat_buf.st_size, PROT_READ, MAP_PRIVATE,
+              fileno(stream->file), 0);
+   if(mem == MAP_FAILED)
+   {
+      return false;
+   }
+   madvise(mem, stat_buf.st_size, MADV_SEQUENTIAL);
+   stream->buffer = mem;
+   stream->end    = stat_buf.st_size;
+   stream->size   = stat_buf.st_size;
+   stream->mapped = true;
+
+   return true;
 }
 
 /*---------------------------------------------------------------------*/
@@ -120,7 +153,6 @@ static int read_char(Stream_p stream)
 Stream_p CreateStream(StreamType type, char* source, bool fail)
 {
    Stream_p handle;
-   int      i;
 
    handle = StreamCellAlloc();
 
@@ -155,17 +187,28 @@ Stream_p CreateStream(StreamType type, char* source, bool fail)
       /* Interprete source as a string to read from! */
 
       DStrSet(handle->source, source);
-      handle->string_pos = 0;
+      handle->file = NULL;
    }
    handle->next       = NULL;
-   handle->eof_seen   = false;
+   handle->eof_seen   = true;
    handle->line       = 1;
    handle->column     = 1;
-   handle->current    = 0;
+   handle->pos        = 0;
+   handle->mapped     = false;
 
-   for(i=0; i<MAXLOOKAHEAD; i++)
+   if(type != StreamTypeFile)
+   {
+      handle->buffer = DStrView(handle->source);
+      handle->end    = DStrLen(handle->source);
+      handle->size   = 0;
+   }
+   else if(!stream_map_file(handle))
    {
-      handle->buffer[i] = read_char(handle);
+      handle->buffer   = SecureMalloc(STREAM_BLOCK_SIZE);
+      handle->end      = 0;
+      handle->size     = STREAM_BLOCK_SIZE;
+      handle->eof_seen = false;
+      stream_fill(handle);
    }
 
    return handle;
@@ -199,6 +242,14 @@ void DestroyStream(Stream_p stream)
          }
       }
       VERBOUTARG("Closing ", DStrView(stream->source));
+      if(stream->mapped)
+      {
+         munmap(stream->buffer, stream->size);
+      }
+      else
+      {
+         FREE(stream->buffer);
+      }
    }
    DStrFree(stream->source);
    StreamCellFree(stream);
@@ -230,14 +281,102 @@ int StreamNextChar(Stream_p stream)
    {
       stream->column++;
    }
-   stream->current=STREAMREALPOS(stream->current+1);
-   stream->buffer[STREAMREALPOS(stream->current+MAXLOOKAHEAD-1)]
-      = read_char(stream);
-
+   if(stream->pos < stream->end)
+   {
+      stream->pos++;
+   }
+   if(UNLIKELY(StreamAvailable(stream) < MAXLOOKAHEAD) && !stream->eof_seen)
+   {
+      stream_fill(stream);
+   }
    return StreamCurrChar(stream);
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: StreamSkipChars()
+//
+//   Move the current window n characters forward. The characters
+//   must be available in the buffer (see StreamAvailable()).
+//
+// Global Variables: -
+//
+// Side Effects    : May read input, update the stream information
+//                   about the current position.
+//
+/----------------------------------------------------------------------*/
+
+void StreamSkipChars(Stream_p stream, long n)
+{
+   char *handle = StreamCurrPtr(stream),
+        *end    = handle+n,
+        *nl;
+
+   assert(n <= StreamAvailable(stream));
+
+   while((nl = memchr(handle, '\n', end-handle)))
+   {
+      stream->line++;
+      stream->column = 1;
+      handle = nl+1;
+   }
+   stream->column += end-handle;
+   stream->pos    += n;
+   if(UNLIKELY(StreamAvailable(stream) < MAXLOOKAHEAD) && !stream->eof_seen)
+   {
+      stream_fill(stream);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StreamSetRange()
+//
+//   Restrict a completely buffered stream (a mapped file or a string)
+//   to the characters from start (inclusive) to end (exclusive) of
+//   the original input, and move to start. Line and column numbers
+//   continue to refer to the original input. Return false (and leave
+//   the stream unchanged) if the stream is not completely buffered
+//   or the range is invalid.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes stream position
+//
+/----------------------------------------------------------------------*/
+
+bool StreamSetRange(Stream_p stream, long start, long end)
+{
+   long len;
+
+   if(stream->mapped)
+   {
+      len = stream->size;
+   }
+   else if(stream->stream_type != StreamTypeFile)
+   {
+      len = DStrLen(stream->source);
+   }
+   else
+   {
+      return false;
+   }
+   if(start < 0 || start > end || end > len)
+   {
+      return false;
+   }
+   stream->end    = end;
+   stream->pos    = 0;
+   stream->line   = 1;
+   stream->column = 1;
+   StreamSkipChars(stream, start);
+
+   return true;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: OpenStackedInput()
@@ -21,6 +21,10 @@ Changes
 
 <1> Wed Aug 20 00:02:32 MET DST 1997
     New
+<2> Sat Oct 17 2026
+    Read files as a whole (mmap()) or in large blocks instead of
+    character by character, allow access to buffered spans.
+    Restriction of completely buffered streams to a range.
 
 -----------------------------------------------------------------------*/
 
@@ -37,6 +41,10 @@ Changes
 
 #define MAXLOOKAHEAD 64
 
+/* Files that cannot be mapped (pipes, terminals, empty files) are
+   read in blocks of this size. */
+#define STREAM_BLOCK_SIZE 65536
+
 
 /* Streams can read either from a file or from several predefined
    classes of strings. We use a StreamType 'virtual type' to denote
@@ -49,7 +57,13 @@ typedef char* StreamType;
 /* The following data structure describes the state of a (named) input
    stream with lookahead-capability. Streams are stackable, with new
    data being read from the top of the stack. The empty stack is a
-   NULL-valued pointer of type Inpstack_p! */
+   NULL-valued pointer of type Inpstack_p!
+
+   The input is kept in a contiguous buffer. For regular files this
+   is the mmap()ed file, for strings the string itself, and for other
+   files a block buffer that is refilled so that at least
+   MAXLOOKAHEAD characters (or the rest of the file) are available
+   after the current position. */
 
 
 typedef struct streamcell
@@ -58,16 +72,16 @@ typedef struct streamcell
    DStr_p             source;
    StreamType         stream_type; /* Only constant strings allowed
                   here! */
-   long               string_pos;
    FILE*              file;
-   bool               eof_seen;
+   bool               eof_seen;  /* Nothing more to read into buffer */
    long               line;
    long               column;
-   int                buffer[MAXLOOKAHEAD];
-   int                current;
+   char*              buffer;
+   long               pos;       /* Current character */
+   long               end;       /* End of valid data in buffer */
+   long               size;      /* Allocated size (block buffers) */
+   bool               mapped;    /* buffer is mmap()ed */
 }StreamCell, *Stream_p, **Inpstack_p;
-
-
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
@@ -84,16 +98,24 @@ extern const StreamType StreamTypeOptionString;
 Stream_p CreateStream(StreamType type, char* source, bool fail);
 void     DestroyStream(Stream_p stream);
 
-#define  STREAMREALPOS(pos) ((pos) % MAXLOOKAHEAD)
+#define  STREAMCHAR(stream, pos)\
+         ((pos)<(stream)->end?(int)(unsigned char)(stream)->buffer[pos]:EOF)
 
 #define  StreamLookChar(stream, look)\
          (assert((look)<MAXLOOKAHEAD),\
-     (stream)->buffer[STREAMREALPOS((stream)->current+(look))])
-#define  StreamCurrChar(stream) ((stream)->buffer[(stream)->current])
+          STREAMCHAR((stream), (stream)->pos+(look)))
+#define  StreamCurrChar(stream) STREAMCHAR((stream), (stream)->pos)
 #define  StreamCurrLine(stream)   ((stream)->line)
 #define  StreamCurrColumn(stream) ((stream)->column)
 
+/* The buffered input from the current position on. It is not
+   0-terminated and only valid until the stream is moved. */
+#define  StreamCurrPtr(stream)    ((stream)->buffer+(stream)->pos)
+#define  StreamAvailable(stream)  ((stream)->end-(stream)->pos)
+
 int      StreamNextChar(Stream_p stream);
+void     StreamSkipChars(Stream_p stream, long n);
+bool     StreamSetRange(Stream_p stream, long start, long end);
 
 Stream_p OpenStackedInput(Inpstack_p stack, StreamType type,
            char* source, bool fail);
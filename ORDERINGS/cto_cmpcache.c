@@ -6,7 +6,7 @@ Author: Stephan Schulz
 
 Contents
 
-  Cache for LPO-like comparisons.
+  Cache for term ordering comparisons.
 
   Copyright 1998, 1999 by the author.
   This code is released under the GNU General Public Licence and
@@ -18,6 +18,10 @@ Changes
 
 <1> Wed Jan  5 20:21:36 MET 2000
     New
+<2> Fri Oct 16 2026
+    Fixed-capacity hash table instead of splay tree.
+<3> Sat Oct 17 2026
+    Mark key terms with TPInCmpCache.
 
 -----------------------------------------------------------------------*/
 
@@ -39,85 +43,287 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+#define CMP_CACHE_HASH_MULT 0x9e3779b97f4a7c15ULL
+
+/*-----------------------------------------------------------------------
+//
+// Function: term_is_cacheable()
+//
+//   Return true if comparisons with term (dereferenced with deref)
+//   can be cached, i.e. if term is shared and the result does not
+//   depend on variable bindings.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline bool term_is_cacheable(Term_p term, DerefType deref)
+{
+   return !TermIsVar(term) && TermIsShared(term) &&
+      ((deref == DEREF_NEVER) || TBTermIsGround(term));
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: prepare_key()
 //
-//   Turn the 4 values into an ordered key. Return false if values are
-//   reordered, true otherwise.
+//   Order the two terms into a key (larger address first). Return
+//   false if values are reordered, true otherwise.
 //
 // Global Variables: -
 //
-// Side Effects    : Builds the key in *key.
+// Side Effects    : Builds the key in *k1, *k2.
 //
 /----------------------------------------------------------------------*/
 
-static bool prepare_key(Term_p t1, DerefType d1, Term_p t2, DerefType
-         d2, QuadKey_p key)
+static inline bool prepare_key(Term_p t1, Term_p t2, Term_p *k1, Term_p *k2)
 {
-   if(DoubleKeyCmp(t1, d1, t2, d2) > 0)
+   if(PGreater(t1, t2))
    {
-      key->p1 = t1;
-      key->i1 = d1;
-      key->p2 = t2;
-      key->i2 = d2;
+      *k1 = t1;
+      *k2 = t2;
       return true;
    }
-   key->p1 = t2;
-   key->i1 = d2;
-   key->p2 = t1;
-   key->i2 = d1;
+   *k1 = t2;
+   *k2 = t1;
    return false;
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: cmp_cache_bucket()
+//
+//   Return the bucket for the (ordered) key k1, k2. If shared term
+//   cells have been freed since the last access, the cache is reset
+//   first.
+//
+// Global Variables: TermCellStoreFreeEpoch
+//
+// Side Effects    : May reset the cache
+//
+/----------------------------------------------------------------------*/
+
+static inline CmpCacheBucket* cmp_cache_bucket(CmpCache_p cache,
+                                               Term_p k1, Term_p k2)
+{
+   uint64_t hash;
+
+   if(cache->epoch != TermCellStoreFreeEpoch)
+   {
+      CmpCacheReset(cache);
+   }
+   hash = ((uint64_t)(uintptr_t)k1*CMP_CACHE_HASH_MULT)
+      ^(uint64_t)(uintptr_t)k2;
+   hash = hash*CMP_CACHE_HASH_MULT;
+
+   return &(cache->buckets[hash >> cache->shift]);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bucket_find_way()
+//
+//   Return the index of the entry for k1, k2 in bucket, or -1.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline int bucket_find_way(CmpCacheBucket *bucket,
+                                  Term_p k1, Term_p k2)
+{
+   int i;
+
+   for(i=0; i<CMP_CACHE_WAYS; i++)
+   {
+      if((bucket->t1[i] == k1) && (bucket->t2[i] == k2))
+      {
+         return i;
+      }
+   }
+   return -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bucket_select_victim()
+//
+//   Return the index of a free entry in bucket, or, if there is
+//   none, select an entry to overwrite with the clock algorithm.
+//
+// Global Variables: -
+//
+// Side Effects    : Moves the clock hand, clears reference bits,
+//                   counts evictions.
+//
+/----------------------------------------------------------------------*/
+
+static inline int bucket_select_victim(CmpCache_p cache,
+                                       CmpCacheBucket *bucket)
+{
+   int i;
+
+   for(i=0; i<CMP_CACHE_WAYS; i++)
+   {
+      if(!bucket->t1[i])
+      {
+         return i;
+      }
+   }
+   while(bucket->ref[(int)bucket->hand])
+   {
+      bucket->ref[(int)bucket->hand] = 0;
+      bucket->hand = (bucket->hand+1)%CMP_CACHE_WAYS;
+   }
+   i = bucket->hand;
+   bucket->hand = (bucket->hand+1)%CMP_CACHE_WAYS;
+   cache->evictions++;
+
+   return i;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: CmpCacheAlloc()
+//
+//   Allocate an empty cache with room for (at least) entries
+//   comparisons.
+//
+// Global Variables: TermCellStoreFreeEpoch
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+CmpCache_p CmpCacheAlloc(long entries)
+{
+   CmpCache_p handle = CmpCacheCellAlloc();
+   long       size = 1;
+   int        shift = 64;
+
+   assert(entries > 0);
+   while(size*CMP_CACHE_WAYS < entries)
+   {
+      size = size*2;
+      shift--;
+   }
+   /* A hash shift of 64 is undefined, keep at least 2 buckets */
+   if(size == 1)
+   {
+      size  = 2;
+      shift = 63;
+   }
+   handle->size    = size;
+   handle->shift   = shift;
+   handle->raw_mem = SecureMalloc(size*sizeof(CmpCacheBucket)
+                                  +CMP_CACHE_LINE_SIZE-1);
+   handle->buckets = (CmpCacheBucket*)
+      (((uintptr_t)handle->raw_mem+CMP_CACHE_LINE_SIZE-1)
+       & ~(uintptr_t)(CMP_CACHE_LINE_SIZE-1));
+   CmpCacheReset(handle);
+   handle->hits      = 0;
+   handle->misses    = 0;
+   handle->evictions = 0;
+   handle->resets    = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CmpCacheFree()
+//
+//   Free a comparison cache.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void CmpCacheFree(CmpCache_p junk)
+{
+   assert(junk);
+
+   FREE(junk->raw_mem);
+   CmpCacheCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: CmpCacheReset()
+//
+//   Remove all entries from the cache.
+//
+// Global Variables: TermCellStoreFreeEpoch
+//
+// Side Effects    : Changes cache
+//
+/----------------------------------------------------------------------*/
+
+void CmpCacheReset(CmpCache_p cache)
+{
+   memset(cache->buckets, 0, cache->size*sizeof(CmpCacheBucket));
+   cache->epoch = TermCellStoreFreeEpoch;
+   cache->resets++;
+}
+
 
 /*-----------------------------------------------------------------------
 //
 // Function: CmpCacheFind()
 //
-//   Find a certain comparison in the cache.
+//   Find a certain comparison in the cache. Return to_unknown if it
+//   is not there (or cannot be cached at all).
 //
 // Global Variables: -
 //
-// Side Effects    : Only by splaying the tree.
+// Side Effects    : Sets reference bit, updates counters.
 //
 /----------------------------------------------------------------------*/
 
-CompareResult CmpCacheFind(CmpCache_p *cache, Term_p t1, DerefType d1,
-            Term_p t2, DerefType d2)
+CompareResult CmpCacheFind(CmpCache_p cache, Term_p t1, DerefType d1,
+                           Term_p t2, DerefType d2)
 {
-   QuadKey key;
-   QuadTree_p handle;
-   CompareResult res = to_unknown;
-   bool nat_order;
+   Term_p         k1, k2;
+   CmpCacheBucket *bucket;
+   CompareResult  res;
+   bool           nat_order;
+   int            i;
 
-   if(TermIsVar(t1)||TermIsVar(t2))
+   if(!term_is_cacheable(t1, d1)||!term_is_cacheable(t2, d2))
    {
       return to_unknown;
    }
-   nat_order = prepare_key(t1,d1,t2,d2,&key);
-   handle = QuadTreeFind(cache, &key);
+   nat_order = prepare_key(t1, t2, &k1, &k2);
+   bucket    = cmp_cache_bucket(cache, k1, k2);
+   i         = bucket_find_way(bucket, k1, k2);
 
-   if(nat_order)
-   {
-      if(handle)
-      {
-    res = handle->val.i_val;
-      }
-   }
-   else
+   if(i == -1)
    {
-      if(handle)
-      {
-    res = POInverseRelation(handle->val.i_val);
-      }
+      cache->misses++;
+      return to_unknown;
    }
-   return res;
+   cache->hits++;
+   bucket->ref[i] = 1;
+   res = bucket->res[i];
+
+   return nat_order?res:POInverseRelation(res);
 }
 
 
@@ -125,99 +331,119 @@ CompareResult CmpCacheFind(CmpCache_p *cache, Term_p t1, DerefType d1,
 //
 // Function: CmpCacheInsert()
 //
-//   Insert a comparison into an LPO cache. Return false if value
-//   already existed, true otherwise.
+//   Insert a comparison result into the cache. Partial results of
+//   greater-tests (to_notgteq, to_notleeq) are combined with an
+//   existing entry for the same pair.
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Changes cache, marks the terms with TPInCmpCache
 //
 /----------------------------------------------------------------------*/
 
-bool CmpCacheInsert(CmpCache_p *cache, Term_p t1, DerefType d1, Term_p
-          t2, DerefType d2, CompareResult insert)
+void CmpCacheInsert(CmpCache_p cache, Term_p t1, DerefType d1,
+                    Term_p t2, DerefType d2, CompareResult insert)
 {
-   QuadKey key;
-   IntOrP val;
-   bool nat_order, res;
-   QuadTree_p handle;
+   Term_p         k1, k2;
+   CmpCacheBucket *bucket;
+   CompareResult  val, old;
+   int            i;
 
    assert(insert!=to_unknown);
-   /* printf("%p:%d:%p:%d:%d\n", t1,d1,t2,d2,insert); */
 
-   if(TermIsVar(t1)||TermIsVar(t2))
+   if(!term_is_cacheable(t1, d1)||!term_is_cacheable(t2, d2))
    {
-      return false;
+      return;
    }
-
-   nat_order = prepare_key(t1,d1,t2,d2,&key);
-   if(nat_order)
+   if(prepare_key(t1, t2, &k1, &k2))
    {
-      val.i_val = insert;
+      val = insert;
    }
    else
    {
-      val.i_val = POInverseRelation(insert);
+      val = POInverseRelation(insert);
    }
-   handle = QuadTreeFind(cache, &key);
-   if(handle)
+   TermCellSetProp(k1, TPInCmpCache);
+   TermCellSetProp(k2, TPInCmpCache);
+   bucket = cmp_cache_bucket(cache, k1, k2);
+   i      = bucket_find_way(bucket, k1, k2);
+
+   if(i != -1)
    {
-      switch(handle->val.i_val)
+      old = bucket->res[i];
+      switch(old)
       {
       case to_notgteq:
-       /* printf("notgteq=%ld\n", val.i_val); */
-       if(val.i_val==to_notleeq)
-       {
-          handle->val.i_val = to_uncomparable;
-       }
-       else
-       {
-          assert((val.i_val==to_notgteq)||
-            (val.i_val==to_lesser)||
-            (val.i_val==to_uncomparable));
-          handle->val.i_val = val.i_val;
-       }
-       break;
+            if(val==to_notleeq)
+            {
+               bucket->res[i] = to_uncomparable;
+            }
+            else
+            {
+               assert((val==to_notgteq)||
+                      (val==to_lesser)||
+                      (val==to_uncomparable));
+               bucket->res[i] = val;
+            }
+            break;
       case to_notleeq:
-       /* printf("notleeq=%ld\n", val.i_val); */
-       if(val.i_val==to_notgteq)
-       {
-          handle->val.i_val = to_uncomparable;
-       }
-       else
-       {
-          assert((val.i_val==to_notleeq)||
-            (val.i_val==to_greater)||
-            (val.i_val==to_uncomparable));
-          handle->val.i_val = val.i_val;
-       }
-       break;
+            if(val==to_notgteq)
+            {
+               bucket->res[i] = to_uncomparable;
+            }
+            else
+            {
+               assert((val==to_notleeq)||
+                      (val==to_greater)||
+                      (val==to_uncomparable));
+               bucket->res[i] = val;
+            }
+            break;
       default:
-       assert((handle->val.i_val==val.i_val)
-         ||((val.i_val==to_notgteq)
-            &&(handle->val.i_val==to_lesser))
-         ||((val.i_val==to_notleeq)
-            &&(handle->val.i_val==to_greater)));
-       break;
+            assert((old==val)
+                   ||((val==to_notgteq)
+                      &&((old==to_lesser)||(old==to_uncomparable)))
+                   ||((val==to_notleeq)
+                      &&((old==to_greater)||(old==to_uncomparable))));
+            break;
       }
-      return false;
-   }
-   else
-   {
-      res =  QuadTreeStore(cache, &key, val);
-      return res;
+      return;
    }
+   i = bucket_select_victim(cache, bucket);
+   bucket->t1[i]  = k1;
+   bucket->t2[i]  = k2;
+   bucket->res[i] = val;
+   bucket->ref[i] = 0;
 }
 
 
-/*---------------------------------------------------------------------*/
-/*                        End of File                                  */
-/*---------------------------------------------------------------------*/
-
-
-
-
-
+/*-----------------------------------------------------------------------
+//
+// Function: CmpCachePrintStats()
+//
+//   Print the size and the usage counters of the cache.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
 
+void CmpCachePrintStats(FILE* out, CmpCache_p cache)
+{
+   fprintf(out, "# Ordering cache entries               : %ld\n",
+           cache->size*CMP_CACHE_WAYS);
+   fprintf(out, "# Ordering cache hits                  : %ld\n",
+           cache->hits);
+   fprintf(out, "# Ordering cache misses                : %ld\n",
+           cache->misses);
+   fprintf(out, "# Ordering cache evictions             : %ld\n",
+           cache->evictions);
+   fprintf(out, "# Ordering cache resets                : %ld\n",
+           cache->resets);
+}
 
 
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
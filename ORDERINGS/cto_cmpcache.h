@@ -6,8 +6,8 @@ Author: Stephan Schulz
 
 Contents
 
-  Cache structure for the local caching of ordering results for LPO
-  (and potentially RPO and other mainly recursive orderings).
+  Cache structure for memoizing the results of term ordering
+  comparisons between shared terms (used for KBO6 and LPO).
 
   Copyright 1998, 1999 by the author.
   This code is released under the GNU General Public Licence and
@@ -19,6 +19,11 @@ Changes
 
 <1> Sat Dec 25 00:50:42 MET 1999
     New
+<2> Fri Oct 16 2026
+    Replaced splay tree by fixed-capacity, set-associative hash table
+    with clock eviction.
+<3> Sat Oct 17 2026
+    Mark key terms with TPInCmpCache.
 
 -----------------------------------------------------------------------*/
 
@@ -27,7 +32,6 @@ Changes
 #define CTO_CMPCACHE
 
 #include <clb_partial_orderings.h>
-#include <clb_quadtrees.h>
 #include <cte_termbanks.h>
 
 
@@ -35,33 +39,78 @@ Changes
 /*                    Data type declarations                           */
 /*---------------------------------------------------------------------*/
 
-/* Compare results are organized as a quadtree, indexed by terms and
-   deref-counters. Keys are always ordered (smaller key first) to
-   allow retrieval of symmetric comparisons. We do not use a hash
-   table to keep the fixed overhead for easy comparisons small. */
+/* Compare results are stored in a hash table of fixed capacity,
+   indexed by the addresses of the two (shared) terms. Keys are
+   always ordered (larger address first) to allow retrieval of
+   symmetric comparisons. The table is organized in buckets of
+   CMP_CACHE_WAYS entries that fill exactly one cache line. If a
+   bucket is full, a victim is selected with the clock (second
+   chance) algorithm within the bucket.
+
+   Only comparisons between shared terms that are ground or compared
+   without dereferencing are cached, as the result is independent of
+   variable bindings in this case. As keys are term addresses, the
+   whole cache is invalidated whenever shared term cells are freed
+   (see TermCellStoreFreeEpoch). Key terms are marked with
+   TPInCmpCache, so that resetting an arena-backed bank only
+   invalidates the cache if some of its terms have been used. */
+
+#define CMP_CACHE_WAYS      3
+#define CMP_CACHE_LINE_SIZE 64
+
+typedef struct cmpcachebucket
+{
+   Term_p t1[CMP_CACHE_WAYS];   /* NULL for empty entries */
+   Term_p t2[CMP_CACHE_WAYS];
+   char   res[CMP_CACHE_WAYS];  /* CompareResult */
+   char   ref[CMP_CACHE_WAYS];  /* Clock reference bits */
+   char   hand;                 /* Clock hand */
+}__attribute__((aligned(CMP_CACHE_LINE_SIZE))) CmpCacheBucket;
+
+typedef struct cmpcachecell
+{
+   long           size;          /* Number of buckets, power of 2 */
+   int            shift;         /* 64-log2(size) for hashing */
+   CmpCacheBucket *buckets;      /* Aligned to CMP_CACHE_LINE_SIZE */
+   void           *raw_mem;      /* As returned by the allocator */
+   long           epoch;         /* Value of TermCellStoreFreeEpoch
+                                    the entries are valid for */
+   long           hits;
+   long           misses;
+   long           evictions;
+   long           resets;
+}CmpCacheCell, *CmpCache_p;
 
-typedef QuadTree_p CmpCache_p;
 
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
-#define CmpCacheInit(cache)  assert(!(cache))
-#define CmpCacheClear(cache) QuadTreeFree(cache);(cache)=NULL
+#define CmpCacheCellAlloc()    (CmpCacheCell*)SizeMalloc(sizeof(CmpCacheCell))
+#define CmpCacheCellFree(junk) SizeFree(junk, sizeof(CmpCacheCell))
 
-CompareResult CmpCacheFind(CmpCache_p *cache, Term_p t1, DerefType d1,
-            Term_p t2, DerefType d2);
-bool CmpCacheInsert(CmpCache_p *cache, Term_p t1, DerefType d1, Term_p
-          t2, DerefType d2, CompareResult insert);
+/* A cached result answers a full comparison only if it is not one
+   of the partial results of a previous greater-test, it answers a
+   greater-test unless it is to_notleeq. */
+#define CmpCacheResultIsFinal(res) \
+   (((res)!=to_unknown)&&((res)!=to_notgteq)&&((res)!=to_notleeq))
+#define CmpCacheResultDecidesGreater(res) \
+   (((res)!=to_unknown)&&((res)!=to_notleeq))
 
+CmpCache_p    CmpCacheAlloc(long entries);
+void          CmpCacheFree(CmpCache_p junk);
+void          CmpCacheReset(CmpCache_p cache);
+
+CompareResult CmpCacheFind(CmpCache_p cache, Term_p t1, DerefType d1,
+                           Term_p t2, DerefType d2);
+void          CmpCacheInsert(CmpCache_p cache, Term_p t1, DerefType d1,
+                             Term_p t2, DerefType d2,
+                             CompareResult insert);
+
+void          CmpCachePrintStats(FILE* out, CmpCache_p cache);
 
 #endif
 
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
-
-
-
-
-
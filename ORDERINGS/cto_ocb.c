@@ -189,6 +189,7 @@ OCB_p OCBAlloc(TermOrdering type, bool prec_by_weight, Sig_p sig)
    {
       handle->vb[i] = 0;
    }
+   handle->cmp_cache = NULL;
 
    switch(type)
    {
@@ -287,6 +288,10 @@ void OCBFree(OCB_p junk)
       SizeFree(junk->prec_weights, sizeof(long)*(junk->sig_size+1));
       junk->prec_weights = NULL;
    }
+   if(junk->cmp_cache)
+   {
+      CmpCacheFree(junk->cmp_cache);
+   }
    PDArrayFree(junk->min_constants);
    assert(junk);
    assert(junk->vb_size > 0);
@@ -25,7 +25,7 @@
 
 #define CTO_OCB
 
-#include <cte_termbanks.h>
+#include <cto_cmpcache.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -97,6 +97,8 @@ typedef struct ocb_cell
    long          max_var;
    long          vb_size;
    int           *vb;
+   CmpCache_p    cmp_cache;    /* Memoized comparisons of shared
+                                  terms, NULL if disabled */
 }OCBCell, *OCB_p;
 
 #define OCB_FUN_DEFAULT_WEIGHT 1
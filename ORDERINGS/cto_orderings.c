@@ -29,6 +29,10 @@ Changes
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+/* Capacity of the comparison cache of the main OCB, 0 disables
+   caching. */
+long TOCmpCacheSize = 0;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -39,19 +43,12 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
-
-
-/*---------------------------------------------------------------------*/
-/*                         Exported Functions                          */
-/*---------------------------------------------------------------------*/
-
-
 /*-----------------------------------------------------------------------
 //
-// Function: TOGreater()
+// Function: greater_uncached()
 //
 //   Test wether t1 is greater that t2 in the ordering described by
-//   the ocb.
+//   the ocb, without using the comparison cache.
 //
 // Global Variables: -
 //
@@ -59,24 +56,12 @@ Changes
 //
 /----------------------------------------------------------------------*/
 
-bool TOGreater(OCB_p ocb, Term_p s, Term_p t, DerefType deref_s,
-          DerefType deref_t)
+static bool greater_uncached(OCB_p ocb, Term_p s, Term_p t,
+                             DerefType deref_s, DerefType deref_t)
 {
    bool res = false;
    /* Term_p tmp; */
 
-   assert(ocb);
-   assert(s);
-   assert(t);
-   assert(problemType != PROBLEM_HO || ocb->type == KBO6);
-
-   /* OCBDebugPrint(stdout, ocb); */
-   /* printf("TOGreater...\n");
-   TermPrint(stdout, s, ocb->sig, deref_s);
-   printf(" -|- ");
-   TermPrint(stdout, t, ocb->sig, deref_t);
-   printf("\n");*/
-
    switch(ocb->type)
    {
    case LPO:
@@ -94,11 +79,9 @@ bool TOGreater(OCB_p ocb, Term_p s, Term_p t, DerefType deref_s,
     /* TermPrint(stdout, t, ocb->sig, deref_t); */
     /* res1 = D_LPOGreater(ocb,  s, t, deref_s, deref_t);
        printf("# Comparison (greater, debug) done %d\n", res1); */
-    /* CmpCacheInit(ocb->cmp_cache); */
     res = LPOGreater(ocb, s, t, deref_s, deref_t);
     /* printf("# Comparison (greater, current) done %d\n", res); */
     /* assert(res == res1); */
-    /* CmpCacheClear(ocb->cmp_cache); */
     break;
    case LPOCopy:
          res = LPOGreaterCopy(ocb, s, t, deref_s, deref_t);
@@ -128,9 +111,10 @@ bool TOGreater(OCB_p ocb, Term_p s, Term_p t, DerefType deref_s,
 
 /*-----------------------------------------------------------------------
 //
-// Function: TOCompare()
+// Function: compare_uncached()
 //
-//   Compare t1 and t2 in the ordering described by the ocb.
+//   Compare t1 and t2 in the ordering described by the ocb, without
+//   using the comparison cache.
 //
 // Global Variables: -
 //
@@ -138,22 +122,12 @@ bool TOGreater(OCB_p ocb, Term_p s, Term_p t, DerefType deref_s,
 //
 /----------------------------------------------------------------------*/
 
-CompareResult TOCompare(OCB_p ocb, Term_p s, Term_p t, DerefType deref_s,
-          DerefType deref_t)
+static CompareResult compare_uncached(OCB_p ocb, Term_p s, Term_p t,
+                                      DerefType deref_s, DerefType deref_t)
 {
    CompareResult res = to_uncomparable /* , res1 = to_uncomparable*/;
    /* Term_p tmp; */
 
-   assert(ocb);
-   assert(s);
-   assert(t);
-
-   /* printf("TOCompare...\n");
-      TermPrint(stdout, s, ocb->sig, deref_s);
-      printf(" -|- ");
-      TermPrint(stdout, t, ocb->sig, deref_t);
-      printf("\n"); */
-
    switch(ocb->type)
    {
    case LPO:
@@ -172,11 +146,9 @@ CompareResult TOCompare(OCB_p ocb, Term_p s, Term_p t, DerefType deref_s,
     /* printf("\n"); */
     /* res1 = D_LPOCompare(ocb, s, t, deref_s, deref_t);
        printf("# Comparison (debug) done %d\n",res); */
-    /* CmpCacheInit(ocb->cmp_cache); */
     res = LPOCompare(ocb, s, t, deref_s, deref_t);
     /* printf("# Comparison (Compare, current) done %d\n",res); */
     /* assert(res == res1); */
-    /* CmpCacheClear(ocb->cmp_cache); */
     break;
    case LPOCopy:
     res = LPOCompareCopy(ocb, s, t, deref_s, deref_t);
@@ -203,7 +175,124 @@ CompareResult TOCompare(OCB_p ocb, Term_p s, Term_p t, DerefType deref_s,
     assert(false);
     break;
    }
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TOGreater()
+//
+//   Test wether t1 is greater that t2 in the ordering described by
+//   the ocb. If the ocb has a comparison cache, it is consulted
+//   first. For KBO6, a miss is resolved by a full comparison (which
+//   costs the same), for the other orderings only the partial result
+//   is cached. Identical terms never reach the cache (the key of such
+//   a pair has no orientation, so partial results could not be
+//   stored consistently).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the comparison cache
+//
+/----------------------------------------------------------------------*/
+
+bool TOGreater(OCB_p ocb, Term_p s, Term_p t, DerefType deref_s,
+          DerefType deref_t)
+{
+   CompareResult res;
+
+   assert(ocb);
+   assert(s);
+   assert(t);
+   assert(problemType != PROBLEM_HO || ocb->type == KBO6);
+
+   /* OCBDebugPrint(stdout, ocb); */
+   /* printf("TOGreater...\n");
+   TermPrint(stdout, s, ocb->sig, deref_s);
+   printf(" -|- ");
+   TermPrint(stdout, t, ocb->sig, deref_t);
+   printf("\n");*/
+
+   if(!ocb->cmp_cache)
+   {
+      return greater_uncached(ocb, s, t, deref_s, deref_t);
+   }
+   if((s == t) && (deref_s == deref_t))
+   {
+      return false;
+   }
+   res = CmpCacheFind(ocb->cmp_cache, s, deref_s, t, deref_t);
+   if(CmpCacheResultDecidesGreater(res))
+   {
+      return res == to_greater;
+   }
+   if(ocb->type == KBO6)
+   {
+      res = KBO6Compare(ocb, s, t, deref_s, deref_t);
+   }
+   else
+   {
+      res = greater_uncached(ocb, s, t, deref_s, deref_t)?
+         to_greater:to_notgteq;
+   }
+   CmpCacheInsert(ocb->cmp_cache, s, deref_s, t, deref_t, res);
+
+   return res == to_greater;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TOCompare()
+//
+//   Compare t1 and t2 in the ordering described by the ocb, using
+//   the comparison cache if the ocb has one. Identical terms are
+//   equal without a look at the cache.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the comparison cache
+//
+/----------------------------------------------------------------------*/
+
+CompareResult TOCompare(OCB_p ocb, Term_p s, Term_p t, DerefType deref_s,
+          DerefType deref_t)
+{
+   CompareResult res;
+
+   assert(ocb);
+   assert(s);
+   assert(t);
+
+   /* printf("TOCompare...\n");
+      TermPrint(stdout, s, ocb->sig, deref_s);
+      printf(" -|- ");
+      TermPrint(stdout, t, ocb->sig, deref_t);
+      printf("\n"); */
+
+   if(!ocb->cmp_cache)
+   {
+      return compare_uncached(ocb, s, t, deref_s, deref_t);
+   }
+   if((s == t) && (deref_s == deref_t))
+   {
+      return to_equal;
+   }
+   res = CmpCacheFind(ocb->cmp_cache, s, deref_s, t, deref_t);
+   if(CmpCacheResultIsFinal(res))
+   {
+      return res;
+   }
+   res = compare_uncached(ocb, s, t, deref_s, deref_t);
+   CmpCacheInsert(ocb->cmp_cache, s, deref_s, t, deref_t, res);
    /* printf("...TOCompare (%d)\n", res);  */
+
    return res;
 }
 
@@ -43,6 +43,7 @@ Changes
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
+extern long TOCmpCacheSize;
 
 bool          TOGreater(OCB_p ocb, Term_p s, Term_p t, DerefType
          deref_s, DerefType deref_t);
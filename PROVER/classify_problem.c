@@ -869,7 +869,8 @@ int main(int argc, char* argv[])
                ClauseSetPreprocess(fstate->axioms,
                                    fstate->watchlist,
                                    fstate->archive,
-                                   fstate->tmp_terms);
+                                   fstate->tmp_terms,
+                                   false);
             }
             if(!specsig_classify)
             {
@@ -49,6 +49,8 @@ typedef enum
    OPT_OUTPUTLEVEL,
    OPT_GLOBAL_WTCLIMIT,
    OPT_SERVER_LIB,
+   OPT_JOBS,
+   OPT_IMAGE_DIR,
    OPT_DUMMY
 }OptionCodes;
 
@@ -113,6 +115,22 @@ OptCell opts[] =
     ReqArg, NULL,
     "Set the axioms library directory of the server."},
 
+   {OPT_JOBS,
+    'j', "jobs",
+    ReqArg, NULL,
+    "Set the maximal number of jobs run concurrently for each client "
+    "connection. Further jobs are queued until a running job "
+    "terminates."},
+
+   {OPT_IMAGE_DIR,
+    '\0', "image-dir",
+    ReqArg, NULL,
+    "Keep binary images of the axiom sets loaded from the server "
+    "library in the given directory. The LOAD command reads an axiom "
+    "set from its image instead of parsing it as long as the library "
+    "file (and the files it includes) are unchanged, and (re-)writes "
+    "the image otherwise."},
+
    {OPT_NOOPT,
     '\0', NULL,
     NoArg, NULL,
@@ -123,6 +141,7 @@ char              *outname        = NULL;
 char              *server_lib     = NULL;
 long              total_wtc_limit = 0;
 int               port            = -1;
+int               max_jobs        = INTERACTIVE_DEFAULT_MAX_JOBS;
 bool              app_encode      = false;
 ProblemType problemType  = PROBLEM_NOT_INIT;
 
@@ -205,7 +224,8 @@ int main(int argc, char* argv[])
          }
          else if(pid == 0)
          {
-            StartDeductionServer(spec, ctrl, server_lib, NULL, sock_fd);
+            StartDeductionServer(spec, ctrl, server_lib, NULL, sock_fd,
+                                 max_jobs);
             close(sock_fd);
             break;
          }
@@ -213,7 +233,7 @@ int main(int argc, char* argv[])
    }
    else
    {
-      StartDeductionServer(spec, ctrl, server_lib, stdout, -1);
+      StartDeductionServer(spec, ctrl, server_lib, stdout, -1, max_jobs);
    }
 
    StructFOFSpecFree(ctrl);
@@ -284,6 +304,12 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_SERVER_LIB:
             server_lib = arg;
             break;
+      case OPT_JOBS:
+            max_jobs = CLStateGetIntArgCheckRange(handle, arg, 1, 256);
+            break;
+      case OPT_IMAGE_DIR:
+            InteractiveImageDir = arg;
+            break;
       default:
             assert(false && "Unknown option");
             break;
@@ -54,6 +54,8 @@ typedef enum
    OPT_SILENT,
    OPT_OUTPUTLEVEL,
    OPT_GLOBAL_WTCLIMIT,
+   OPT_FORK_RUNNERS,
+   OPT_AXIOM_IMAGE,
    OPT_DUMMY
 }OptionCodes;
 
@@ -132,6 +134,24 @@ OptCell opts[] =
     ReqArg, NULL,
     "Set the global wall-clock limit for each batch (if any)."},
 
+   {OPT_FORK_RUNNERS,
+    '\0', "fork-runners",
+    NoArg, NULL,
+    "Run the proof attempts in processes forked from the runner, which "
+    "work directly on the already parsed axioms, instead of writing "
+    "each filtered problem to a temporary file and running an external "
+    "prover on it. Only the built-in strategies are supported in this "
+    "mode, and the prover argument is ignored."},
+
+   {OPT_AXIOM_IMAGE,
+    '\0', "axiom-image",
+    ReqArg, NULL,
+    "Keep a binary image of the parsed axioms in the given file. If "
+    "the file exists and was created from the same axiom files, the "
+    "axioms are loaded from it instead of being parsed. Otherwise "
+    "(also if one of the axiom files has changed since, or the image "
+    "is damaged), it is (re-)written after parsing."},
+
    {OPT_NOOPT,
     '\0', NULL,
     NoArg, NULL,
@@ -326,6 +346,12 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_GLOBAL_WTCLIMIT:
        total_wtc_limit = CLStateGetIntArg(handle, arg);
        break;
+      case OPT_FORK_RUNNERS:
+            BatchForkRunners = true;
+            break;
+      case OPT_AXIOM_IMAGE:
+            BatchAxiomImage = arg;
+            break;
       default:
        assert(false && "Unknown option");
        break;
@@ -87,7 +87,9 @@ typedef enum
    OPT_SATAUTODEV,
    OPT_AUTO_SCHED,
    OPT_SATAUTO_SCHED,
+   OPT_CORES,
    OPT_NO_PREPROCESSING,
+   OPT_FILTER_GROUND_ENTAILED,
    OPT_EQ_UNFOLD_LIMIT,
    OPT_EQ_UNFOLD_MAXCLAUSES,
    OPT_NO_EQ_UNFOLD,
@@ -120,6 +122,8 @@ typedef enum
    OPT_CONDENSING,
    OPT_CONDENSING_AGGRESSIVE,
    OPT_NO_GC_FORWARD_SIMPL,
+   OPT_GIVEN_BATCH,
+   OPT_GIVEN_BATCH_THREADS,
    OPT_USE_SIM_PARAMOD,
    OPT_USE_ORIENTED_SIM_PARAMOD,
    OPT_USE_SUPERSIM_PARAMOD,
@@ -140,6 +144,7 @@ typedef enum
    OPT_TO_CONSTWEIGHT,
    OPT_TO_PRECEDENCE,
    OPT_TO_LPO_RECLIMIT,
+   OPT_TO_CMP_CACHE,
    OPT_TO_RESTRICT_LIT_CMPS,
    OPT_TO_LIT_CMP,
    OPT_TPTP_SOS,
@@ -159,6 +164,7 @@ typedef enum
    OPT_SATCHECK,
    OPT_SAT_NORMCONST,
    OPT_SAT_NORMALIZE,
+   OPT_SAT_INCREMENTAL,
    OPT_SAT_DEC_LIMIT,
    OPT_WATCHLIST,
    OPT_STATIC_WATCHLIST,
@@ -168,6 +174,7 @@ typedef enum
    OPT_FVINDEX_FEATURETYPES,
    OPT_FVINDEX_MAXFEATURES,
    OPT_FVINDEX_SLACK,
+   OPT_FVINDEX_COLUMNS,
    OPT_RW_BW_INDEX,
    OPT_PM_FROM_INDEX,
    OPT_PM_INTO_INDEX,
@@ -175,6 +182,10 @@ typedef enum
    OPT_FP_NO_SIZECONSTR,
    OPT_PDT_NO_SIZECONSTR,
    OPT_PDT_NO_AGECONSTR,
+   OPT_PDT_FROZEN,
+   OPT_BW_SUBSUMPTION_THREADS,
+   OPT_PM_WORKERS,
+   OPT_PARSE_WORKERS,
    OPT_DETSORT_RW,
    OPT_DETSORT_NEW,
    OPT_DEFINE_WFUN,
@@ -640,6 +651,17 @@ OptCell opts[] =
     "Use the (experimental) strategy scheduling without SInE, thus "
     "maintaining completeness."},
 
+   {OPT_CORES,
+    '\0', "cores",
+    ReqArg, NULL,
+    "Run the strategy schedule as a portfolio on the given number of "
+    "cores. Up to that many strategies are run in parallel, each with "
+    "a correspondingly larger share of the time limit. Time not used "
+    "by failing strategies is passed on to later ones, and all "
+    "strategies are stopped as soon as one of them succeeds. Only "
+    "the output of the successful strategy is printed. The default "
+    "is 1, i.e. strategies are run one after the other."},
+
    {OPT_NO_PREPROCESSING,
     '\0', "no-preprocessing",
     NoArg, NULL,
@@ -649,6 +671,14 @@ OptCell opts[] =
     "anything else happens. Unless limited by one of the following "
     "options, it will also unfold equational definitions."},
 
+   {OPT_FILTER_GROUND_ENTAILED,
+    '\0', "filter-ground-entailed",
+    NoArg, NULL,
+    "During preprocessing, delete all non-unit clauses that contain a "
+    "literal entailed by the ground unit clauses of the problem (modulo "
+    "congruence closure). This is cheap and can help with large ground "
+    "problems, e.g. verification conditions."},
+
    {OPT_EQ_UNFOLD_LIMIT,
     '\0', "eq-unfold-limit",
     ReqArg, NULL,
@@ -900,6 +930,37 @@ OptCell opts[] =
     "can save significant overhead. The option _should_ work in all "
     "cases, but is not expected to improve things in most cases."},
 
+   {OPT_GIVEN_BATCH,
+    '\0', "given-batch",
+    ReqArg, NULL,
+    "Experimental: Select the given number of clauses in each iteration "
+    "of the main loop instead of a single given clause. All members "
+    "of the batch are forward-contracted against the processed set "
+    "as it was before the batch, then they are rechecked, integrated "
+    "and used for generating inferences in order of selection, and "
+    "their new clauses are evaluated and inserted together. The "
+    "forward subsumption tests of the batch can be distributed over "
+    "several threads with --given-batch-threads, all other steps run "
+    "in the main thread. The search is complete and deterministic for "
+    "any batch size and number of threads. Statistics for the batches "
+    "are printed with --print-statistics, and a summary of each batch "
+    "with --verbose=2. A value of 1 selects the classical given-clause "
+    "loop."},
+
+   {OPT_GIVEN_BATCH_THREADS,
+    '\0', "given-batch-threads",
+    ReqArg, NULL,
+    "Distribute the non-unit forward subsumption tests of the members "
+    "of a batch selected with --given-batch over the given number of "
+    "threads (including the main thread). Each candidate subsumer from "
+    "the processed clauses is tested by one thread against all members "
+    "it may subsume. Rewriting and the other simplifications of the "
+    "members remain sequential, as they change the shared term bank. "
+    "The result does not depend on the number of threads. Requires a "
+    "build with thread-safe memory management (USE_SLAB_MEM or "
+    "USE_SYSTEM_MEM). The default build does not qualify, there the "
+    "option is ignored with a warning."},
+
    {OPT_USE_SIM_PARAMOD,
     '\0', "simul-paramod",
     NoArg, NULL,
@@ -1070,6 +1131,16 @@ OptCell opts[] =
     "If the problem persists, send a bug report ;-)"
    },
 
+   {OPT_TO_CMP_CACHE,
+    '\0', "ordering-cache",
+    OptArg, "65536",
+    "Memoize the results of term ordering comparisons between shared "
+    "terms in a hash table with room for the given number of "
+    "comparisons. When the table is full, old entries are evicted. "
+    "The cache is cleared whenever shared terms are garbage "
+    "collected. By default, no cache is used."
+   },
+
    {OPT_TO_RESTRICT_LIT_CMPS,
     '\0', "restrict-literal-comparisons",
     NoArg, NULL,
@@ -1214,6 +1285,14 @@ OptCell opts[] =
     "Enable re-simplification (heuristic re-revaluation) of unprocessed "
     "clauses before grounding for SAT checking."},
 
+   {OPT_SAT_INCREMENTAL,
+    '\0', "satcheck-incremental",
+    NoArg, NULL,
+    "Keep the SAT solver (and what it has learned) between SAT checks. "
+    "Only clauses that are new since the last check are grounded and "
+    "added, clauses that have been deleted are disabled via "
+    "assumptions. This makes frequent SAT checks much cheaper."},
+
    {OPT_WATCHLIST,
     '\0', "watchlist",
     OptArg, WATCHLIST_INLINE_QSTRING,
@@ -1295,6 +1374,15 @@ OptCell opts[] =
     "be deleted from the index anyways, but will still waste "
     "(a little) time in computing feature vectors."},
 
+   {OPT_FVINDEX_COLUMNS,
+    '\0', "fvindex-columns",
+    NoArg, NULL,
+    "Store the feature vectors of processed non-unit clauses in "
+    "column-major blocks instead of a trie, and select subsumption "
+    "candidates with a (SIMD, if available) block-wise comparison of "
+    "all features. This may pay off for large sets of processed "
+    "clauses."},
+
    {OPT_RW_BW_INDEX,
     '\0', "rw-bw-index",
     OptArg, "FP7",
@@ -1347,6 +1435,55 @@ OptCell opts[] =
     "Disable usage of age constraints for matching with perfect "
     "discrimination trees indexing."},
 
+   {OPT_PDT_FROZEN,
+    '\0', "pdt-frozen",
+    NoArg, NULL,
+    "Search perfect discrimination trees for demodulation via a "
+    "compact, frozen copy with all nodes in contiguous arrays. The copy "
+    "is rebuilt after bulk insertions and whenever enough searches have "
+    "happened since the last change of the index to amortize the "
+    "rebuild. Only used for first-order problems."},
+
+   {OPT_BW_SUBSUMPTION_THREADS,
+    '\0', "bw-subsumption-threads",
+    ReqArg, NULL,
+    "Distribute the subsumption tests of backward subsumption over the "
+    "given number of threads (including the main thread). Only this "
+    "phase is parallelized, backward rewriting and backward contextual "
+    "simplify-reflect remain sequential. The subsumed clauses, the order "
+    "in which they are removed, and thus the whole search do not depend "
+    "on the number of threads. Requires a build with thread-safe memory "
+    "management (USE_SLAB_MEM or USE_SYSTEM_MEM). The default build "
+    "does not qualify, there the option is ignored with a warning."},
+
+   {OPT_PM_WORKERS,
+    '\0', "pm-workers",
+    ReqArg, NULL,
+    "Distribute the generation of paramodulants for a given clause over "
+    "the given number of forked worker processes, once there are enough "
+    "processed clauses. The workers are started once and kept up to date "
+    "with the paramodulation indices. For each given clause, the same "
+    "clauses are generated as without workers. Their order is the same "
+    "for any number of workers greater than one, but it can differ from "
+    "the order without workers, so the search can differ from a run "
+    "without this option. Only used for first-order problems. Each "
+    "worker may use the CPU time that is left when it is started, which "
+    "is not counted in the prover's own CPU time."},
+
+   {OPT_PARSE_WORKERS,
+    '\0', "parse-workers",
+    ReqArg, NULL,
+    "Parse and clausify the input in the given number of forked worker "
+    "processes. Symbols, formulas and clauses are numbered exactly as "
+    "with sequential processing, Skolem symbols and definitions "
+    "introduced by the workers are renumbered in input order. Include "
+    "files of untyped TPTP input are parsed by their own workers, "
+    "other input files are split only if they have at least 1 MB. "
+    "Input read from stdin or in other formats is always parsed "
+    "sequentially. Formulas are clausified in parallel if there are "
+    "at least 256 of them, no inferences are documented, and no proof "
+    "object or full derivation is printed."},
+
    {OPT_DETSORT_RW,
     '\0', "detsort-rw",
     NoArg, NULL,
@@ -525,6 +525,8 @@ int main(int argc, char* argv[])
    GCRegisterClauseSet(collector, demodulators[0]);
 
    build_rw_system(demodulators[0], clauses);
+   /* The rewrite system does not change anymore */
+   PDTreeFreeze(demodulators[0]->demod_index);
 
 
    GCDeregisterClauseSet(collector, clauses);
@@ -30,6 +30,7 @@
 #include <ccl_formulafunc.h>
 #include <cte_simpletypes.h>
 #include <cco_scheduling.h>
+#include <cco_parallel_parse.h>
 #include <e_version.h>
 
 
@@ -85,6 +86,7 @@ long              step_limit = LONG_MAX,
    relevance_prune_level = 0,
    miniscope_limit = 1048576;
 long long tb_insert_limit = LLONG_MAX;
+int               sched_cores = 1;
 
 int force_deriv_output = 0;
 char  *outdesc = DEFAULT_OUTPUT_DESCRIPTOR,
@@ -155,13 +157,12 @@ ProofState_p parse_spec(CLState_p state,
          DocOutputFormat = pcl_format;
       }
 
-      FormulaAndClauseSetParse(in,
-                               proofstate->f_axioms,
-                               proofstate->watchlist,
-                               proofstate->terms,
-                               NULL,
-                               &skip_includes);
-      CheckInpTok(in, NoToken);
+      FormulaAndClauseSetParsePar(in,
+                                  proofstate->f_axioms,
+                                  proofstate->watchlist,
+                                  proofstate->terms,
+                                  &skip_includes,
+                                  ParseWorkers);
       DestroyScanner(in);
    }
    VERBOUT2("Specification read\n");
@@ -229,6 +230,8 @@ static void print_info(void)
 //                   BWRWMatchSuccesses,
 //                   CondensationAttempts,
 //                   CondensationSuccesses,
+//                   SubstBorrowCount,
+//                   SubstBorrowAllocCount,
 //                   (possibly) UnifAttempts,
 //                   (possibly) UnifSuccesses,
 //                   (possibly) PDTNodeCounter
@@ -250,6 +253,7 @@ static void print_info(void)
 /----------------------------------------------------------------------*/
 
 static void print_proof_stats(ProofState_p proofstate,
+                              OCB_p ocb,
                               long parsed_ax_no,
                               long relevancy_pruned,
                               long raw_clause_no,
@@ -285,6 +289,10 @@ static void print_proof_stats(ProofState_p proofstate,
               CondensationAttempts);
       fprintf(GlobalOut, "# Condensation successes               : %ld\n",
               CondensationSuccesses);
+      fprintf(GlobalOut, "# Scratch substitutions borrowed       : %ld\n",
+              SubstBorrowCount);
+      fprintf(GlobalOut, "# Scratch substitutions allocated      : %ld\n",
+              SubstBorrowAllocCount);
 
 #ifdef MEASURE_UNIFICATION
       fprintf(GlobalOut, "# Unification attempts                 : %ld\n",
@@ -298,6 +306,10 @@ static void print_proof_stats(ProofState_p proofstate,
 #endif
       fprintf(GlobalOut, "# Termbank termtop insertions          : %lld\n",
               proofstate->terms->insertions);
+      if(ocb->cmp_cache)
+      {
+         CmpCachePrintStats(GlobalOut, ocb->cmp_cache);
+      }
       PERF_CTR_PRINT(GlobalOut, MguTimer);
       PERF_CTR_PRINT(GlobalOut, SatTimer);
       PERF_CTR_PRINT(GlobalOut, ParamodTimer);
@@ -414,11 +426,6 @@ int main(int argc, char* argv[])
       goto cleanup1;
    }
 
-   if(strategy_scheduling)
-   {
-      ExecuteSchedule(StratSchedule, h_parms, print_rusage);
-   }
-
    FormulaSetDocInital(GlobalOut, OutputLevel, proofstate->f_axioms);
    ClauseSetDocInital(GlobalOut, OutputLevel, proofstate->axioms);
 
@@ -446,13 +453,18 @@ int main(int argc, char* argv[])
 
    if(new_cnf)
    {
-      cnf_size = FormulaSetCNF2(proofstate->f_axioms,
-                                proofstate->f_ax_archive,
-                                proofstate->axioms,
-                                proofstate->terms,
-                                proofstate->freshvars,
-                                proofstate->gc_terms,
-                                miniscope_limit);
+      /* Variables of other than the default type are numbered
+         differently by clausification in worker processes, so keep
+         it sequential if the derivation is printed */
+      cnf_size = FormulaSetCNF2Par(proofstate->f_axioms,
+                                   proofstate->f_ax_archive,
+                                   proofstate->axioms,
+                                   proofstate->terms,
+                                   proofstate->freshvars,
+                                   proofstate->gc_terms,
+                                   miniscope_limit,
+                                   (PrintProofObject || print_full_deriv)?
+                                   1:ParseWorkers);
    }
    else
    {
@@ -483,7 +495,18 @@ int main(int argc, char* argv[])
       preproc_removed = ClauseSetPreprocess(proofstate->axioms,
                                             proofstate->watchlist,
                                             proofstate->archive,
-                                            proofstate->tmp_terms);
+                                            proofstate->tmp_terms,
+                                            h_parms->filter_ground_entailed);
+   }
+
+   /* Everything up to here is independent of the search strategy, so
+      the schedule forks from the preprocessed state. Each child only
+      has to set up ordering, selection and heuristic (and unfold
+      definitions, which is controlled by the strategy). */
+   if(strategy_scheduling)
+   {
+      ExecuteScheduleMultiCore(StratSchedule, h_parms, print_rusage,
+                               sched_cores);
    }
 
    proofcontrol = ProofControlAlloc();
@@ -759,6 +782,7 @@ int main(int argc, char* argv[])
    fflush(GlobalOut);
 
    print_proof_stats(proofstate,
+                     proofcontrol->ocb,
                      parsed_ax_no,
                      relevancy_pruned,
                      raw_clause_no,
@@ -790,12 +814,15 @@ int main(int argc, char* argv[])
 #endif
 cleanup1:
 #ifndef FAST_EXIT
+   BWSubsumptionWorkersFree();
+   GivenBatchWorkersFree();
    ProofStateFree(proofstate);
    CLStateFree(state);
    PStackFree(hcb_definitions);
    PStackFree(wfcb_definitions);
    FVIndexParmsFree(fvi_parms);
    HeuristicParmsFree(h_parms);
+   SubstPoolFree();
 #ifdef FULL_MEM_STATS
    MemFreeListPrint(GlobalOut);
 #endif
@@ -1107,9 +1134,16 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_SATAUTO_SCHED:
             strategy_scheduling = true;
             break;
+      case OPT_CORES:
+            sched_cores = CLStateGetIntArgCheckRange(handle, arg, 1,
+                                                     SCHED_MAX_CORES);
+            break;
       case OPT_NO_PREPROCESSING:
             h_parms->no_preproc = true;
             break;
+      case OPT_FILTER_GROUND_ENTAILED:
+            h_parms->filter_ground_entailed = true;
+            break;
       case OPT_EQ_UNFOLD_LIMIT:
             h_parms->eqdef_incrlimit = CLStateGetIntArg(handle, arg);
             break;
@@ -1234,6 +1268,20 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_NO_GC_FORWARD_SIMPL:
             h_parms->enable_given_forward_simpl = false;
             break;
+      case OPT_GIVEN_BATCH:
+            h_parms->given_batch_size =
+               CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      case OPT_GIVEN_BATCH_THREADS:
+            GivenBatchThreads = CLStateGetIntArgCheckRange(handle, arg,
+                                                           1, 256);
+            if(GivenBatchThreads > 1 && !ThreadPoolMemIsSafe)
+            {
+               Warning("Memory management is not thread safe, "
+                       "ignoring --given-batch-threads");
+               GivenBatchThreads = 1;
+            }
+            break;
       case OPT_DISABLE_EQ_FACTORING:
             h_parms->enable_eq_factoring = false;
             inf_sys_complete = false;
@@ -1426,6 +1474,15 @@ CLState_p process_options(int argc, char* argv[])
                        "--lpo-recursion-limit may lead to stack "
                        "overflows and segmentation faults.");
             }
+            break;
+      case OPT_TO_CMP_CACHE:
+            TOCmpCacheSize = CLStateGetIntArg(handle, arg);
+            if(TOCmpCacheSize<=0)
+            {
+               Error("Argument to option --ordering-cache "
+                     "has to be > 0", USAGE_ERROR);
+            }
+            break;
       case OPT_TO_RESTRICT_LIT_CMPS:
             h_parms->order_params.lit_cmp = LCNoCmp;
             break;
@@ -1519,6 +1576,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_SAT_NORMALIZE:
             h_parms->sat_check_normalize = true;
             break;
+      case OPT_SAT_INCREMENTAL:
+            h_parms->sat_check_incremental = true;
+            break;
       case OPT_SAT_DEC_LIMIT:
             h_parms->sat_check_decision_limit =
                CLStateGetIntArgCheckRange(handle, arg, -1, INT_MAX);
@@ -1620,6 +1680,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_FVINDEX_SLACK:
             fvi_parms->symbol_slack = CLStateGetIntArgCheckRange(handle, arg, 0, LONG_MAX);
             break;
+      case OPT_FVINDEX_COLUMNS:
+            fvi_parms->use_columns = true;
+            break;
       case OPT_RW_BW_INDEX:
             check_fp_index_arg(arg, "--rw-bw-index");
             strcpy(h_parms->rw_bw_index_type, arg);
@@ -1644,6 +1707,26 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_PDT_NO_AGECONSTR:
             PDTreeUseAgeConstraints = false;
             break;
+      case OPT_PDT_FROZEN:
+            PDTreeUseFrozen = true;
+            break;
+      case OPT_BW_SUBSUMPTION_THREADS:
+            BWSubsumptionThreads = CLStateGetIntArgCheckRange(handle, arg,
+                                                              1, 256);
+            if(BWSubsumptionThreads > 1 && !ThreadPoolMemIsSafe)
+            {
+               Warning("Memory management is not thread safe, "
+                       "ignoring --bw-subsumption-threads");
+               BWSubsumptionThreads = 1;
+            }
+            break;
+      case OPT_PM_WORKERS:
+            ParamodWorkers = CLStateGetIntArgCheckRange(handle, arg, 1,
+                                                        PM_MAX_WORKERS);
+            break;
+      case OPT_PARSE_WORKERS:
+            ParseWorkers = CLStateGetIntArgCheckRange(handle, arg, 1, 256);
+            break;
       case OPT_DETSORT_RW:
             h_parms->detsort_bw_rw = true;
             break;
@@ -0,0 +1,244 @@
+/*-----------------------------------------------------------------------
+
+File  : tb_bench.c
+
+Author: agent (agent@local)
+
+Contents
+
+  Simple benchmark for term bank insertion throughput: Read a set of
+  problems, then repeatedly copy all input formulas into a fresh term
+  bank and report how many term cell insertions per second the term
+  cell store handles.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Fri Oct 16 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <cio_initio.h>
+#include <ccl_formulafunc.h>
+
+#define VERSION "0.1 - Fri Oct 16 2026"
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_VERBOSE,
+   OPT_ROUNDS
+}OptionCodes;
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+   {OPT_VERBOSE,
+    'v', "verbose",
+    OptArg, "1",
+    "Verbose comments on the progress of the program."},
+   {OPT_ROUNDS,
+    'r', "rounds",
+    ReqArg, NULL,
+    "Number of times the input is copied into a fresh term bank. The "
+    "default is 100."},
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+long rounds = 100;
+bool app_encode = false;
+ProblemType problemType  = PROBLEM_NOT_INIT;
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[]);
+void print_help(FILE* out);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: copy_formulas()
+//
+//   Insert all formulas from set into bank.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes bank
+//
+/----------------------------------------------------------------------*/
+
+static void copy_formulas(TB_p bank, FormulaSet_p set)
+{
+   WFormula_p handle;
+
+   for(handle = set->anchor->succ; handle!=set->anchor; handle =
+          handle->succ)
+   {
+      TBInsertNoProps(bank, handle->tformula, DEREF_NEVER);
+   }
+}
+
+
+int main(int argc, char* argv[])
+{
+   CLState_p          state;
+   Scanner_p          in;
+   Sig_p              sig;
+   TB_p               terms, bank;
+   FormulaSet_p       fset;
+   ClauseSet_p        wlset;
+   StrTree_p          skip_includes = NULL;
+   unsigned long long insertions = 0;
+   long               cells = 0, i;
+   long long          start, time_used;
+
+   assert(argv[0]);
+   InitIO(argv[0]);
+
+   state = process_options(argc, argv);
+
+   if(state->argc ==  0)
+   {
+      CLStateInsertArg(state, "-");
+   }
+
+   sig   = SigAlloc(TypeBankAlloc());
+   SigInsertInternalCodes(sig);
+   terms = TBAlloc(sig);
+   fset  = FormulaSetAlloc();
+   wlset = ClauseSetAlloc();
+
+   for(i=0; state->argv[i]; i++)
+   {
+      in = CreateScanner(StreamTypeFile, state->argv[i] , true, NULL, true);
+      ScannerSetFormat(in, TSTPFormat);
+      FormulaAndClauseSetParse(in, fset, wlset, terms, NULL, &skip_includes);
+      CheckInpTok(in, NoToken);
+      DestroyScanner(in);
+   }
+
+   start = GetUSecClock();
+   for(i=0; i<rounds; i++)
+   {
+      bank = TBAlloc(sig);
+      copy_formulas(bank, fset);
+      insertions += bank->insertions;
+      cells       = TBNonVarTermNodes(bank);
+      bank->sig   = NULL;
+      TBFree(bank);
+   }
+   time_used = GetUSecClock()-start;
+
+   fprintf(GlobalOut, "# Formulas           : %ld\n", FormulaSetCardinality(fset));
+   fprintf(GlobalOut, "# Term cells per bank: %ld\n", cells);
+   fprintf(GlobalOut, "# Rounds             : %ld\n", rounds);
+   fprintf(GlobalOut, "# Termtop insertions : %llu\n", insertions);
+   fprintf(GlobalOut, "# Time (s)           : %.3f\n", time_used/1000000.0);
+   fprintf(GlobalOut, "# Insertions/s       : %.0f\n",
+           time_used?insertions/(time_used/1000000.0):0.0);
+
+   FormulaSetFree(fset);
+   ClauseSetFree(wlset);
+   StrTreeFree(skip_includes);
+   terms->sig = NULL;
+   TBFree(terms);
+   TypeBankFree(sig->type_bank);
+   SigFree(sig);
+   CLStateFree(state);
+   ExitIO();
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, Verbose, rounds
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_VERBOSE:
+            Verbose = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_ROUNDS:
+            rounds = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   return state;
+}
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+\n\
+tb_bench "VERSION"\n\
+\n\
+Usage: tb_bench [options] [files]\n\
+\n\
+Read a set of TPTP/TSTP problems, then repeatedly copy all formulas\n\
+into a fresh term bank and report the term bank insertion throughput.\n\
+\n");
+   PrintOptions(stdout, opts, "Options\n\n");
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
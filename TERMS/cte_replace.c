@@ -77,8 +77,8 @@ void TermAddRWLink(Term_p term, Term_p replace, struct clause_cell *demod, bool
       TermCellSetProp(term, TPIsRRewritten);
    }
 
-   TermRWReplaceField(term) = replace;
-   TermRWDemodField(term)   = demod;
+   TermRWState(term)->rw_desc.replace = replace;
+   TermRWState(term)->rw_desc.demod   = demod;
 
    if(sos)
    {
@@ -105,6 +105,12 @@ void TermDeleteRWLink(Term_p term)
 
    TermCellDelProp(term, TPIsRewritten|TPIsRRewritten|TPIsSOSRewritten);
 
+#ifdef TERM_COMPACT_LAYOUT
+   if(!term->rw_data)
+   {
+      return;
+   }
+#endif
    TermRWReplaceField(term) = NULL;
    TermRWDemodField(term)   = 0;
 }
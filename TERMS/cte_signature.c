@@ -16,6 +16,7 @@
   Run "eprover -h" for contact information.
 
   Created:  Sun Sep 21 19:27:54 MET DST 1997
+  Sat Oct 17 2026: Names are interned in a hash table (f_index).
 
 -----------------------------------------------------------------------*/
 
@@ -66,6 +67,24 @@ static void sig_print_operator(FILE* out, Sig_p sig, FunCode op, bool comments)
    }
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: cmp_func_names()
+//
+//   qsort() comparison function for pointers to FuncCells, comparing
+//   names.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int cmp_func_names(const void* f1, const void* f2)
+{
+   return strcmp((*(const Func_p*)f1)->name, (*(const Func_p*)f2)->name);
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: sig_compute_alpha_ranks()
@@ -80,17 +99,20 @@ static void sig_print_operator(FILE* out, Sig_p sig, FunCode op, bool comments)
 
 static void sig_compute_alpha_ranks(Sig_p sig)
 {
-   PStack_p stack;
-   long count = 0;
-   StrTree_p handle;
-
-   stack = StrTreeTraverseInit(sig->f_index);
+   Func_p  *order;
+   FunCode i;
 
-   while((handle = StrTreeTraverseNext(stack)))
+   order = SecureMalloc((sig->f_count+1)*sizeof(Func_p));
+   for(i=1; i<=sig->f_count; i++)
    {
-      sig->f_info[handle->val1.i_val].alpha_rank = count++;
+      order[i] = &(sig->f_info[i]);
    }
-   StrTreeTraverseExit(stack);
+   qsort(order+1, sig->f_count, sizeof(Func_p), cmp_func_names);
+   for(i=1; i<=sig->f_count; i++)
+   {
+      order[i]->alpha_rank = i-1;
+   }
+   FREE(order);
 
    sig->alpha_ranks_valid = true;
 }
@@ -124,7 +146,7 @@ Sig_p SigAlloc(TypeBank_p bank)
    handle->f_count        = 0;
    handle->f_info         =
       SecureMalloc(sizeof(FuncCell)*DEFAULT_SIGNATURE_SIZE);
-   handle->f_index = NULL;
+   handle->f_index = StrHashAlloc();
    handle->ac_axioms = PStackAlloc();
 
    handle->type_bank = bank;
@@ -263,10 +285,10 @@ void SigFree(Sig_p junk)
    assert(junk);
    assert(junk->f_info);
 
-   /* names are shared with junk->f_index and are free()ed by the
-      StrTreeFree() call below! */
+   /* names are interned in junk->f_index and are free()ed by the
+      StrHashFree() call below! */
    FREE(junk->f_info);
-   StrTreeFree(junk->f_index);
+   StrHashFree(junk->f_index);
    PStackFree(junk->ac_axioms);
    if(junk->orn_codes)
    {
@@ -292,9 +314,9 @@ void SigFree(Sig_p junk)
 
 FunCode SigFindFCode(Sig_p sig, const char* name)
 {
-   StrTree_p entry;
+   StrHashEntry_p entry;
 
-   entry = StrTreeFind(&(sig->f_index), name);
+   entry = StrHashFind(sig->f_index, name);
 
    if(entry)
    {
@@ -575,13 +597,15 @@ void SigSetAllSpecial(Sig_p sig, bool value)
 
 FunCode SigInsertId(Sig_p sig, const char* name, int arity, bool special_id)
 {
-   long      pos;
-   StrTree_p new, test;
+   long           pos;
+   bool           is_new;
+   StrHashEntry_p entry;
 
-   pos = SigFindFCode(sig, name);
+   entry = StrHashInsert(sig->f_index, name, &is_new);
 
-   if(pos) /* name is already known */
+   if(!is_new) /* name is already known */
    {
+      pos = entry->val1.i_val;
       if(sig->f_info[pos].arity != arity)
       {
          printf("Problem: %s %d != %d\n", name, arity, sig->f_info[pos].arity);
@@ -602,20 +626,14 @@ FunCode SigInsertId(Sig_p sig, const char* name, int arity, bool special_id)
                                    sizeof(FuncCell)*sig->size);
    }
 
-   /* Insert the element in f_index and f_info */
+   /* Fill in the new f_index entry and f_info */
    sig->f_count++;
-   sig->f_info[sig->f_count].name
-      = SecureStrdup(name);
+   entry->val1.i_val = sig->f_count;
+   sig->f_info[sig->f_count].name = entry->key;
    sig->f_info[sig->f_count].arity = arity;
    sig->f_info[sig->f_count].properties = FPIgnoreProps;
    sig->f_info[sig->f_count].type = NULL;
    sig->f_info[sig->f_count].feature_offset = -1;
-   new = StrTreeCellAllocEmpty();
-   new->key = sig->f_info[sig->f_count].name;
-   new->val1.i_val = sig->f_count;
-
-   test = StrTreeInsert(&(sig->f_index), new);
-   UNUSED(test); assert(test == NULL);
    SigSetSpecial(sig,sig->f_count,special_id);
    sig->alpha_ranks_valid = false;
 
@@ -18,6 +18,8 @@
 
   <1> Thu Mar  5 00:22:28 MET 1998
   New
+  <2> Sat Oct 17 2026
+  Pool of scratch substitutions
 
   -----------------------------------------------------------------------*/
 
@@ -30,6 +32,11 @@
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+THREAD_LOCAL Subst_p SubstPool[SUBST_POOL_SIZE];
+THREAD_LOCAL int     SubstPoolCount        = 0;
+THREAD_LOCAL long    SubstBorrowCount      = 0;
+THREAD_LOCAL long    SubstBorrowAllocCount = 0;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -46,6 +53,28 @@
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: SubstPoolFree()
+//
+//   Free the scratch substitutions pooled by the current thread.
+//
+// Global Variables: SubstPool, SubstPoolCount
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SubstPoolFree(void)
+{
+   while(SubstPoolCount)
+   {
+      SubstPoolCount--;
+      SubstFree(SubstPool[SubstPoolCount]);
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function:  SubstBacktrackSingle()
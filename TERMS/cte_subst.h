@@ -20,6 +20,7 @@
   Changes
 
   Created: Thu Mar  5 00:22:28 MET 1998
+  Sat Oct 17 2026: Pool of scratch substitutions (SubstBorrow()).
 
   -----------------------------------------------------------------------*/
 
@@ -29,6 +30,7 @@
 
 #include <clb_pstacks.h>
 #include <clb_pqueue.h>
+#include <clb_threadpool.h>
 #include <cte_termbanks.h>
 
 /*---------------------------------------------------------------------*/
@@ -38,6 +40,12 @@
 typedef PStackCell SubstCell;
 typedef PStack_p   Subst_p;
 
+/* Scratch substitutions for short-lived uses (e.g. one matching
+   attempt) are borrowed from a small per-thread pool and returned
+   (backtracked) to it, so that the hot paths do not allocate. */
+
+#define SUBST_POOL_SIZE 16
+
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
@@ -49,6 +57,15 @@ typedef PStack_p   Subst_p;
 #define SubstDeleteSkolem(junk) SubstBacktrackSkolem(junk);SubstFree(junk)
 #define SubstIsEmpty(subst) PStackEmpty(subst)
 
+extern THREAD_LOCAL Subst_p SubstPool[SUBST_POOL_SIZE];
+extern THREAD_LOCAL int     SubstPoolCount;
+extern THREAD_LOCAL long    SubstBorrowCount;
+extern THREAD_LOCAL long    SubstBorrowAllocCount;
+
+static inline Subst_p SubstBorrow(void);
+static inline void    SubstReturn(Subst_p subst);
+void                  SubstPoolFree(void);
+
 static inline PStackPointer SubstAddBinding(Subst_p subst, Term_p var, Term_p bind);
 bool          SubstBacktrackSingle(Subst_p subst);
 int           SubstBacktrackToPos(Subst_p subst, PStackPointer pos);
@@ -107,6 +124,62 @@ PStackPointer SubstAddBinding(Subst_p subst, Term_p var, Term_p bind)
    return ret;
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: SubstBorrow()
+//
+//   Return an empty substitution from the pool of the current thread
+//   (or a new one if the pool is empty). Give it back with
+//   SubstReturn().
+//
+// Global Variables: SubstPool, SubstPoolCount, SubstBorrowCount,
+//                   SubstBorrowAllocCount
+//
+// Side Effects    : Memory operations (rarely)
+//
+/----------------------------------------------------------------------*/
+
+static inline Subst_p SubstBorrow(void)
+{
+   SubstBorrowCount++;
+   if(LIKELY(SubstPoolCount))
+   {
+      SubstPoolCount--;
+      assert(SubstIsEmpty(SubstPool[SubstPoolCount]));
+      return SubstPool[SubstPoolCount];
+   }
+   SubstBorrowAllocCount++;
+   return SubstAlloc();
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SubstReturn()
+//
+//   Backtrack a substitution obtained from SubstBorrow() and return
+//   it to the pool (or free it if the pool is full).
+//
+// Global Variables: SubstPool, SubstPoolCount
+//
+// Side Effects    : Backtracks bindings, memory operations (rarely)
+//
+/----------------------------------------------------------------------*/
+
+static inline void SubstReturn(Subst_p subst)
+{
+   SubstBacktrack(subst);
+   if(LIKELY(SubstPoolCount < SUBST_POOL_SIZE))
+   {
+      SubstPool[SubstPoolCount++] = subst;
+   }
+   else
+   {
+      SubstFree(subst);
+   }
+}
+
 #endif
 
 /*---------------------------------------------------------------------*/
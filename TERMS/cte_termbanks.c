@@ -23,6 +23,10 @@
   Changes
 
   Created: Sat Nov 15 16:26:30 MET 1997
+  Sat Oct 17 2026: TBTermFsumWeight()
+  Sat Oct 17 2026: Arena-backed term banks
+  Sat Oct 17 2026: TBArenaReset() only invalidates comparison caches
+                   if needed
 
   -----------------------------------------------------------------------*/
 
@@ -45,6 +49,14 @@ bool TBPrintDetails = false;      /* Collect potentially expensive
                                      various sub-data structures) and
                                      print them if required */
 
+/* Last cache id handed out by TBWeightCacheNewId() */
+static long weight_cache_ids = 0;
+
+/* Cached weights are stored as 2*w+1, so that 0 (the initial value
+   of PDArray entries) means "not yet computed" */
+#define WCACHE_ENCODE(w) (2*(w)+1)
+#define WCACHE_DECODE(v) (((v)-1)/2)
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -56,6 +68,53 @@ typedef Term_p (*TermParseFun)(Scanner_p in, TB_p bank);
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: tb_term_fsum_weight()
+//
+//   Compute TermFsumWeight() for term, using and filling the memo
+//   table cache for shared subterms.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long tb_term_fsum_weight(PDArray_p cache, Term_p term,
+                                long vweight, long flimit,
+                                long *fweights, long default_fweight,
+                                long* typefreqs)
+{
+   long res;
+
+   if(TermIsVar(term))
+   {
+      return vweight;
+   }
+   if(TermIsShared(term))
+   {
+      res = PDArrayElementInt(cache, term->entry_no);
+      if(res)
+      {
+         return WCACHE_DECODE(res);
+      }
+   }
+   res = TermFsumTopWeight(term, flimit, fweights, default_fweight,
+                           typefreqs);
+   for(int i = 0; i < term->arity; i++)
+   {
+      res += tb_term_fsum_weight(cache, term->args[i], vweight, flimit,
+                                 fweights, default_fweight, typefreqs);
+   }
+   if(TermIsShared(term))
+   {
+      PDArrayAssignInt(cache, term->entry_no, WCACHE_ENCODE(res));
+   }
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: tb_print_dag()
@@ -115,6 +174,32 @@ static void tb_print_dag(FILE *out, NumTree_p in_index, Sig_p sig)
    tb_print_dag(out, in_index->rson, sig);
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: tb_arena_cell()
+//
+//   Move the (unshared) top cell t into the arena of bank and return
+//   the copy. The argument pointers and an out-of-line rewrite state
+//   (if any) are taken over, t is freed.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static Term_p tb_arena_cell(TB_p bank, Term_p t)
+{
+   size_t size = sizeof(TermCell)+t->arity*sizeof(Term_p);
+   Term_p res  = BumpArenaMalloc(bank->arena, size);
+
+   memcpy(res, t, size);
+   TermCellFree(t, t->arity);
+
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: tb_termtop_insert()
@@ -151,7 +236,19 @@ static Term_p tb_termtop_insert(TB_p bank, Term_p t)
    }
    bank->insertions++;
 
-   new = TermCellStoreInsert(&(bank->term_store), t);
+   if(bank->arena)
+   {
+      new = TermCellStoreFind(&(bank->term_store), t);
+      if(!new)
+      {
+         t = tb_arena_cell(bank, t);
+         TermCellStoreInsert(&(bank->term_store), t);
+      }
+   }
+   else
+   {
+      new = TermCellStoreInsert(&(bank->term_store), t);
+   }
 
    if(new) /* Term node already existed, just add properties */
    {
@@ -618,6 +715,7 @@ TB_p TBAlloc(Sig_p sig)
    handle->garbage_state = TPIgnoreProps;
    handle->sig = sig;
    handle->vars = VarBankAlloc(sig->type_bank);
+   handle->arena = NULL;
    TermCellStoreInit(&(handle->term_store));
 
    term = TermConstCellAlloc(SIG_TRUE_CODE);
@@ -631,11 +729,37 @@ TB_p TBAlloc(Sig_p sig)
    handle->false_term = TBInsert(handle, term, DEREF_NEVER);
    TermFree(term);
    handle->min_terms   = PDArrayAlloc(16, 0);
+   handle->weight_caches = NULL;
    //handle->freevarsets = NULL;
    return handle;
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: TBArenaAlloc()
+//
+//   Allocate a term bank for short-lived temporary terms. Term cells
+//   are allocated from an arena, and are all released with
+//   TBArenaReset() instead of by garbage collection.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+TB_p TBArenaAlloc(Sig_p sig)
+{
+   TB_p handle = TBAlloc(sig);
+
+   /* true_term and false_term are ordinary cells and survive resets */
+   handle->arena = BumpArenaAlloc();
+
+   return handle;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: TBFree()
@@ -655,14 +779,89 @@ void TBFree(TB_p junk)
 
    /* printf("TBFree(): %ld\n", TermCellStoreNodes(&(junk->term_store)));
     */
+   if(junk->arena)
+   {
+      TBArenaReset(junk);
+      BumpArenaFree(junk->arena);
+   }
    TermCellStoreExit(&(junk->term_store));
    PDArrayFree(junk->ext_index);
    VarBankFree(junk->vars);
    PDArrayFree(junk->min_terms);
+   if(junk->weight_caches)
+   {
+      for(long i=0; i<PDArraySize(junk->weight_caches); i++)
+      {
+         if(PDArrayElementP(junk->weight_caches, i))
+         {
+            PDArrayFree(PDArrayElementP(junk->weight_caches, i));
+         }
+      }
+      PDArrayFree(junk->weight_caches);
+   }
    //assert(!junk->freevarsets);
    TBCellFree(junk);
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBArenaReset()
+//
+//   Release all terms of an arena-backed bank except for true_term
+//   and false_term. All other pointers to terms in the bank become
+//   invalid! Entry numbers are not reused. Returns the number of
+//   released term cells. Ordering comparison caches are only
+//   invalidated if one of the released terms is a cache key.
+//
+// Global Variables: TermCellStoreFreeEpoch
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long TBArenaReset(TB_p bank)
+{
+   long res, i;
+   bool cached = false;
+
+   assert(bank->arena);
+
+   res = TermCellStoreNodes(&(bank->term_store))-2;
+   for(i=0; res && i<TermCellStoreSize(&(bank->term_store)); i++)
+   {
+      Term_p t = TermCellStoreSlot(&(bank->term_store), i);
+
+      if(!t || t == bank->true_term || t == bank->false_term)
+      {
+         continue;
+      }
+      if(TermCellQueryProp(t, TPInCmpCache))
+      {
+         cached = true;
+      }
+#ifdef TERM_COMPACT_LAYOUT
+      if(t->rw_data)
+      {
+         RewriteStateCellFree(t->rw_data);
+      }
+#endif
+   }
+   TermCellStoreClear(&(bank->term_store));
+   TermCellStoreInsert(&(bank->term_store), bank->true_term);
+   TermCellStoreInsert(&(bank->term_store), bank->false_term);
+   for(i=0; i<PDArraySize(bank->min_terms); i++)
+   {
+      PDArrayAssignP(bank->min_terms, i, NULL);
+   }
+   BumpArenaReset(bank->arena);
+   if(cached)
+   {
+      TermCellStoreFreeEpoch++;
+   }
+   return res;
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: TBVarSetStoreFree()
@@ -682,6 +881,64 @@ void TBVarSetStoreFree(TB_p bank)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: TBWeightCacheNewId()
+//
+//   Return a new cache id for TBTermFsumWeight(). Each weight
+//   function (i.e. each set of weight parameters) needs its own id.
+//
+// Global Variables: weight_cache_ids
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long TBWeightCacheNewId(void)
+{
+   return ++weight_cache_ids;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBTermFsumWeight()
+//
+//   Return TermFsumWeight() of term (which has to be from bank). The
+//   weights of shared subterms are memoized in the table for
+//   cache_id, so that repeated evaluations of a term (or of terms
+//   sharing subterms with it) are O(1) per already known
+//   subterm. The weight parameters for a given cache_id must never
+//   change.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long TBTermFsumWeight(TB_p bank, long cache_id, Term_p term,
+                      long vweight, long flimit, long *fweights,
+                      long default_fweight, long* typefreqs)
+{
+   PDArray_p cache;
+
+   assert(cache_id > 0);
+   if(!bank->weight_caches)
+   {
+      bank->weight_caches = PDArrayAlloc(4, 0);
+   }
+   cache = PDArrayElementP(bank->weight_caches, cache_id);
+   if(!cache)
+   {
+      cache = PDIntArrayAlloc(1024, 0);
+      PDArrayAssignP(bank->weight_caches, cache_id, cache);
+   }
+   return tb_term_fsum_weight(cache, term, vweight, flimit, fweights,
+                              default_fweight, typefreqs);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: TBTermNodes()
@@ -738,8 +995,8 @@ Term_p TBInsert(TB_p bank, Term_p term, DerefType deref)
    {
       t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
 
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
+      assert(SysDateIsCreationDate(TermNFDateField(t,0)));
+      assert(SysDateIsCreationDate(TermNFDateField(t,1)));
 
       for(i=0; i<t->arity; i++)
       {
@@ -784,8 +1041,8 @@ Term_p TBInsertNoProps(TB_p bank, Term_p term, DerefType deref)
       t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
       t->properties = TPIgnoreProps;
 
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
+      assert(SysDateIsCreationDate(TermNFDateField(t,0)));
+      assert(SysDateIsCreationDate(TermNFDateField(t,1)));
 
       for(i=0; i<t->arity; i++)
       {
@@ -838,8 +1095,8 @@ Term_p  TBInsertRepl(TB_p bank, Term_p term, DerefType deref, Term_p old, Term_p
       t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
       t->properties = TPIgnoreProps;
 
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
+      assert(SysDateIsCreationDate(TermNFDateField(t,0)));
+      assert(SysDateIsCreationDate(TermNFDateField(t,1)));
 
       for(i=0; i<t->arity; i++)
       {
@@ -889,8 +1146,8 @@ Term_p TBInsertReplPlain(TB_p bank, Term_p term, Term_p old, Term_p repl)
       t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
       t->properties = TPIgnoreProps;
 
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
+      assert(SysDateIsCreationDate(TermNFDateField(t,0)));
+      assert(SysDateIsCreationDate(TermNFDateField(t,1)));
 
       for(i=0; i<t->arity; i++)
       {
@@ -963,8 +1220,8 @@ Term_p TBInsertInstantiatedFO(TB_p bank, Term_p term)
       t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
       t->properties    = TPIgnoreProps;
 
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
+      assert(SysDateIsCreationDate(TermNFDateField(t,0)));
+      assert(SysDateIsCreationDate(TermNFDateField(t,1)));
 
       for(i=0; i<t->arity; i++)
       {
@@ -1021,8 +1278,8 @@ Term_p TBInsertInstantiatedHO(TB_p bank, Term_p term, bool follow_bind)
       t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
       t->properties    = TPIgnoreProps;
 
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
+      assert(SysDateIsCreationDate(TermNFDateField(t,0)));
+      assert(SysDateIsCreationDate(TermNFDateField(t,1)));
 
       for(i=0; i<t->arity; i++)
       {
@@ -1100,8 +1357,8 @@ Term_p TBInsertOpt(TB_p bank, Term_p term, DerefType deref)
    {
       t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
 
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
+      assert(SysDateIsCreationDate(TermNFDateField(t,0)));
+      assert(SysDateIsCreationDate(TermNFDateField(t,1)));
 
       for(i=0; i<t->arity; i++)
       {
@@ -1150,8 +1407,8 @@ Term_p  TBInsertDisjoint(TB_p bank, Term_p term)
    {
       t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
 
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
+      assert(SysDateIsCreationDate(TermNFDateField(t,0)));
+      assert(SysDateIsCreationDate(TermNFDateField(t,1)));
 
       for(i=0; i<t->arity; i++)
       {
@@ -1246,19 +1503,17 @@ void TBPrintBankInOrder(FILE* out, TB_p bank)
 {
    NumTree_p tree = NULL;
    long i;
-   PStack_p stack;
    Term_p   cell;
    IntOrP   dummy;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<TermCellStoreSize(&(bank->term_store)); i++)
    {
-      stack = TermTreeTraverseInit(bank->term_store.store[i]);
-      while((cell = TermTreeTraverseNext(stack)))
+      cell = TermCellStoreSlot(&(bank->term_store), i);
+      if(cell)
       {
          dummy.p_val = cell;
          NumTreeStore(&tree, cell->entry_no,dummy, dummy);
       }
-      TermTreeTraverseExit(stack);
    }
    tb_print_dag(out, tree, bank->sig);
    NumTreeFree(tree);
@@ -1357,30 +1612,18 @@ void TBPrintTerm(FILE* out, TB_p bank, Term_p term, bool fullterms)
 
 void TBPrintBankTerms(FILE* out, TB_p bank)
 {
-   PStack_p stack = PStackAlloc();
    Term_p term;
-   int i;
+   long i;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<TermCellStoreSize(&(bank->term_store)); i++)
    {
-      PStackPushP(stack, bank->term_store.store[i]);
-
-      while(!PStackEmpty(stack))
+      term = TermCellStoreSlot(&(bank->term_store), i);
+      if(term && TermCellQueryProp(term, TPTopPos))
       {
-         term = PStackPopP(stack);
-         if(term)
-         {
-            PStackPushP(stack, term->lson);
-            PStackPushP(stack, term->rson);
-            if(TermCellQueryProp(term, TPTopPos))
-            {
-               TBPrintTermCompact(out, bank, term);
-               fprintf(out, "\n");
-            }
-         }
+         TBPrintTermCompact(out, bank, term);
+         fprintf(out, "\n");
       }
    }
-   PStackFree(stack);
 }
 
 
@@ -1799,6 +2042,7 @@ long TBGCSweep(TB_p bank)
    Term_p t;
 
    assert(bank);
+   assert(!bank->arena);
    assert(!TermIsRewritten(bank->true_term));
    TBGCMarkTerm(bank, bank->true_term);
    TBGCMarkTerm(bank, bank->false_term);
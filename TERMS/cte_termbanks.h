@@ -25,6 +25,8 @@
   Changes
 
   Created: Mon Sep 22 00:15:39 MET DST 1997
+  Sat Oct 17 2026: Memoized per-bank term weights for weight functions
+  Sat Oct 17 2026: Arena-backed banks for temporary terms
 
   -----------------------------------------------------------------------*/
 
@@ -36,6 +38,7 @@
 #include <cio_basicparser.h>
 #include <cte_varsets.h>
 #include <cte_termcellstore.h>
+#include <clb_bumparena.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -88,6 +91,20 @@ typedef struct tbcell
                                     they want to both access terms via
                                     references and do replacing! */
    TermCellStoreCell term_store; /* Here are the terms */
+   PDArray_p     weight_caches;  /* Memoized weights of shared terms
+                                    for weight functions, indexed by
+                                    a cache id from
+                                    TBWeightCacheNewId(). Each entry
+                                    is a PDArray indexed by entry_no
+                                    (which is never reused, so
+                                    entries of collected terms are
+                                    harmless). Allocated lazily. */
+   BumpArena_p   arena;          /* If not NULL, new term cells are
+                                    copied into this arena, and all
+                                    terms (except for true_term and
+                                    false_term) are released at once
+                                    by TBArenaReset(). Such banks do
+                                    not support garbage collection. */
 }TBCell, *TB_p;
 
 
@@ -106,11 +123,18 @@ extern bool TBPrintDetails;
 #define TBSortTable(tb) (tb->vars->sort_table)
 
 TB_p    TBAlloc(Sig_p sig);
+TB_p    TBArenaAlloc(Sig_p sig);
 void    TBFree(TB_p junk);
+long    TBArenaReset(TB_p bank);
 
 void    TBVarSetStoreFree(TB_p bank);
 
 long    TBTermNodes(TB_p bank);
+
+long    TBWeightCacheNewId(void);
+long    TBTermFsumWeight(TB_p bank, long cache_id, Term_p term,
+                         long vweight, long flimit, long *fweights,
+                         long default_fweight, long* typefreqs);
 #define TBNonVarTermNodes(bank) TermCellStoreNodes(&(bank)->term_store)
 #define TBStorage(bank)                                 \
    (TERMCELL_DYN_MEM*(bank)->term_store.entries         \
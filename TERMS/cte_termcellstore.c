@@ -19,6 +19,12 @@ Changes
 
 <1> Mon Oct  5 01:09:50 MEST 1998
     New
+<2> Fri Oct 16 2026
+    Open-addressing hash table instead of splay tree buckets.
+<3> Sat Oct 17 2026
+    TermCellStoreClear()
+<4> Sat Oct 17 2026
+    Cache hashes in the slots.
 
 -----------------------------------------------------------------------*/
 
@@ -30,6 +36,10 @@ Changes
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+/* Incremented whenever shared term cells are freed, so that caches
+   indexed by term cell addresses can detect stale entries. */
+long TermCellStoreFreeEpoch = 0;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -43,10 +53,10 @@ Changes
 
 /*-----------------------------------------------------------------------
 //
-// Function: collect_unmarked_termcells()
+// Function: tcs_term_equal()
 //
-//   Push the addresses of all unmarked term cells in the tree onto
-//   the stack.
+//   Return true if the two term cells have the same top symbol and
+//   the same (shared) arguments.
 //
 // Global Variables: -
 //
@@ -54,29 +64,153 @@ Changes
 //
 /----------------------------------------------------------------------*/
 
-static void collect_unmarked_termcells(PStack_p res_stack, Term_p tree,
-                   TermProperties gc_state)
+static inline bool tcs_term_equal(Term_p t1, Term_p t2)
+{
+   int i;
+
+   if((t1->f_code != t2->f_code) || (t1->arity != t2->arity))
+   {
+      return false;
+   }
+   for(i=0; i<t1->arity; i++)
+   {
+      if(t1->args[i] != t2->args[i])
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tcs_find_slot()
+//
+//   Return the index of the slot containing a term cell equal to
+//   term (with hash value hash), or of the empty slot where it would
+//   be inserted.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline long tcs_find_slot(TermCellStore_p store, Term_p term,
+                                 uint64_t hash)
+{
+   long mask = store->size-1;
+   long i    = hash&mask;
+
+   while(store->store[i].term &&
+         ((store->store[i].hash != hash) ||
+          !tcs_term_equal(store->store[i].term, term)))
+   {
+      i = (i+1)&mask;
+   }
+   return i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tcs_alloc_slots()
+//
+//   Allocate and clear an array of size slots.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static TermCellSlot_p tcs_alloc_slots(long size)
 {
-   PStack_p stack = PStackAlloc();
+   TermCellSlot_p res = SizeMalloc(size*sizeof(TermCellSlotCell));
+
+   memset(res, 0, size*sizeof(TermCellSlotCell));
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tcs_grow()
+//
+//   Double the size of the table and move all entries (using the
+//   cached hashes).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes store.
+//
+/----------------------------------------------------------------------*/
+
+static void tcs_grow(TermCellStore_p store)
+{
+   TermCellSlot_p old_store = store->store;
+   long           old_size  = store->size, i, mask, j;
+
+   store->size  = old_size*2;
+   store->store = tcs_alloc_slots(store->size);
+   mask         = store->size-1;
+
+   for(i=0; i<old_size; i++)
+   {
+      if(old_store[i].term)
+      {
+         j = old_store[i].hash&mask;
+         while(store->store[j].term)
+         {
+            j = (j+1)&mask;
+         }
+         store->store[j] = old_store[i];
+      }
+   }
+   SizeFree(old_store, old_size*sizeof(TermCellSlotCell));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tcs_clear_slot()
+//
+//   Remove the entry in slot i, moving later entries of the same
+//   probe sequence back so that no tombstones are needed.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes store.
+//
+/----------------------------------------------------------------------*/
 
-   PStackPushP(stack, tree);
+static void tcs_clear_slot(TermCellStore_p store, long i)
+{
+   long mask = store->size-1, j = i, k;
 
-   while(!PStackEmpty(stack))
+   while(true)
    {
-      tree = PStackPopP(stack);
-      if(tree)
+      j = (j+1)&mask;
+      if(!store->store[j].term)
       {
-    if(GiveProps(tree,TPGarbageFlag)==gc_state)
-    {
-       PStackPushP(res_stack, tree);
-    }
-    PStackPushP(stack, tree->lson);
-    PStackPushP(stack, tree->rson);
+         break;
       }
+      k = store->store[j].hash&mask;
+      /* Entry at j can stay if its home slot k is cyclically in
+         (i,j] */
+      if((i<=j)?((i<k)&&(k<=j)):((i<k)||(k<=j)))
+      {
+         continue;
+      }
+      store->store[i] = store->store[j];
+      i = j;
    }
-   PStackFree(stack);
+   store->store[i].term = NULL;
 }
 
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -89,29 +223,25 @@ static void collect_unmarked_termcells(PStack_p res_stack, Term_p tree,
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations
 //
 /----------------------------------------------------------------------*/
 
 void TermCellStoreInit(TermCellStore_p store)
 {
-   int i;
-
-   store->entries = 0;
+   store->entries   = 0;
    store->arg_count = 0;
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
-   {
-      store->store[i] = NULL;
-   }
+   store->size      = TERM_STORE_INIT_SIZE;
+   store->store     = tcs_alloc_slots(store->size);
 }
 
 /*-----------------------------------------------------------------------
 //
 // Function: TermCellStoreExit()
 //
-//   Free the trees in a term cell storage.
+//   Free the term cells and the table of a term cell storage.
 //
-// Global Variables: -
+// Global Variables: TermCellStoreFreeEpoch
 //
 // Side Effects    : Memory operations
 //
@@ -119,13 +249,51 @@ void TermCellStoreInit(TermCellStore_p store)
 
 void TermCellStoreExit(TermCellStore_p store)
 {
-   int i;
+   long i;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   TermCellStoreFreeEpoch++;
+   for(i=0; i<store->size; i++)
+   {
+      if(store->store[i].term && !TermIsVar(store->store[i].term))
+      {
+         TermTopFree(store->store[i].term);
+      }
+   }
+   SizeFree(store->store, store->size*sizeof(TermCellSlotCell));
+   store->store   = NULL;
+   store->size    = 0;
+   store->entries = 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermCellStoreClear()
+//
+//   Remove all entries from the store without freeing the term cells
+//   (which must be managed elsewhere, e.g. in an arena). A table that
+//   has grown large is shrunk back to its initial size.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes store.
+//
+/----------------------------------------------------------------------*/
+
+void TermCellStoreClear(TermCellStore_p store)
+{
+   if(store->size > TERM_STORE_KEEP_SIZE)
    {
-      TermTreeFree(store->store[i]);
-      store->store[i] = NULL;
+      SizeFree(store->store, store->size*sizeof(TermCellSlotCell));
+      store->size  = TERM_STORE_INIT_SIZE;
+      store->store = tcs_alloc_slots(store->size);
    }
+   else
+   {
+      memset(store->store, 0, store->size*sizeof(TermCellSlotCell));
+   }
+   store->entries   = 0;
+   store->arg_count = 0;
 }
 
 
@@ -143,8 +311,7 @@ void TermCellStoreExit(TermCellStore_p store)
 
 Term_p  TermCellStoreFind(TermCellStore_p store, Term_p term)
 {
-   return TermTreeFind(&(store->store[TermCellHash(term)]), term);
-
+   return store->store[tcs_find_slot(store, term, TermCellHash(term))].term;
 }
 
 
@@ -152,7 +319,8 @@ Term_p  TermCellStoreFind(TermCellStore_p store, Term_p term)
 //
 // Function: TermCellStoreInsert()
 //
-//   Insert a term cell into the store.
+//   Insert a term cell into the store. If an equal cell already
+//   exists, return it, otherwise return NULL.
 //
 // Global Variables: -
 //
@@ -162,15 +330,22 @@ Term_p  TermCellStoreFind(TermCellStore_p store, Term_p term)
 
 Term_p  TermCellStoreInsert(TermCellStore_p store, Term_p term)
 {
-   Term_p ret;
+   uint64_t hash = TermCellHash(term);
+   long     i    = tcs_find_slot(store, term, hash);
 
-   ret = TermTreeInsert(&(store->store[TermCellHash(term)]), term);
-   if(!ret)
+   if(store->store[i].term)
    {
-      store->entries++;
-      store->arg_count+=term->arity;
+      return store->store[i].term;
    }
-   return ret;
+   store->store[i].term = term;
+   store->store[i].hash = hash;
+   store->entries++;
+   store->arg_count+=term->arity;
+   if(4*store->entries > 3*store->size)
+   {
+      tcs_grow(store);
+   }
+   return NULL;
 }
 
 /*-----------------------------------------------------------------------
@@ -187,12 +362,14 @@ Term_p  TermCellStoreInsert(TermCellStore_p store, Term_p term)
 
 Term_p  TermCellStoreExtract(TermCellStore_p store, Term_p term)
 {
-   Term_p ret;
-   ret = TermTreeExtract(&(store->store[TermCellHash(term)]), term);
+   long   i   = tcs_find_slot(store, term, TermCellHash(term));
+   Term_p ret = store->store[i].term;
+
    if(ret)
    {
+      tcs_clear_slot(store, i);
       store->entries--;
-      store->arg_count-=term->arity;
+      store->arg_count-=ret->arity;
    }
    assert(store->entries>=0);
    return ret;
@@ -205,7 +382,7 @@ Term_p  TermCellStoreExtract(TermCellStore_p store, Term_p term)
 //
 //   Delete a node from the store.
 //
-// Global Variables: -
+// Global Variables: TermCellStoreFreeEpoch
 //
 // Side Effects    : Changes store
 //
@@ -213,17 +390,16 @@ Term_p  TermCellStoreExtract(TermCellStore_p store, Term_p term)
 
 bool TermCellStoreDelete(TermCellStore_p store, Term_p term)
 {
-   bool ret;
-
-   ret = TermTreeDelete(&(store->store[TermCellHash(term)]), term);
+   Term_p cell;
 
-   if(ret)
+   cell = TermCellStoreExtract(store, term);
+   if(cell)
    {
-      store->entries--;
-      store->arg_count-=term->arity;
+      TermCellStoreFreeEpoch++;
+      TermTopFree(cell);
+      return true;
    }
-   assert(store->entries>=0);
-   return ret;
+   return false;
 }
 
 
@@ -241,11 +417,14 @@ bool TermCellStoreDelete(TermCellStore_p store, Term_p term)
 
 void TermCellStoreSetProp(TermCellStore_p store, TermProperties props)
 {
-   int i;
+   long i;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<store->size; i++)
    {
-      TermTreeSetProp(store->store[i], props);
+      if(store->store[i].term)
+      {
+         TermCellSetProp(store->store[i].term, props);
+      }
    }
 }
 
@@ -263,11 +442,14 @@ void TermCellStoreSetProp(TermCellStore_p store, TermProperties props)
 
 void TermCellStoreDelProp(TermCellStore_p store, TermProperties props)
 {
-   int i;
+   long i;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<store->size; i++)
    {
-      TermTreeDelProp(store->store[i], props);
+      if(store->store[i].term)
+      {
+         TermCellDelProp(store->store[i].term, props);
+      }
    }
 }
 
@@ -287,11 +469,14 @@ void TermCellStoreDelProp(TermCellStore_p store, TermProperties props)
 long TermCellStoreCountNodes(TermCellStore_p store)
 {
    long res = 0;
-   int i;
+   long i;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<store->size; i++)
    {
-      res+=TermTreeNodes(store->store[i]);
+      if(store->store[i].term)
+      {
+         res++;
+      }
    }
    return res;
 }
@@ -303,9 +488,8 @@ long TermCellStoreCountNodes(TermCellStore_p store)
 //
 //   Sweep the term cell store and free unmarked cells. Return number
 //   of cells recovered. Note that we separate the collection of
-//   unmarked terms from the actual deletion, since walking the trees
-//   while they may be reorganized is somewhere between messy and
-//   impossible.
+//   unmarked terms from the actual deletion, since deleting moves
+//   entries around in the table.
 //
 // Global Variables: -
 //
@@ -316,20 +500,24 @@ long TermCellStoreCountNodes(TermCellStore_p store)
 long TermCellStoreGCSweep(TermCellStore_p store, TermProperties gc_state)
 {
    long recovered = 0;
-   int i;
+   long i;
    PStack_p del_stack = PStackAlloc();
    Term_p cell;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<store->size; i++)
    {
-      collect_unmarked_termcells(del_stack, store->store[i], gc_state);
-      while(!PStackEmpty(del_stack))
+      cell = store->store[i].term;
+      if(cell && (GiveProps(cell,TPGarbageFlag)==gc_state))
       {
-    cell = PStackPopP(del_stack);
-    TermCellStoreDelete(store, cell);
-    recovered++;
+         PStackPushP(del_stack, cell);
       }
    }
+   while(!PStackEmpty(del_stack))
+   {
+      cell = PStackPopP(del_stack);
+      TermCellStoreDelete(store, cell);
+      recovered++;
+   }
    PStackFree(del_stack);
    return recovered;
 }
@@ -339,8 +527,8 @@ long TermCellStoreGCSweep(TermCellStore_p store, TermProperties gc_state)
 //
 // Function: TermCellStorePrintDistrib()
 //
-//   For each entry (hash value) in store, print the number of term
-//   cells in the corresponding tree.
+//   Print the size and fill of the table and, for each probe length,
+//   the number of entries found after that many probes.
 //
 // Global Variables: -
 //
@@ -350,17 +538,29 @@ long TermCellStoreGCSweep(TermCellStore_p store, TermProperties gc_state)
 
 void TermCellStorePrintDistrib(FILE* out, TermCellStore_p store)
 {
-   int i;
+   long     i, dist, mask = store->size-1;
+   PDArray_p distrib = PDIntArrayAlloc(8, 8);
+   long     max_dist = 0;
 
-   for(i=0; i<TERM_STORE_HASH_SIZE; i++)
+   for(i=0; i<store->size; i++)
+   {
+      if(store->store[i].term)
+      {
+         dist = (i-(long)(store->store[i].hash&mask))&mask;
+         PDArrayElementIncInt(distrib, dist, 1);
+         max_dist = MAX(max_dist, dist);
+      }
+   }
+   fprintf(out, "# Term store: %ld entries in %ld slots\n",
+           store->entries, store->size);
+   for(i=0; i<=max_dist; i++)
    {
-      fprintf(out, "# Hash %4d: %6ld\n", i, TermTreeNodes(store->store[i]));
+      fprintf(out, "# Probes %4ld: %6ld\n", i+1,
+              PDArrayElementInt(distrib, i));
    }
+   PDArrayFree(distrib);
 }
 
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
-
-
-
@@ -6,11 +6,10 @@ Author: Stephan Schulz
 
 Contents
 
-  Abstract interface for storing term cells, implemented by a
-  combination of a hashed array and term cell trees. Use
-  (term->f_code^term->args[1])&TERM_STORE_HASH_MASK  as
-  hash if args != NULL, otherwise use
-  term->f_code&TERM_STORE_HASH_MASK.
+  Abstract interface for storing term cells, implemented by an
+  open-addressing hash table (with linear probing) that grows with
+  the number of entries. The hash key is the f_code, the arity and
+  all argument pointers of the term cell.
 
   Copyright 1998, 1999 by the author.
   This code is released under the GNU General Public Licence and
@@ -25,6 +24,13 @@ Changes
 <2> Thu Apr 11 10:08:26 CEST 2002
     Support for mark-and-sweep garbage collection (the sweep pass) for
     term cells
+<3> Fri Oct 16 2026
+    Replaced fixed array of splay trees by resizable hash table.
+<4> Sat Oct 17 2026
+    TermCellStoreClear() for arena-backed term banks.
+<5> Sat Oct 17 2026
+    Slots cache the hash of their entry, larger initial table, grow
+    at 3/4 load.
 
 -----------------------------------------------------------------------*/
 
@@ -38,14 +44,28 @@ Changes
 /*                    Data type declarations                           */
 /*---------------------------------------------------------------------*/
 
-#define TERM_STORE_HASH_SIZE (8192*4)
-#define TERM_STORE_HASH_MASK (TERM_STORE_HASH_SIZE-1)
+/* Initial number of slots, must be a power of 2. The table is
+   doubled whenever it becomes more than 3/4 full. */
+#define TERM_STORE_INIT_SIZE 4096
+
+/* TermCellStoreClear() shrinks tables larger than this */
+#define TERM_STORE_KEEP_SIZE 4096
+
+/* Each slot caches the hash of its entry, so that probing only looks
+   at the term cell itself when the hashes match, and growing the table
+   does not touch the term cells at all. */
+typedef struct termcellslot
+{
+   Term_p   term;    /* NULL if empty */
+   uint64_t hash;    /* TermCellHash(term) */
+}TermCellSlotCell, *TermCellSlot_p;
 
 typedef struct termcellstore
 {
-   long   entries;
-   long   arg_count;
-   Term_p store[TERM_STORE_HASH_SIZE];
+   long           entries;
+   long           arg_count;
+   long           size;      /* Number of slots, power of 2 */
+   TermCellSlot_p store;
 }TermCellStoreCell, *TermCellStore_p;
 
 
@@ -53,18 +73,18 @@ typedef struct termcellstore
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
-#define tcs_arity0hash(term) ((term)->f_code)
-#define tcs_arity1hash(term) (tcs_arity0hash(term)^(((intptr_t)(term)->args[0])>>3))
-#define tcs_aritynhash(term) (tcs_arity1hash(term)^(((intptr_t)(term)->args[1])>>4))
+#define TCS_HASH_MULT 0x9e3779b97f4a7c15ULL
 
-#define TermCellHash(term)\
-((((term)->arity == 0)?\
-  tcs_arity0hash(term):\
-  (((term)->arity == 1)?tcs_arity1hash(term):tcs_aritynhash(term)))\
-   &TERM_STORE_HASH_MASK)
+static inline uint64_t TermCellHash(Term_p term);
+
+extern long TermCellStoreFreeEpoch;
+
+#define TermCellStoreSize(tcs)        ((tcs)->size)
+#define TermCellStoreSlot(tcs, i)     ((tcs)->store[(i)].term)
 
 void    TermCellStoreInit(TermCellStore_p store);
 void    TermCellStoreExit(TermCellStore_p store);
+void    TermCellStoreClear(TermCellStore_p store);
 
 Term_p  TermCellStoreFind(TermCellStore_p store, Term_p term);
 Term_p  TermCellStoreInsert(TermCellStore_p store, Term_p term);
@@ -83,6 +103,37 @@ long    TermCellStoreGCSweep(TermCellStore_p store, TermProperties gc_state );
 
 void    TermCellStorePrintDistrib(FILE* out, TermCellStore_p store);
 
+
+/*---------------------------------------------------------------------*/
+/*                       Inline-Functions                              */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermCellHash()
+//
+//   Compute a hash value for a term cell from its f_code, its arity
+//   and all argument pointers (which are unique in the term bank).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static inline uint64_t TermCellHash(Term_p term)
+{
+   uint64_t res = ((uint64_t)term->f_code)*TCS_HASH_MULT;
+   int      i;
+
+   res ^= term->arity;
+   for(i=0; i<term->arity; i++)
+   {
+      res = (res^(((uintptr_t)term->args[i])>>4))*TCS_HASH_MULT;
+   }
+   return res^(res>>29);
+}
+
 #endif
 
 /*---------------------------------------------------------------------*/
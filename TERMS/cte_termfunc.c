@@ -1229,6 +1229,56 @@ long TermWeightCompute(Term_p term, long vweight, long fweight)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: TermFsumTopWeight()
+//
+//   Return the contribution of the top symbol of a non-variable term
+//   to TermFsumWeight().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long TermFsumTopWeight(Term_p term, long flimit, long *fweights,
+                       long default_fweight, long* typefreqs)
+{
+   long res = 0;
+
+   assert(!TermIsVar(term));
+   if(term->f_code < flimit)
+   {
+      if(!TermIsAppliedVar(term))
+      {
+         res += fweights[term->f_code];
+      }
+      else
+      {
+         assert(problemType == PROBLEM_HO);
+         if(typefreqs && typefreqs[term->args[0]->type->type_uid])
+         {
+            assert(typefreqs[term->args[0]->type->type_uid] > 0);
+            res += typefreqs[term->args[0]->type->type_uid];
+         }
+      }
+   }
+   else
+   {
+      if(!TermIsAppliedVar(term))
+      {
+         res += default_fweight;
+      }
+      else
+      {
+         assert(problemType == PROBLEM_HO);
+      }
+   }
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: TermFsumWeight()
@@ -1254,35 +1304,8 @@ long TermFsumWeight(Term_p term, long vweight, long flimit,
    }
    else
    {
-      if(term->f_code < flimit)
-      {
-         if(!TermIsAppliedVar(term))
-         {
-            res += fweights[term->f_code];
-         }
-         else
-         {
-            assert(problemType == PROBLEM_HO);
-            if(typefreqs && typefreqs[term->args[0]->type->type_uid])
-            {
-               assert(typefreqs[term->args[0]->type->type_uid] > 0);
-               res += typefreqs[term->args[0]->type->type_uid];
-            }
-         }
-      }
-      else
-      {
-         if(!TermIsAppliedVar(term))
-         {
-            res += default_fweight;
-         }
-         else
-         {
-            assert(problemType == PROBLEM_HO);
-         }
-
-      }
-
+      res += TermFsumTopWeight(term, flimit, fweights, default_fweight,
+                               typefreqs);
       for(int i = 0; i < term->arity; i++)
       {
          res += TermFsumWeight(term->args[i], vweight, flimit, fweights, default_fweight,
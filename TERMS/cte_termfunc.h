@@ -98,6 +98,8 @@ long    TermWeightCompute(Term_p term, long vweight, long fweight);
          (assert((term)->weight == TermDefaultWeight((term))),(term)->weight) : \
          TermDefaultWeight((term)))
 
+long    TermFsumTopWeight(Term_p term, long flimit, long *fweights,
+                          long default_fweight, long* typefreqs);
 long    TermFsumWeight(Term_p term, long vweight, long flimit,
                        long *fweights, long default_fweight, long* typefreqs);
 
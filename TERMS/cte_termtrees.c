@@ -21,11 +21,14 @@ Changes
     New
 <2> Thu Jan 28 00:59:59 MET 1999
     Replaced AVL trees with Splay-Trees
+<3> Fri Oct 16 2026
+    Not available with TERM_COMPACT_LAYOUT
 
 -----------------------------------------------------------------------*/
 
 #include "cte_termtrees.h"
 
+#ifndef TERM_COMPACT_LAYOUT
 
 
 /*---------------------------------------------------------------------*/
@@ -469,6 +472,8 @@ long TermTreeNodes(Term_p root)
 
 AVL_TRAVERSE_DEFINITION(TermTree, Term_p)
 
+#endif
+
 
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
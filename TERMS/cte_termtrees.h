@@ -27,6 +27,8 @@ Changes
     New
 <2> Thu Jan 28 00:59:59 MET 1999
     Replaced AVL trees with Splay-Trees
+<3> Fri Oct 16 2026
+    Not available with TERM_COMPACT_LAYOUT
 
 
 -----------------------------------------------------------------------*/
@@ -48,6 +50,9 @@ Changes
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
 
+/* The compact term cell layout has no splay tree links */
+#ifndef TERM_COMPACT_LAYOUT
+
 void   TermTreeFree(Term_p junk);
 long   TermTopCompare(Term_p t1, Term_p t2);
 Term_p TermTreeFind(Term_p *root, Term_p term);
@@ -61,6 +66,8 @@ long   TermTreeNodes(Term_p root);
 AVL_TRAVERSE_DECLARATION(TermTree, Term_p)
 #define TermTreeTraverseExit(stack) PStackFree(stack)
 
+#endif
+
 
 #endif
 
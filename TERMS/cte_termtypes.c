@@ -211,6 +211,12 @@ void clear_stale_cache(Term_p app_var)
 void TermTopFree(Term_p junk)
 {
    assert(junk);
+#ifdef TERM_COMPACT_LAYOUT
+   if(junk->rw_data)
+   {
+      RewriteStateCellFree(junk->rw_data);
+   }
+#endif
    TermCellFree(junk, junk->arity);
 }
 
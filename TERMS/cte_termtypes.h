@@ -86,6 +86,8 @@ typedef enum
                                    this occurs with negative polarity. */
    TPIsDerefedAppVar  = 1<<20,  /* Is the object obtained as a cache
                                    for applied variables -- dbg purposes */
+   TPInCmpCache       = 1<<21,  /* Term has been used as a key in an
+                                   ordering comparison cache */
 }TermProperties;
 
 
@@ -132,11 +134,19 @@ typedef struct termcell
    long             weight;        /* Weight of the term, if term is in term bank */
    unsigned int     v_count;       /* Number of variables, if term is in term bank */
    unsigned int     f_count;       /* Number of function symbols, if term is in term bank */
+#ifdef TERM_COMPACT_LAYOUT
+   RewriteState*    rw_data;       /* Out-of-line, allocated on first
+                                      write, NULL means "never
+                                      normalized or rewritten" */
+#else
    RewriteState     rw_data;       /* See above */
+#endif
    Type_p           type;          /* Sort of the term */
+#ifndef TERM_COMPACT_LAYOUT
    struct termcell* lson;          /* For storing shared term nodes in */
    struct termcell* rson;          /* a splay tree - see
-                                      cte_termcellstore.[ch] */
+                                      cte_termtrees.[ch] */
+#endif
 
 #ifdef ENABLE_LFHO
    struct termcell* binding_cache; /* For caching the term applied variable
@@ -255,12 +265,36 @@ Term_p  MakeRewrittenTerm(Term_p orig, Term_p new, int orig_remains, struct tbce
 #define MakeRewrittenTerm(orig, new, remains, bank) (assert(!remains), new)
 #endif
 
+#define RewriteStateCellAlloc() (RewriteState*)SizeMalloc(sizeof(RewriteState))
+#define RewriteStateCellFree(junk) SizeFree(junk, sizeof(RewriteState))
+
+/* Get a writable rewrite state (allocating it if necessary) and the
+   raw normal form dates. In the compact layout, a term without a
+   rewrite state is treated as in normal form since creation. */
+#ifdef TERM_COMPACT_LAYOUT
+#define TermRWState(term) ((term)->rw_data?(term)->rw_data:\
+                           TermRWStateAlloc(term))
+#define TermNFDateField(term,i) ((term)->rw_data?\
+                                 (term)->rw_data->nf_date[i]:\
+                                 SysDateCreationTime())
+#else
+#define TermRWState(term) (&((term)->rw_data))
+#define TermNFDateField(term,i) ((term)->rw_data.nf_date[i])
+#endif
+#define TermSetNFDate(term,i,date) (TermRWState(term)->nf_date[i] = (date))
+
 #define TermNFDate(term,i) (TermIsRewritten(term)?\
-                           SysDateCreationTime():(term)->rw_data.nf_date[i])
+                           SysDateCreationTime():TermNFDateField(term,i))
 
-/* Absolutely get the value of the replace and demod fields */
+/* Absolutely get the value of the replace and demod fields (only
+   valid for rewritten terms in the compact layout) */
+#ifdef TERM_COMPACT_LAYOUT
+#define TermRWReplaceField(term) ((term)->rw_data->rw_desc.replace)
+#define TermRWDemodField(term)   ((term)->rw_data->rw_desc.demod)
+#else
 #define TermRWReplaceField(term) ((term)->rw_data.rw_desc.replace)
 #define TermRWDemodField(term)   ((term)->rw_data.rw_desc.demod)
+#endif
 #define REWRITE_AT_SUBTERM 0
 
 /* Get the logical value of the replaced term / demodulator */
@@ -273,6 +307,9 @@ static inline Term_p TermConstCellAlloc(FunCode symbol);
 static inline Term_p TermTopAlloc(FunCode f_code, int arity);
 static inline Term_p TermTopCopy(Term_p source);
 static inline Term_p TermTopCopyWithoutArgs(Term_p source);
+#ifdef TERM_COMPACT_LAYOUT
+static inline RewriteState* TermRWStateAlloc(Term_p term);
+#endif
 
 void    TermTopFree(Term_p junk);
 void    TermFree(Term_p junk);
@@ -550,6 +587,35 @@ static inline Term_p TermTopCopy(restrict Term_p source)
    return handle;
 }
 
+#ifdef TERM_COMPACT_LAYOUT
+/*-----------------------------------------------------------------------
+//
+// Function: TermRWStateAlloc()
+//
+//   Allocate and initialize the out-of-line rewrite state of term
+//   (which must not have one yet) and return it.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static inline RewriteState* TermRWStateAlloc(Term_p term)
+{
+   RewriteState* handle = RewriteStateCellAlloc();
+
+   assert(!term->rw_data);
+   handle->nf_date[0] = SysDateCreationTime();
+   handle->nf_date[1] = SysDateCreationTime();
+   handle->rw_desc.replace = NULL;
+   handle->rw_desc.demod   = NULL;
+   term->rw_data = handle;
+
+   return handle;
+}
+#endif
+
 /*-----------------------------------------------------------------------
 //
 // Function: TermDefaultCellAlloc()
@@ -570,10 +636,14 @@ static inline Term_p TermDefaultCellAlloc(void)
    handle->arity      = 0;
    handle->type       = NULL;
    handle->binding    = NULL;
+#ifdef TERM_COMPACT_LAYOUT
+   handle->rw_data = NULL;
+#else
    handle->rw_data.nf_date[0] = SysDateCreationTime();
    handle->rw_data.nf_date[1] = SysDateCreationTime();
    handle->lson = NULL;
    handle->rson = NULL;
+#endif
    TermSetCache(handle, NULL);
    TermSetBank(handle, NULL);
 
@@ -605,10 +675,14 @@ static inline Term_p TermDefaultCellArityAlloc(int arity)
    for(int i = 0; i < arity; ++i)
       handle->args[i] = NULL;
 
+#ifdef TERM_COMPACT_LAYOUT
+   handle->rw_data = NULL;
+#else
    handle->rw_data.nf_date[0] = SysDateCreationTime();
    handle->rw_data.nf_date[1] = SysDateCreationTime();
    handle->lson = NULL;
    handle->rson = NULL;
+#endif
    TermSetCache(handle, NULL);
    TermSetBank(handle, NULL);
 
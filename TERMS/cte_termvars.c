@@ -31,6 +31,8 @@
 /*                      Forward Declarations                           */
 /*---------------------------------------------------------------------*/
 
+Term_p var_bank_var_alloc(VarBank_p bank, FunCode f_code, Type_p type);
+
 
 /*---------------------------------------------------------------------*/
 /*                         Internal Functions                          */
@@ -222,7 +224,8 @@ void VarBankPairShadow(VarBank_p primary, VarBank_p secondary)
    primary->id       = "Primary";
    secondary->id     = "Secondary";
 
-   // Create primary vars in secondary
+   // Create primary vars in secondary (only there, the primary
+   // already has them)
    for(sort=0; sort < PDArraySize(primary->varstacks); sort++)
    {
       varstack = PDArrayElementP(primary->varstacks, sort);
@@ -233,7 +236,7 @@ void VarBankPairShadow(VarBank_p primary, VarBank_p secondary)
             var = PStackElementP(varstack, i);
             assert(!VarIsAltVar(var));
             assert(var->type->type_uid == sort);
-            VarBankVarAlloc(secondary, var->f_code, var->type);
+            var_bank_var_alloc(secondary, var->f_code, var->type);
          }
       }
    }
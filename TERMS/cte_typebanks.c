@@ -20,6 +20,7 @@ Contents
 
 Created: Tue Feb 24 01:23:24 MET 1998 - Ripped out of the now obsolete
          cte_terms.h
+Sat Oct 17 2026: Type constructor names are interned in a hash table.
 
 -----------------------------------------------------------------------*/
 
@@ -69,7 +70,8 @@ FuncSymbType TermParseOperator(Scanner_p in, DStr_p id);
 //
 // Function: bii_alloc()
 //
-//   Allocates one cell of back_idx_info based on construction arguments.
+//   Allocates one cell of back_idx_info based on construction
+//   arguments. The name is not copied (it is interned in name_idx).
 //
 // Global Variables: -
 //
@@ -80,7 +82,7 @@ FuncSymbType TermParseOperator(Scanner_p in, DStr_p id);
 static inline back_idx_info* bii_alloc(const char* name, int arity)
 {
    back_idx_info* ptr = SizeMalloc(sizeof(back_idx_info));
-   ptr->name  = SecureStrdup(name);
+   ptr->name  = name;
    ptr->arity = arity;
    return ptr;
 }
@@ -315,7 +317,7 @@ TypeBank_p TypeBankAlloc()
    TypeBank_p handle = TypeBankCellAlloc();
 
    handle->back_idx = PStackAlloc();
-   handle->name_idx = NULL;
+   handle->name_idx = StrHashAlloc();
 
    handle->names_count = 0;
    handle->types_count = 0;
@@ -416,8 +418,9 @@ Type_p TypeBankInsertTypeShared(TypeBank_p bank, Type_p t)
 TypeConsCode TypeBankDefineTypeConstructor(TypeBank_p bank, const char* name, int arity)
 {
    assert(bank);
-   StrTree_p node = StrTreeFind(&bank->name_idx, name);
-   if(node)
+   bool is_new;
+   StrHashEntry_p node = StrHashInsert(bank->name_idx, name, &is_new);
+   if(!is_new)
    {
       if(GetArity(node) == arity)
       {
@@ -440,13 +443,12 @@ TypeConsCode TypeBankDefineTypeConstructor(TypeBank_p bank, const char* name, in
    }
    else
    {
-      IntOrP id    = {.i_val = bank->names_count++};
-      IntOrP arity_iop = {.i_val = (long)arity};
-      StrTreeStore(&bank->name_idx, (char*)name, id, arity_iop);
-      PStackPushP(bank->back_idx, bii_alloc(name, arity));
+      node->val1.i_val = bank->names_count++;
+      node->val2.i_val = arity;
+      PStackPushP(bank->back_idx, bii_alloc(node->key, arity));
       assert(PStackGetSP(bank->back_idx) == bank->names_count);
 
-      return id.i_val;
+      return GetNameId(node);
    }
 }
 
@@ -484,7 +486,7 @@ TypeConsCode TypeBankDefineSimpleSort(TypeBank_p bank, const char* name)
 TypeConsCode TypeBankFindTCCode(TypeBank_p bank, const char* name)
 {
    assert(bank);
-   StrTree_p node = StrTreeFind(&bank->name_idx, name);
+   StrHashEntry_p node = StrHashFind(bank->name_idx, name);
 
    return node ? GetNameId(node) : NAME_NOT_FOUND;
 }
@@ -837,15 +839,12 @@ void TypeBankFree(TypeBank_p bank)
    {
       back_idx_info* bii = PStackElementP(bank->back_idx, i);
 
-      void* ptr_to_free = (void*)bii->name;
-
-      FREE(ptr_to_free); // stiffing warnings
       SizeFree(bii, sizeof(back_idx_info));
    }
 
    PStackFree(bank->back_idx);
 
-   StrTreeFree(bank->name_idx);
+   StrHashFree(bank->name_idx);
    for(int i=0; i<TYPEBANK_SIZE; i++)
    {
       PObjTreeFree(bank->hash_table[i], tree_free_fun);
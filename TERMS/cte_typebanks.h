@@ -24,6 +24,7 @@ Contents
 #include <cio_scanner.h>
 #include <clb_objtrees.h>
 #include <clb_pdarrays.h>
+#include <clb_strhash.h>
 
 #define TYPEBANK_SIZE      4096
 #define TYPEBANK_HASH_MASK TYPEBANK_SIZE-1
@@ -35,7 +36,7 @@ Contents
 /*---------------------------------------------------------------------*/
 typedef struct typebank_cell {
    PStack_p       back_idx;                   // Type constructor or simple type back index
-   StrTree_p      name_idx;                   // Name to arity, type_identifier pair
+   StrHash_p      name_idx;                   // Name to arity, type_identifier pair
                                               // for sorts arity is always 0
    long           names_count;                // Counter for different names inserted
    TypeUniqueID   types_count;                // Counter for different types inserted -- Each type will
@@ -0,0 +1 @@
+../CLAUSES/ccl_clauseinfo.h
\ No newline at end of file
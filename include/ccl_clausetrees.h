@@ -0,0 +1 @@
+../CLAUSES/ccl_clausetrees.h
\ No newline at end of file
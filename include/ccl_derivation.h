@@ -0,0 +1 @@
+../CLAUSES/ccl_derivation.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_eqn.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_eqnresolution.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_f_generality.h
\ No newline at end of file
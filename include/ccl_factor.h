@@ -0,0 +1 @@
+../CLAUSES/ccl_factor.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_formulasets.h
\ No newline at end of file
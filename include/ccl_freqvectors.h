@@ -0,0 +1 @@
+../CLAUSES/ccl_freqvectors.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_global_indices.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_groundcc.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_neweval.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_overlap_index.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_satinterface.h
\ No newline at end of file
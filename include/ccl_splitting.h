@@ -0,0 +1 @@
+../CLAUSES/ccl_splitting.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_subsumption.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_subterm_index.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_tcnf.h
\ No newline at end of file
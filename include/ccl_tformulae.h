@@ -0,0 +1 @@
+../CLAUSES/ccl_tformulae.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CLAUSES/ccl_unfold_defs.h
\ No newline at end of file
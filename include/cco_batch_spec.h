@@ -0,0 +1 @@
+../CONTROL/cco_batch_spec.h
\ No newline at end of file
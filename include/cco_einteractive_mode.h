@@ -0,0 +1 @@
+../CONTROL/cco_einteractive_mode.h
\ No newline at end of file
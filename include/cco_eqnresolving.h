@@ -0,0 +1 @@
+../CONTROL/cco_eqnresolving.h
\ No newline at end of file
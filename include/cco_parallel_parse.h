@@ -0,0 +1 @@
+../CONTROL/cco_parallel_parse.h
\ No newline at end of file
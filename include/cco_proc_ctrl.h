@@ -0,0 +1 @@
+../CONTROL/cco_proc_ctrl.h
\ No newline at end of file
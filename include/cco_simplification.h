@@ -0,0 +1 @@
+../CONTROL/cco_simplification.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CONTROL/cco_sine.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CONTROL/cco_spec_image.h
\ No newline at end of file
@@ -0,0 +1 @@
+../EXTERNAL/cex_csscpa.h
\ No newline at end of file
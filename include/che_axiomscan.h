@@ -0,0 +1 @@
+../HEURISTICS/che_axiomscan.h
\ No newline at end of file
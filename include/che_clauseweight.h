@@ -0,0 +1 @@
+../HEURISTICS/che_clauseweight.h
\ No newline at end of file
@@ -0,0 +1 @@
+../HEURISTICS/che_evalbatch.h
\ No newline at end of file
@@ -0,0 +1 @@
+../HEURISTICS/che_fcode_featurearrays.h
\ No newline at end of file
@@ -0,0 +1 @@
+../HEURISTICS/che_fifo.h
\ No newline at end of file
@@ -0,0 +1 @@
+../HEURISTICS/che_funweights.h
\ No newline at end of file
@@ -0,0 +1 @@
+../HEURISTICS/che_hcb.h
\ No newline at end of file
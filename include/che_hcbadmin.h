@@ -0,0 +1 @@
+../HEURISTICS/che_hcbadmin.h
\ No newline at end of file
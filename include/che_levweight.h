@@ -0,0 +1 @@
+../HEURISTICS/che_levweight.h
\ No newline at end of file
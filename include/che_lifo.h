@@ -0,0 +1 @@
+../HEURISTICS/che_lifo.h
\ No newline at end of file
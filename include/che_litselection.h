@@ -0,0 +1 @@
+../HEURISTICS/che_litselection.h
\ No newline at end of file
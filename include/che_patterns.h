@@ -0,0 +1 @@
+../HEURISTICS/che_patterns.h
\ No newline at end of file
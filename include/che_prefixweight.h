@@ -0,0 +1 @@
+../HEURISTICS/che_prefixweight.h
\ No newline at end of file
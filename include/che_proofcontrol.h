@@ -0,0 +1 @@
+../HEURISTICS/che_proofcontrol.h
\ No newline at end of file
@@ -0,0 +1 @@
+../HEURISTICS/che_random.h
\ No newline at end of file
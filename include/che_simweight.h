@@ -0,0 +1 @@
+../HEURISTICS/che_simweight.h
\ No newline at end of file
@@ -0,0 +1 @@
+../HEURISTICS/che_strucweight.h
\ No newline at end of file
@@ -0,0 +1 @@
+../HEURISTICS/che_termweight.h
\ No newline at end of file
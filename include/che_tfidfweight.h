@@ -0,0 +1 @@
+../HEURISTICS/che_tfidfweight.h
\ No newline at end of file
@@ -0,0 +1 @@
+../HEURISTICS/che_to_precgen.h
\ No newline at end of file
@@ -0,0 +1 @@
+../HEURISTICS/che_to_weightgen.h
\ No newline at end of file
@@ -0,0 +1 @@
+../INOUT/cio_basicparser.h
\ No newline at end of file
@@ -0,0 +1 @@
+../INOUT/cio_network.h
\ No newline at end of file
@@ -0,0 +1 @@
+../INOUT/cio_output.h
\ No newline at end of file
@@ -0,0 +1 @@
+../INOUT/cio_scanner.h
\ No newline at end of file
@@ -0,0 +1 @@
+../INOUT/cio_signals.h
\ No newline at end of file
@@ -0,0 +1 @@
+../INOUT/cio_streams.h
\ No newline at end of file
@@ -0,0 +1 @@
+../INOUT/cio_tempfile.h
\ No newline at end of file
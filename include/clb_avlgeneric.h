@@ -0,0 +1 @@
+../BASICS/clb_avlgeneric.h
\ No newline at end of file
@@ -0,0 +1 @@
+../BASICS/clb_bumparena.h
\ No newline at end of file
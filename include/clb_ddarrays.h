@@ -0,0 +1 @@
+../BASICS/clb_ddarrays.h
\ No newline at end of file
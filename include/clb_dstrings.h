@@ -0,0 +1 @@
+../BASICS/clb_dstrings.h
\ No newline at end of file
@@ -0,0 +1 @@
+../BASICS/clb_fixdarrays.h
\ No newline at end of file
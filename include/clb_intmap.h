@@ -0,0 +1 @@
+../BASICS/clb_intmap.h
\ No newline at end of file
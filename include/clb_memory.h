@@ -0,0 +1 @@
+../BASICS/clb_memory.h
\ No newline at end of file
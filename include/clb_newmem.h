@@ -0,0 +1 @@
+../BASICS/clb_newmem.h
\ No newline at end of file
@@ -0,0 +1 @@
+../BASICS/clb_objtrees.h
\ No newline at end of file
@@ -0,0 +1 @@
+../BASICS/clb_partial_orderings.h
\ No newline at end of file
@@ -0,0 +1 @@
+../BASICS/clb_pdarrays.h
\ No newline at end of file
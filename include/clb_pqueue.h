@@ -0,0 +1 @@
+../BASICS/clb_pqueue.h
\ No newline at end of file
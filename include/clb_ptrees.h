@@ -0,0 +1 @@
+../BASICS/clb_ptrees.h
\ No newline at end of file
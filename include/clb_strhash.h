@@ -0,0 +1 @@
+../BASICS/clb_strhash.h
\ No newline at end of file
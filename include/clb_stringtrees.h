@@ -0,0 +1 @@
+../BASICS/clb_stringtrees.h
\ No newline at end of file
@@ -0,0 +1 @@
+../BASICS/clb_threadpool.h
\ No newline at end of file
@@ -0,0 +1 @@
+../LEARN/cle_annotations.h
\ No newline at end of file
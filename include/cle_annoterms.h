@@ -0,0 +1 @@
+../LEARN/cle_annoterms.h
\ No newline at end of file
@@ -0,0 +1 @@
+../LEARN/cle_classification.h
\ No newline at end of file
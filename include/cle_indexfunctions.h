@@ -0,0 +1 @@
+../LEARN/cle_indexfunctions.h
\ No newline at end of file
@@ -0,0 +1 @@
+../LEARN/cle_termtops.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CONTRIB/picosat-965/config.h
\ No newline at end of file
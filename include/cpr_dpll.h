@@ -0,0 +1 @@
+../PROPOSITIONAL/cpr_dpll.h
\ No newline at end of file
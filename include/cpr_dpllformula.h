@@ -0,0 +1 @@
+../PROPOSITIONAL/cpr_dpllformula.h
\ No newline at end of file
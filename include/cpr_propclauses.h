@@ -0,0 +1 @@
+../PROPOSITIONAL/cpr_propclauses.h
\ No newline at end of file
@@ -0,0 +1 @@
+../TERMS/cte_acterms.h
\ No newline at end of file
@@ -0,0 +1 @@
+../TERMS/cte_match_mgu_1-1.h
\ No newline at end of file
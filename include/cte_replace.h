@@ -0,0 +1 @@
+../TERMS/cte_replace.h
\ No newline at end of file
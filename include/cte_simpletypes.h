@@ -0,0 +1 @@
+../TERMS/cte_simpletypes.h
\ No newline at end of file
@@ -0,0 +1 @@
+../TERMS/cte_termbanks.h
\ No newline at end of file
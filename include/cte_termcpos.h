@@ -0,0 +1 @@
+../TERMS/cte_termcpos.h
\ No newline at end of file
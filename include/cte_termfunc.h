@@ -0,0 +1 @@
+../TERMS/cte_termfunc.h
\ No newline at end of file
@@ -0,0 +1 @@
+../TERMS/cte_termpos.h
\ No newline at end of file
@@ -0,0 +1 @@
+../TERMS/cte_termtrees.h
\ No newline at end of file
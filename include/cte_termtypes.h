@@ -0,0 +1 @@
+../TERMS/cte_termtypes.h
\ No newline at end of file
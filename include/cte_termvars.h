@@ -0,0 +1 @@
+../TERMS/cte_termvars.h
\ No newline at end of file
@@ -0,0 +1 @@
+../TERMS/cte_typebanks.h
\ No newline at end of file
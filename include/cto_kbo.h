@@ -0,0 +1 @@
+../ORDERINGS/cto_kbo.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ORDERINGS/cto_kbolin.h
\ No newline at end of file
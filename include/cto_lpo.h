@@ -0,0 +1 @@
+../ORDERINGS/cto_lpo.h
\ No newline at end of file
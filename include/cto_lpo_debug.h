@@ -0,0 +1 @@
+../ORDERINGS/cto_lpo_debug.h
\ No newline at end of file
@@ -0,0 +1 @@
+../ORDERINGS/cto_ocb.h
\ No newline at end of file
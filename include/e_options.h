@@ -0,0 +1 @@
+../PROVER/e_options.h
\ No newline at end of file
@@ -0,0 +1 @@
+../PROVER/e_version.h
\ No newline at end of file
@@ -0,0 +1 @@
+../PCL2/pcl_expressions.h
\ No newline at end of file
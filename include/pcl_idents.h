@@ -0,0 +1 @@
+../PCL2/pcl_idents.h
\ No newline at end of file
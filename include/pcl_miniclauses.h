@@ -0,0 +1 @@
+../PCL2/pcl_miniclauses.h
\ No newline at end of file
@@ -0,0 +1 @@
+../PCL2/pcl_miniprotocol.h
\ No newline at end of file
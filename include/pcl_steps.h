@@ -0,0 +1 @@
+../PCL2/pcl_steps.h
\ No newline at end of file
@@ -0,0 +1 @@
+../CONTRIB/picosat-965/picosat.h
\ No newline at end of file